@@ -0,0 +1,65 @@
+description("Tests Map lookups with object keys across deletion, growth and clear().");
+
+var map = new Map;
+var keys = [];
+for (var i = 0; i < 8; ++i) {
+    keys.push({ index: i });
+    map.set(keys[i], i);
+}
+
+shouldBe("map.size", "8");
+shouldBeTrue("map.delete(keys[1])");
+shouldBeTrue("map.delete(keys[5])");
+shouldBeFalse("map.delete(keys[5])");
+shouldBe("map.size", "6");
+shouldBeFalse("map.has(keys[1])");
+shouldBeUndefined("map.get(keys[5])");
+shouldBeTrue("map.has(keys[0])");
+shouldBe("map.get(keys[7])", "7");
+shouldBeFalse("map.has({ index: 0 })");
+
+// Grow the map well past its initial capacity so entries get rehashed.
+for (var i = 8; i < 1000; ++i) {
+    keys.push({ index: i });
+    map.set(keys[i], i);
+}
+
+shouldBe("map.size", "998");
+shouldBeFalse("map.has(keys[1])");
+shouldBeFalse("map.has(keys[5])");
+shouldBe("map.get(keys[0])", "0");
+shouldBe("map.get(keys[7])", "7");
+shouldBe("map.get(keys[8])", "8");
+shouldBe("map.get(keys[999])", "999");
+
+var missingLookups = 0;
+for (var i = 0; i < keys.length; ++i) {
+    if (i == 1 || i == 5)
+        continue;
+    if (!map.has(keys[i]) || map.get(keys[i]) !== i)
+        ++missingLookups;
+}
+shouldBe("missingLookups", "0");
+
+// Re-adding a deleted key after growth gives it a fresh entry.
+map.set(keys[1], "again");
+shouldBeEqualToString("map.get(keys[1])", "again");
+shouldBe("map.size", "999");
+
+// Overwriting an existing key keeps the size.
+map.set(keys[999], -1);
+shouldBe("map.get(keys[999])", "-1");
+shouldBe("map.size", "999");
+
+map.clear();
+shouldBe("map.size", "0");
+shouldBeFalse("map.has(keys[0])");
+shouldBeFalse("map.has(keys[1])");
+shouldBeFalse("map.has(keys[999])");
+shouldBeUndefined("map.get(keys[7])");
+
+map.set(keys[3], "after clear");
+shouldBe("map.size", "1");
+shouldBeTrue("map.has(keys[3])");
+shouldBeFalse("map.has(keys[4])");
+shouldBeEqualToString("map.get(keys[3])", "after clear");
@@ -77,6 +77,10 @@ static const BenchmarkPair benchmarkPairs[] = {
     { "flickr_memory_warning", benchmark_flickr_memory_warning },
     { "reddit_memory_warning", benchmark_reddit_memory_warning },
     { "theverge_memory_warning", benchmark_theverge_memory_warning },
+    { "facebook_producer_consumer", benchmark_facebook_producer_consumer },
+    { "flickr_producer_consumer", benchmark_flickr_producer_consumer },
+    { "reddit_producer_consumer", benchmark_reddit_producer_consumer },
+    { "theverge_producer_consumer", benchmark_theverge_producer_consumer },
 };
 
 static const size_t benchmarksPairsCount = sizeof(benchmarkPairs) / sizeof(BenchmarkPair);
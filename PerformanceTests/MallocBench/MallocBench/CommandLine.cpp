@@ -33,6 +33,7 @@ struct option CommandLine::longOptions[] =
     {"parallel", no_argument, 0, 'p'},
     {"heap", required_argument, 0, 'h'},
     {"runs", required_argument, 0, 'r'},
+    {"statistics", no_argument, 0, 's'},
     {0, 0, 0, 0}
 };
 
@@ -42,10 +43,11 @@ CommandLine::CommandLine(int argc, char** argv)
     , m_isParallel(false)
     , m_heapSize(0)
     , m_runs(4)
+    , m_dumpStatistics(false)
 {
     int optionIndex = 0;
     int ch;
-    while ((ch = getopt_long(argc, argv, "b:p:h:r", longOptions, &optionIndex)) != -1) {
+    while ((ch = getopt_long(argc, argv, "b:p:h:rs", longOptions, &optionIndex)) != -1) {
         switch (ch)
         {
             case 'b':
@@ -64,6 +66,10 @@ CommandLine::CommandLine(int argc, char** argv)
                 m_runs = atoi(optarg);
                 break;
 
+            case 's':
+                m_dumpStatistics = true;
+                break;
+
             default:
                 break;
         }
@@ -75,5 +81,5 @@ void CommandLine::printUsage()
     std::string fullPath(m_argv[0]);
     size_t pos = fullPath.find_last_of("/") + 1;
     std::string program = fullPath.substr(pos);
-    std::cout << "Usage: " << program << " --benchmark benchmark_name [ --parallel ] [ --heap MB ]" << std::endl;
+    std::cout << "Usage: " << program << " --benchmark benchmark_name [ --parallel ] [ --heap MB ] [ --statistics ]" << std::endl;
 }
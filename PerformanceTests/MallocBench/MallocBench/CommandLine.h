@@ -34,6 +34,7 @@ public:
     bool isParallel() { return m_isParallel; }
     size_t heapSize() { return m_heapSize; }
     size_t runs() { return m_runs; }
+    bool dumpStatistics() { return m_dumpStatistics; }
 
     void printUsage();
 
@@ -46,4 +47,5 @@ private:
     bool m_isParallel;
     size_t m_heapSize;
     size_t m_runs;
+    bool m_dumpStatistics;
 };
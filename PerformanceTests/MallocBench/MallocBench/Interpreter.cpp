@@ -40,9 +40,20 @@
 
 #include "mbmalloc.h"
 
-Interpreter::Interpreter(const char* fileName, bool shouldFreeAllObjects)
+static const size_t freeBatchSize = 256;
+static const long maxFreeBatchesInFlight = 64;
+
+Interpreter::Interpreter(const char* fileName, bool shouldFreeAllObjects, bool shouldFreeOnAnotherThread)
     : m_shouldFreeAllObjects(shouldFreeAllObjects)
+    , m_freeQueue(0)
+    , m_freeBatchesInFlight(0)
+    , m_freeBatch(0)
 {
+    if (shouldFreeOnAnotherThread) {
+        m_freeQueue = dispatch_queue_create("Interpreter free queue", 0);
+        m_freeBatchesInFlight = dispatch_semaphore_create(maxFreeBatchesInFlight);
+    }
+
     m_fd = open(fileName, O_RDWR, S_IRUSR | S_IWUSR);
     if (m_fd == -1)
         fprintf(stderr, "failed to open\n");
@@ -78,6 +89,48 @@ Interpreter::~Interpreter()
     int result = close(m_fd);
     if (result == -1)
         fprintf(stderr, "failed to close\n");
+
+    if (m_freeQueue) {
+        dispatch_release(m_freeQueue);
+        dispatch_release(m_freeBatchesInFlight);
+    }
+}
+
+void Interpreter::deallocate(const Record& record)
+{
+    if (!m_freeQueue) {
+        mbfree(record.object, record.size);
+        return;
+    }
+
+    if (!m_freeBatch) {
+        m_freeBatch = new std::vector<Record>;
+        m_freeBatch->reserve(freeBatchSize);
+    }
+
+    m_freeBatch->push_back(record);
+    if (m_freeBatch->size() == freeBatchSize)
+        flushFrees();
+}
+
+void Interpreter::flushFrees()
+{
+    if (!m_freeBatch)
+        return;
+
+    // Bound the backlog, so a slow consumer shows up as time rather than as memory.
+    dispatch_semaphore_wait(m_freeBatchesInFlight, DISPATCH_TIME_FOREVER);
+
+    std::vector<Record>* batch = m_freeBatch;
+    dispatch_semaphore_t freeBatchesInFlight = m_freeBatchesInFlight;
+    dispatch_async(m_freeQueue, ^{
+        for (auto& record : *batch)
+            mbfree(record.object, record.size);
+        delete batch;
+        dispatch_semaphore_signal(freeBatchesInFlight);
+    });
+
+    m_freeBatch = 0;
 }
 
 void Interpreter::run()
@@ -102,7 +155,7 @@ void Interpreter::run()
             }
             case op_free: {
                 assert(m_objects[op.slot].object);
-                mbfree(m_objects[op.slot].object, m_objects[op.slot].size);
+                deallocate(m_objects[op.slot]);
                 m_objects[op.slot] = { 0, 0 };
                 break;
             }
@@ -121,13 +174,17 @@ void Interpreter::run()
     }
 
     // A recording might not free all of its allocations.
-    if (!m_shouldFreeAllObjects)
-        return;
+    if (m_shouldFreeAllObjects) {
+        for (size_t i = 0; i < m_objects.size(); ++i) {
+            if (!m_objects[i].object)
+                continue;
+            deallocate(m_objects[i]);
+            m_objects[i] = { 0, 0 };
+        }
+    }
 
-    for (size_t i = 0; i < m_objects.size(); ++i) {
-        if (!m_objects[i].object)
-            continue;
-        mbfree(m_objects[i].object, m_objects[i].size);
-        m_objects[i] = { 0, 0 };
+    if (m_freeQueue) {
+        flushFrees();
+        dispatch_sync(m_freeQueue, ^{ });
     }
 }
@@ -26,11 +26,15 @@
 #ifndef Interpreter_h
 #define Interpreter_h
 
+#include <dispatch/dispatch.h>
 #include <vector>
 
 class Interpreter {
 public:
-    Interpreter(const char* fileName, bool shouldFreeAllObjects = true);
+    // With shouldFreeOnAnotherThread, the thread calling run() only allocates,
+    // and hands every free to a consumer thread, the way a page's worker
+    // threads hand objects back and forth.
+    Interpreter(const char* fileName, bool shouldFreeAllObjects = true, bool shouldFreeOnAnotherThread = false);
     ~Interpreter();
 
     void run();
@@ -40,10 +44,17 @@ private:
     struct Op { Opcode opcode; size_t slot; size_t size; };
     struct Record { void* object; size_t size; };
 
+    void deallocate(const Record&);
+    void flushFrees();
+
     bool m_shouldFreeAllObjects;
     int m_fd;
     size_t m_opCount;
     std::vector<Record> m_objects;
+
+    dispatch_queue_t m_freeQueue;
+    dispatch_semaphore_t m_freeBatchesInFlight;
+    std::vector<Record>* m_freeBatch;
 };
 
 #endif // Interpreter_h
@@ -50,3 +50,14 @@ void benchmark_facebook(bool isParallel)
     for (size_t i = 0; i < times; ++i)
         interpreter.run();
 }
+
+void benchmark_facebook_producer_consumer(bool isParallel)
+{
+    size_t times = 1;
+
+    bool shouldFreeAllObjects = true;
+    bool shouldFreeOnAnotherThread = true;
+    Interpreter interpreter("facebook.ops", shouldFreeAllObjects, shouldFreeOnAnotherThread);
+    for (size_t i = 0; i < times; ++i)
+        interpreter.run();
+}
@@ -27,6 +27,7 @@
 #define facebook_h
 
 void benchmark_facebook(bool isParallel);
+void benchmark_facebook_producer_consumer(bool isParallel);
 
 #endif // facebook_h
 
@@ -51,6 +51,17 @@ void benchmark_flickr(bool isParallel)
         interpreter.run();
 }
 
+void benchmark_flickr_producer_consumer(bool isParallel)
+{
+    size_t times = 1;
+
+    bool shouldFreeAllObjects = true;
+    bool shouldFreeOnAnotherThread = true;
+    Interpreter interpreter("flickr.ops", shouldFreeAllObjects, shouldFreeOnAnotherThread);
+    for (size_t i = 0; i < times; ++i)
+        interpreter.run();
+}
+
 void benchmark_flickr_memory_warning(bool isParallel)
 {
     size_t times = 1;
@@ -27,6 +27,7 @@
 #define flickr_h
 
 void benchmark_flickr(bool isParallel);
+void benchmark_flickr_producer_consumer(bool isParallel);
 void benchmark_flickr_memory_warning(bool isParallel);
 
 #endif // flickr_h
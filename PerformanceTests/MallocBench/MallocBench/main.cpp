@@ -29,6 +29,9 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <unistd.h>
+
+#include "mbmalloc.h"
 
 using namespace std;
 
@@ -59,8 +62,17 @@ int main(int argc, char** argv)
         heapSize << " [ heap: 0MB ]";
 
     cout << "Running " << commandLine.benchmarkName() << parallel << heapSize.str() << runs.str() << "..." << endl;
+    if (commandLine.dumpStatistics())
+        mbrecordallocationsites(true);
+
     benchmark.run();
     benchmark.printReport();
+
+    if (commandLine.dumpStatistics()) {
+        mbrecordallocationsites(false);
+        cout << endl << flush;
+        mbdumpstatistics(STDOUT_FILENO);
+    }
         
     return 0;
 }
@@ -50,4 +50,16 @@ void mbscavenge()
     malloc_zone_pressure_relief(nullptr, 0);
 }
 
+void mbrecordallocationsites(bool)
+{
+}
+
+void mbdumpstatistics(int fd)
+{
+    malloc_statistics_t statistics;
+    malloc_zone_statistics(nullptr, &statistics);
+    dprintf(fd, "Blocks in use: %u\nBytes in use: %zu\nBytes allocated: %zu\n",
+        statistics.blocks_in_use, statistics.size_in_use, statistics.size_allocated);
+}
+
 } // extern "C"
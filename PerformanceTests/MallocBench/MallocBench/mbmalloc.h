@@ -38,6 +38,8 @@ void* mbmalloc(size_t);
 void mbfree(void*, size_t);
 void* mbrealloc(void*, size_t, size_t);
 void mbscavenge();
+void mbrecordallocationsites(bool);
+void mbdumpstatistics(int fd);
     
 }
 
@@ -27,6 +27,7 @@
 #define reddit_h
 
 void benchmark_reddit(bool isParallel);
+void benchmark_reddit_producer_consumer(bool isParallel);
 void benchmark_reddit_memory_warning(bool isParallel);
 
 #endif // reddit_h
@@ -51,6 +51,17 @@ void benchmark_theverge(bool isParallel)
         interpreter.run();
 }
 
+void benchmark_theverge_producer_consumer(bool isParallel)
+{
+    size_t times = 1;
+
+    bool shouldFreeAllObjects = true;
+    bool shouldFreeOnAnotherThread = true;
+    Interpreter interpreter("theverge.ops", shouldFreeAllObjects, shouldFreeOnAnotherThread);
+    for (size_t i = 0; i < times; ++i)
+        interpreter.run();
+}
+
 void benchmark_theverge_memory_warning(bool isParallel)
 {
     size_t times = 1;
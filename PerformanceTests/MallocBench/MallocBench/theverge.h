@@ -27,6 +27,7 @@
 #define theverge_h
 
 void benchmark_theverge(bool isParallel);
+void benchmark_theverge_producer_consumer(bool isParallel);
 void benchmark_theverge_memory_warning(bool isParallel);
 
 #endif // theverge_h
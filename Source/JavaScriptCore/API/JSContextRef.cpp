@@ -105,6 +105,25 @@ void JSContextGroupClearExecutionTimeLimit(JSContextGroupRef group)
     watchdog.setTimeLimit(vm, std::numeric_limits<double>::infinity());
 }
 
+static void internalScriptYieldCallback(ExecState* exec, void* callbackPtr, void* callbackData)
+{
+    JSYieldCallback callback = reinterpret_cast<JSYieldCallback>(callbackPtr);
+    ASSERT(callback);
+    callback(toRef(exec), callbackData);
+}
+
+void JSContextGroupSetExecutionYieldInterval(JSContextGroupRef group, double interval, JSYieldCallback callback, void* callbackData)
+{
+    VM& vm = *toJS(group);
+    JSLockHolder locker(&vm);
+    Watchdog& watchdog = vm.watchdog;
+    if (callback) {
+        void* callbackPtr = reinterpret_cast<void*>(callback);
+        watchdog.setYieldInterval(vm, interval, internalScriptYieldCallback, callbackPtr, callbackData);
+    } else
+        watchdog.setYieldInterval(vm, std::numeric_limits<double>::infinity(), 0);
+}
+
 // From the API's perspective, a global context remains alive iff it has been JSGlobalContextRetained.
 
 JSGlobalContextRef JSGlobalContextCreate(JSClassRef globalObjectClass)
@@ -94,6 +94,39 @@ JS_EXPORT void JSContextGroupSetExecutionTimeLimit(JSContextGroupRef, double lim
 */
 JS_EXPORT void JSContextGroupClearExecutionTimeLimit(JSContextGroupRef) CF_AVAILABLE(10_6, 7_0);
 
+/*!
+@typedef JSYieldCallback
+@abstract The callback invoked periodically while script executes, as requested
+ via JSContextGroupSetExecutionYieldInterval.
+@param ctx The execution context to use.
+@param context User specified context data previously passed to
+ JSContextGroupSetExecutionYieldInterval.
+@discussion If you named your function Callback, you would declare it like this:
+
+ void Callback(JSContextRef ctx, void* context);
+
+ The running script is paused while the callback runs, and resumes when it returns.
+ This gives you a chance to handle input or other work that should not wait for the
+ script to finish.
+*/
+typedef void
+(*JSYieldCallback) (JSContextRef ctx, void* context);
+
+/*!
+@function
+@abstract Sets how often long running scripts yield to the embedder.
+@param group The JavaScript context group that this interval applies to.
+@param interval The interval, in seconds, between calls to the callback during
+ uninterrupted script execution.
+@param callback The callback function to invoke. Pass NULL to stop yielding.
+@param context User data that you can provide to be passed back to you
+ in your callback.
+
+ As with JSContextGroupSetExecutionTimeLimit, call this before you start executing
+ any scripts for the interval to take effect in all of them.
+*/
+JS_EXPORT void JSContextGroupSetExecutionYieldInterval(JSContextGroupRef, double interval, JSYieldCallback, void* context) CF_AVAILABLE(10_10, 8_0);
+
 /*!
 @function
 @abstract Gets a whether or not remote inspection is enabled on the context.
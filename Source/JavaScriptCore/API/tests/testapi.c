@@ -1164,6 +1164,14 @@ static bool extendTerminateCallback(JSContextRef ctx, void* context)
     }
     return true;
 }
+
+int yieldCallbackCalled = 0;
+static void yieldCallback(JSContextRef ctx, void* context)
+{
+    UNUSED_PARAM(ctx);
+    UNUSED_PARAM(context);
+    yieldCallbackCalled++;
+}
 #endif /* OS(DARWIN) */
 
 
@@ -2026,6 +2034,54 @@ int main(int argc, char* argv[])
             failed = true;
         }
     }
+
+    /* Test script yield interval: */
+    JSContextGroupClearExecutionTimeLimit(contextGroup);
+    JSContextGroupSetExecutionYieldInterval(contextGroup, 0.05f, yieldCallback, 0);
+    {
+        const char* loopForeverScript = "var startTime = currentCPUTime(); while (true) { if (currentCPUTime() - startTime > .300) break; } ";
+        JSStringRef script = JSStringCreateWithUTF8CString(loopForeverScript);
+        double startTime;
+        double endTime;
+        exception = NULL;
+        startTime = currentCPUTime();
+        v = JSEvaluateScript(context, script, NULL, NULL, 1, &exception);
+        endTime = currentCPUTime();
+
+        if (((endTime - startTime) >= .300f) && (yieldCallbackCalled >= 2) && !exception)
+            printf("PASS: script yielded without being terminated.\n");
+        else {
+            if ((endTime - startTime) < .300f)
+                printf("FAIL: script did not run to completion while yielding.\n");
+            if (yieldCallbackCalled < 2)
+                printf("FAIL: script yield callback was not called repeatedly.\n");
+            if (exception)
+                printf("FAIL: Unexpected TerminatedExecutionException thrown while yielding.\n");
+            failed = true;
+        }
+        JSStringRelease(script);
+    }
+
+    /* Test script yield interval removal: */
+    JSContextGroupSetExecutionYieldInterval(contextGroup, 0.05f, 0, 0);
+    {
+        const char* loopForeverScript = "var startTime = currentCPUTime(); while (true) { if (currentCPUTime() - startTime > .150) break; } ";
+        JSStringRef script = JSStringCreateWithUTF8CString(loopForeverScript);
+        int yieldCallbackCalledBefore = yieldCallbackCalled;
+        exception = NULL;
+        v = JSEvaluateScript(context, script, NULL, NULL, 1, &exception);
+
+        if ((yieldCallbackCalled == yieldCallbackCalledBefore) && !exception)
+            printf("PASS: script did not yield after the yield callback was removed.\n");
+        else {
+            if (yieldCallbackCalled != yieldCallbackCalledBefore)
+                printf("FAIL: script yield callback was called after it was removed.\n");
+            if (exception)
+                printf("FAIL: Unexpected exception thrown after the yield callback was removed.\n");
+            failed = true;
+        }
+        JSStringRelease(script);
+    }
 #endif /* OS(DARWIN) */
 
     // Clear out local variables pointing at JSObjectRefs to allow their values to be collected
@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "config.h"
+#include "BytecodeTemporaryCoalescing.h"
+
+#include "BytecodeLivenessAnalysisInlines.h"
+#include "BytecodeUseDef.h"
+#include "CodeBlock.h"
+#include "FullBytecodeLiveness.h"
+#include "JSCInlines.h"
+#include "StackAlignment.h"
+#include <wtf/FastBitVector.h>
+
+namespace JSC {
+
+// Bounds the size of the live range table (temporaries times instructions, in bits).
+static const size_t maximumLiveRangeBits = 1 << 24;
+
+namespace {
+
+// Collects the register operands of one instruction. Operands that are read straight out
+// of an instruction slot can be renumbered in place. Operands that BytecodeUseDef computes
+// (call arguments, operand ranges) imply a fixed layout and cannot.
+class OperandCollector {
+public:
+    OperandCollector(Instruction* instruction, size_t length)
+        : m_instruction(instruction)
+        , m_length(length)
+    {
+    }
+
+    void operator()(CodeBlock*, Instruction*, OpcodeID, int& operand)
+    {
+        ptrdiff_t byteOffset = reinterpret_cast<char*>(&operand) - reinterpret_cast<char*>(m_instruction);
+        if (byteOffset > 0
+            && !(byteOffset % sizeof(Instruction))
+            && static_cast<size_t>(byteOffset) < m_length * sizeof(Instruction)) {
+            unsigned slot = byteOffset / sizeof(Instruction);
+            if (!m_slots.contains(slot))
+                m_slots.append(slot);
+            return;
+        }
+        m_computedOperands.append(operand);
+    }
+
+    void operator()(CodeBlock*, Instruction*, OpcodeID, int&& operand)
+    {
+        m_computedOperands.append(operand);
+    }
+
+    const Vector<unsigned, 8>& slots() const { return m_slots; }
+    const Vector<int, 8>& computedOperands() const { return m_computedOperands; }
+
+private:
+    Instruction* m_instruction;
+    size_t m_length;
+    Vector<unsigned, 8> m_slots;
+    Vector<int, 8> m_computedOperands;
+};
+
+} // anonymous namespace
+
+static void pinOperand(FastBitVector& pinned, int operand)
+{
+    VirtualRegister reg(operand);
+    if (!reg.isLocal())
+        return;
+    unsigned local = reg.toLocal();
+    if (local < pinned.numBits())
+        pinned.set(local);
+}
+
+static bool rangesOverlap(FastBitVector& scratch, const FastBitVector& a, const FastBitVector& b)
+{
+    scratch.set(a);
+    scratch.filter(b);
+    return scratch.bitCount();
+}
+
+void coalesceBytecodeTemporaries(CodeBlock* codeBlock)
+{
+    unsigned numVars = codeBlock->m_numVars;
+    unsigned numLocals = codeBlock->m_numCalleeRegisters;
+    if (numLocals <= numVars + 1)
+        return;
+
+    Interpreter* interpreter = codeBlock->vm()->interpreter;
+    Instruction* instructionsBegin = codeBlock->instructions().begin();
+    unsigned instructionsSize = codeBlock->instructions().size();
+
+    // Pin every local that must stay where the generator put it: outgoing call frames,
+    // operand ranges, and anything that shows up in an instruction slot we do not know to
+    // be a register operand. Pinning too much only costs us compaction.
+    FastBitVector pinned;
+    pinned.resize(numLocals);
+    Vector<unsigned> instructionOffsets;
+    for (unsigned bytecodeOffset = 0; bytecodeOffset < instructionsSize;) {
+        Instruction* instruction = instructionsBegin + bytecodeOffset;
+        OpcodeID opcodeID = interpreter->getOpcodeID(instruction->u.opcode);
+        size_t length = opcodeLength(opcodeID);
+
+        switch (opcodeID) {
+        case op_call_varargs:
+        case op_construct_varargs:
+            // The callee frame is placed at run time, past the first free register.
+            return;
+        case op_call:
+        case op_call_eval:
+        case op_construct: {
+            int frameBase = -instruction[4].u.operand;
+            int frameSize = CallFrame::thisArgumentOffset() + instruction[3].u.operand;
+            for (int i = 0; i < frameSize; ++i)
+                pinOperand(pinned, frameBase + i);
+            break;
+        }
+        default:
+            break;
+        }
+
+        OperandCollector uses(instruction, length);
+        OperandCollector defs(instruction, length);
+        computeUsesForBytecodeOffset(codeBlock, bytecodeOffset, uses);
+        computeDefsForBytecodeOffset(codeBlock, bytecodeOffset, defs);
+        for (size_t i = 0; i < uses.computedOperands().size(); ++i)
+            pinOperand(pinned, uses.computedOperands()[i]);
+        for (size_t i = 0; i < defs.computedOperands().size(); ++i)
+            pinOperand(pinned, defs.computedOperands()[i]);
+        for (unsigned slot = 1; slot < length; ++slot) {
+            if (!uses.slots().contains(slot) && !defs.slots().contains(slot))
+                pinOperand(pinned, instruction[slot].u.operand);
+        }
+
+        instructionOffsets.append(bytecodeOffset);
+        bytecodeOffset += length;
+    }
+
+    if (codeBlock->usesArguments()) {
+        pinOperand(pinned, codeBlock->argumentsRegister().offset());
+        pinOperand(pinned, unmodifiedArgumentsRegister(codeBlock->argumentsRegister()).offset());
+    }
+    if (codeBlock->needsActivation())
+        pinOperand(pinned, codeBlock->activationRegister().offset());
+
+    unsigned numTemporaries = numLocals - numVars;
+    if (static_cast<size_t>(numTemporaries) * instructionOffsets.size() > maximumLiveRangeBits)
+        return;
+
+    BytecodeLivenessAnalysis livenessAnalysis(codeBlock);
+    FullBytecodeLiveness liveness;
+    livenessAnalysis.computeFullLiveness(liveness);
+
+    // A temporary occupies an instruction if it is live into it or written by it. Two
+    // temporaries can share a register if they never occupy the same instruction.
+    Vector<FastBitVector> ranges(numTemporaries);
+    for (unsigned index = 0; index < instructionOffsets.size(); ++index) {
+        unsigned bytecodeOffset = instructionOffsets[index];
+        Instruction* instruction = instructionsBegin + bytecodeOffset;
+        OpcodeID opcodeID = interpreter->getOpcodeID(instruction->u.opcode);
+
+        Vector<unsigned, 16> occupants;
+        FastBitVector live = liveness.getLiveness(bytecodeOffset);
+        for (unsigned local = numVars; local < numLocals; ++local) {
+            if (live.get(local))
+                occupants.append(local);
+        }
+        OperandCollector defs(instruction, opcodeLength(opcodeID));
+        computeDefsForBytecodeOffset(codeBlock, bytecodeOffset, defs);
+        for (size_t i = 0; i < defs.slots().size(); ++i) {
+            VirtualRegister reg(instruction[defs.slots()[i]].u.operand);
+            if (reg.isLocal())
+                occupants.append(reg.toLocal());
+        }
+
+        for (size_t i = 0; i < occupants.size(); ++i) {
+            unsigned local = occupants[i];
+            if (local < numVars || local >= numLocals || pinned.get(local))
+                continue;
+            FastBitVector& range = ranges[local - numVars];
+            if (!range.numBits())
+                range.resize(instructionOffsets.size());
+            range.set(index);
+        }
+    }
+
+    // Give each temporary the lowest register whose occupants it never overlaps with. A
+    // temporary's own register is always free by the time we reach it, so nothing moves up.
+    Vector<unsigned> newTemporaryIndex(numTemporaries);
+    Vector<FastBitVector> assignedRanges(numTemporaries);
+    FastBitVector scratch;
+    scratch.resize(instructionOffsets.size());
+    bool changed = false;
+    unsigned usedLocals = numVars;
+    for (unsigned temporary = 0; temporary < numTemporaries; ++temporary) {
+        newTemporaryIndex[temporary] = temporary;
+        const FastBitVector& range = ranges[temporary];
+        if (!range.numBits()) {
+            if (pinned.get(numVars + temporary))
+                usedLocals = std::max(usedLocals, numVars + temporary + 1);
+            continue;
+        }
+        for (unsigned candidate = 0; candidate <= temporary; ++candidate) {
+            if (pinned.get(numVars + candidate))
+                continue;
+            FastBitVector& assigned = assignedRanges[candidate];
+            if (!assigned.numBits())
+                assigned.resize(instructionOffsets.size());
+            else if (rangesOverlap(scratch, assigned, range))
+                continue;
+            assigned.merge(range);
+            newTemporaryIndex[temporary] = candidate;
+            changed |= candidate != temporary;
+            usedLocals = std::max(usedLocals, numVars + candidate + 1);
+            break;
+        }
+    }
+
+    unsigned newNumLocals = WTF::roundUpToMultipleOf(stackAlignmentRegisters(), usedLocals);
+    if (!changed && newNumLocals >= numLocals)
+        return;
+
+    if (changed) {
+        for (unsigned index = 0; index < instructionOffsets.size(); ++index) {
+            unsigned bytecodeOffset = instructionOffsets[index];
+            Instruction* instruction = instructionsBegin + bytecodeOffset;
+            OpcodeID opcodeID = interpreter->getOpcodeID(instruction->u.opcode);
+            size_t length = opcodeLength(opcodeID);
+
+            OperandCollector operands(instruction, length);
+            computeUsesForBytecodeOffset(codeBlock, bytecodeOffset, operands);
+            computeDefsForBytecodeOffset(codeBlock, bytecodeOffset, operands);
+            for (size_t i = 0; i < operands.slots().size(); ++i) {
+                int& operand = instruction[operands.slots()[i]].u.operand;
+                VirtualRegister reg(operand);
+                if (!reg.isLocal())
+                    continue;
+                unsigned local = reg.toLocal();
+                if (local < numVars || local >= numLocals || pinned.get(local))
+                    continue;
+                operand = virtualRegisterForLocal(numVars + newTemporaryIndex[local - numVars]).offset();
+            }
+        }
+    }
+
+    if (newNumLocals < numLocals)
+        codeBlock->m_numCalleeRegisters = newNumLocals;
+}
+
+} // namespace JSC
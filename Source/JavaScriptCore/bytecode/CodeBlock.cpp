@@ -31,6 +31,7 @@
 #include "CodeBlock.h"
 
 #include "BytecodeGenerator.h"
+#include "BytecodeTemporaryCoalescing.h"
 #include "BytecodeUseDef.h"
 #include "CallLinkStatus.h"
 #include "DFGCapabilities.h"
@@ -1811,6 +1812,9 @@ CodeBlock::CodeBlock(ScriptExecutable* ownerExecutable, UnlinkedCodeBlock* unlin
     }
     m_instructions = WTF::RefCountedArray<Instruction>(instructions);
 
+    if (Options::coalesceBytecodeTemporaries())
+        coalesceBytecodeTemporaries(this);
+
     // Set optimization thresholds only after m_instructions is initialized, since these
     // rely on the instruction count (and are in theory permitted to also inspect the
     // instruction stream to more accurate assess the cost of tier-up).
@@ -2727,7 +2731,7 @@ void CodeBlock::jettison(Profiler::JettisonReason reason, ReoptimizationMode mod
     RELEASE_ASSERT(reason != Profiler::NotJettisoned);
     
 #if ENABLE(DFG_JIT)
-    if (DFG::shouldShowDisassembly()) {
+    if (DFG::shouldShowDisassembly() || Options::logJettisons()) {
         dataLog("Jettisoning ", *this);
         if (mode == CountReoptimization)
             dataLog(" and counting reoptimization");
@@ -3249,6 +3253,9 @@ void CodeBlock::tallyFrequentExitSites()
         for (unsigned i = 0; i < jitCode->osrExit.size(); ++i) {
             DFG::OSRExit& exit = jitCode->osrExit[i];
             
+            if (Options::logJettisons() && exit.m_count)
+                dataLog("    ", exit.m_kind, " exit at ", exit.m_codeOrigin, " taken ", exit.m_count, " times.\n");
+            
             if (!exit.considerAddingAsFrequentExitSite(profiledBlock))
                 continue;
         }
@@ -3264,6 +3271,9 @@ void CodeBlock::tallyFrequentExitSites()
         for (unsigned i = 0; i < jitCode->osrExit.size(); ++i) {
             FTL::OSRExit& exit = jitCode->osrExit[i];
             
+            if (Options::logJettisons() && exit.m_count)
+                dataLog("    ", exit.m_kind, " exit at ", exit.m_codeOrigin, " taken ", exit.m_count, " times.\n");
+            
             if (!exit.considerAddingAsFrequentExitSite(profiledBlock))
                 continue;
         }
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "config.h"
+#include "MegamorphicAccessProfile.h"
+
+#if ENABLE(JIT)
+
+namespace JSC {
+
+// Sites for common property names like "length" can see a lot of unrelated
+// Structures. Past this many, the set stops growing.
+static const int maxStructuresPerPropertyName = 64;
+
+void MegamorphicAccessProfile::didOverflow(AccessKind kind, StringImpl* uid, const StructureList& structures)
+{
+    HashSet<Structure*>& set = sitesFor(kind).add(uid, HashSet<Structure*>()).iterator->value;
+    for (unsigned i = 0; i < structures.size() && set.size() < maxStructuresPerPropertyName; ++i)
+        set.add(structures[i]);
+}
+
+bool MegamorphicAccessProfile::isKnownMegamorphic(AccessKind kind, StringImpl* uid, const StructureList& structures) const
+{
+    const SiteMap& sites = sitesFor(kind);
+    SiteMap::const_iterator iter = sites.find(uid);
+    if (iter == sites.end())
+        return false;
+
+    for (unsigned i = 0; i < structures.size(); ++i) {
+        if (!iter->value.contains(structures[i]))
+            return false;
+    }
+    return true;
+}
+
+void MegamorphicAccessProfile::clear()
+{
+    m_getByIdSites.clear();
+    m_putByIdSites.clear();
+}
+
+} // namespace JSC
+
+#endif // ENABLE(JIT)
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef MegamorphicAccessProfile_h
+#define MegamorphicAccessProfile_h
+
+#if ENABLE(JIT)
+
+#include "PolymorphicAccessStructureList.h"
+#include <wtf/HashMap.h>
+#include <wtf/HashSet.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/RefPtr.h>
+#include <wtf/Vector.h>
+#include <wtf/text/StringImpl.h>
+
+namespace JSC {
+
+class Structure;
+
+// Remembers, per property name, which Structures were seen at get_by_id and
+// put_by_id sites whose polymorphic stub lists overflowed. Framework code tends
+// to repeat the same megamorphic access in many functions; once one copy of it
+// has given up on stubs, any other site that has only seen Structures from the
+// same set is assumed to be headed the same way, and goes generic after half
+// as many stubs.
+//
+// Structures are compared by address, so a dead Structure whose memory gets
+// reused can cause a false match. That only costs an early switch to the
+// generic path; the profile is also cleared on every full collection to keep
+// such matches rare.
+class MegamorphicAccessProfile {
+    WTF_MAKE_NONCOPYABLE(MegamorphicAccessProfile);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    enum AccessKind { GetById, PutById };
+    typedef Vector<Structure*, POLYMORPHIC_LIST_CACHE_SIZE> StructureList;
+
+    MegamorphicAccessProfile() { }
+
+    void didOverflow(AccessKind, StringImpl* uid, const StructureList&);
+    bool isKnownMegamorphic(AccessKind, StringImpl* uid, const StructureList&) const;
+
+    void clear();
+
+private:
+    typedef HashMap<RefPtr<StringImpl>, HashSet<Structure*>> SiteMap;
+
+    SiteMap& sitesFor(AccessKind kind) { return kind == GetById ? m_getByIdSites : m_putByIdSites; }
+    const SiteMap& sitesFor(AccessKind kind) const { return kind == GetById ? m_getByIdSites : m_putByIdSites; }
+
+    SiteMap m_getByIdSites;
+    SiteMap m_putByIdSites;
+};
+
+} // namespace JSC
+
+#endif // ENABLE(JIT)
+
+#endif // MegamorphicAccessProfile_h
@@ -105,6 +105,26 @@ UnlinkedFunctionExecutable::UnlinkedFunctionExecutable(VM* vm, Structure* struct
 {
 }
 
+UnlinkedFunctionExecutable::UnlinkedFunctionExecutable(VM* vm, Structure* structure)
+    : Base(*vm, structure)
+    , m_numCapturedVariables(0)
+    , m_forceUsesArguments(false)
+    , m_isInStrictContext(false)
+    , m_hasCapturedVariables(false)
+    , m_isFromGlobalCode(false)
+    , m_isBuiltinFunction(false)
+    , m_firstLineOffset(0)
+    , m_lineCount(0)
+    , m_unlinkedFunctionNameStart(0)
+    , m_unlinkedBodyStartColumn(0)
+    , m_unlinkedBodyEndColumn(0)
+    , m_startOffset(0)
+    , m_sourceLength(0)
+    , m_features(0)
+    , m_functionMode(FunctionExpression)
+{
+}
+
 size_t UnlinkedFunctionExecutable::parameterCount() const
 {
     return m_parameters->size();
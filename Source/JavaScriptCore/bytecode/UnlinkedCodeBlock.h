@@ -90,6 +90,8 @@ class UnlinkedFunctionExecutable : public JSCell {
 public:
     friend class BuiltinExecutables;
     friend class CodeCache;
+    friend class PersistentCodeCacheDecoder;
+    friend class PersistentCodeCacheEncoder;
     friend class VM;
     typedef JSCell Base;
     static UnlinkedFunctionExecutable* create(VM* vm, const SourceCode& source, FunctionBodyNode* node, bool isFromGlobalCode, UnlinkedFunctionKind unlinkedFunctionKind)
@@ -163,6 +165,8 @@ public:
 
 private:
     UnlinkedFunctionExecutable(VM*, Structure*, const SourceCode&, FunctionBodyNode*, bool isFromGlobalCode, UnlinkedFunctionKind);
+    // Used by PersistentCodeCacheDecoder, which fills in the fields itself.
+    UnlinkedFunctionExecutable(VM*, Structure*);
     WriteBarrier<UnlinkedFunctionCodeBlock> m_codeBlockForCall;
     WriteBarrier<UnlinkedFunctionCodeBlock> m_codeBlockForConstruct;
 
@@ -258,6 +262,8 @@ struct UnlinkedInstruction {
 
 class UnlinkedCodeBlock : public JSCell {
 public:
+    friend class PersistentCodeCacheDecoder;
+    friend class PersistentCodeCacheEncoder;
     typedef JSCell Base;
     static const bool needsDestruction = true;
     static const bool hasImmortalStructure = true;
@@ -604,6 +610,8 @@ protected:
 class UnlinkedProgramCodeBlock : public UnlinkedGlobalCodeBlock {
 private:
     friend class CodeCache;
+    friend class PersistentCodeCacheDecoder;
+    friend class PersistentCodeCacheEncoder;
     static UnlinkedProgramCodeBlock* create(VM* vm, const ExecutableInfo& info)
     {
         UnlinkedProgramCodeBlock* instance = new (NotNull, allocateCell<UnlinkedProgramCodeBlock>(vm->heap)) UnlinkedProgramCodeBlock(vm, vm->unlinkedProgramCodeBlockStructure.get(), info);
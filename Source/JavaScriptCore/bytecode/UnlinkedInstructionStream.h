@@ -60,8 +60,16 @@ public:
 #endif
 
 private:
+    friend class PersistentCodeCacheDecoder;
+    friend class PersistentCodeCacheEncoder;
     friend class Reader;
 
+    UnlinkedInstructionStream(const RefCountedArray<unsigned char>& data, unsigned instructionCount)
+        : m_data(data)
+        , m_instructionCount(instructionCount)
+    {
+    }
+
 #ifndef NDEBUG
     mutable RefCountedArray<UnlinkedInstruction> m_unpackedInstructionsForDebugging;
 #endif
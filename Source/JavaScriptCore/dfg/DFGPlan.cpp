@@ -125,6 +125,7 @@ Plan::Plan(PassRefPtr<CodeBlock> passedCodeBlock, CodeBlock* profiledDFGCodeBloc
     , weakReferences(codeBlock.get())
     , willTryToTierUp(false)
     , isCompiled(false)
+    , isCancelled(false)
 {
 }
 
@@ -392,7 +393,7 @@ void Plan::notifyReady()
 
 CompilationResult Plan::finalizeWithoutNotifyingCallback()
 {
-    if (!isStillValid())
+    if (isCancelled || !isStillValid())
         return CompilationInvalidated;
 
     bool result;
@@ -98,6 +98,10 @@ struct Plan : public ThreadSafeRefCounted<Plan> {
     double beforeFTL;
     
     bool isCompiled;
+    
+    // Set if the worklist dropped the plan before compiling it, because the
+    // code it was going to replace got jettisoned.
+    bool isCancelled;
 
     RefPtr<DeferredCompilationCallback> callback;
 
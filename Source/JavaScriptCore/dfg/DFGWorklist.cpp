@@ -258,6 +258,108 @@ void Worklist::dump(const MutexLocker&, PrintStream& out) const
         ", Num Active Threads = ", m_numberOfActiveThreads, "/", m_threads.size(), "]");
 }
 
+// Plans for lower tiers always come first, since they are what gets a program
+// running reasonably fast. OSR entry plans come before ordinary FTL plans,
+// because they exist to get a running loop into faster code.
+static unsigned tierPriority(CompilationMode mode)
+{
+    switch (mode) {
+    case InvalidCompilationMode:
+        RELEASE_ASSERT_NOT_REACHED();
+        return 0;
+    case DFGMode:
+        return 2;
+    case FTLForOSREntryMode:
+        return 1;
+    case FTLMode:
+        return 0;
+    }
+    RELEASE_ASSERT_NOT_REACHED();
+    return 0;
+}
+
+// How hot the code that triggered the plan is. This reads execution counters
+// that the main thread keeps updating, so it is only an estimate, which is all
+// that ordering the queue needs.
+static double hotness(Plan& plan)
+{
+#if ENABLE(FTL_JIT)
+    if (plan.profiledDFGCodeBlock)
+        return plan.profiledDFGCodeBlock->jitCode()->dfg()->tierUpCounter.count();
+#endif
+    return plan.codeBlock->alternative()->jitExecuteCounter().count();
+}
+
+// The FTL compiles from the profiling of a DFG CodeBlock. If that CodeBlock
+// has been jettisoned, the result would be dropped on the floor anyway.
+static bool isCompilingForJettisonedCode(Plan& plan)
+{
+    return plan.profiledDFGCodeBlock
+        && !plan.profiledDFGCodeBlock->jitCode()->dfgCommon()->isStillValid;
+}
+
+RefPtr<Plan> Worklist::waitForNextPlan(const MutexLocker& locker)
+{
+    for (;;) {
+        while (m_queue.isEmpty())
+            m_planEnqueued.wait(m_lock);
+        
+        size_t bestIndex = notFound;
+        unsigned bestTierPriority = 0;
+        double bestHotness = 0;
+        bool didCancel = false;
+        
+        for (size_t i = 0; i < m_queue.size(); ++i) {
+            Plan* plan = m_queue[i].get();
+            if (!plan)
+                continue;
+            
+            if (isCompilingForJettisonedCode(*plan)) {
+                if (Options::verboseCompilationQueue()) {
+                    dump(locker, WTF::dataFile());
+                    dataLog(": Cancelling ", plan->key(), "\n");
+                }
+                plan->isCancelled = true;
+                plan->notifyReady();
+                m_readyPlans.append(plan);
+                m_queue.remove(i--);
+                didCancel = true;
+                continue;
+            }
+            
+            unsigned planTierPriority = tierPriority(plan->mode);
+            double planHotness = hotness(*plan);
+            if (bestIndex == notFound
+                || planTierPriority > bestTierPriority
+                || (planTierPriority == bestTierPriority && planHotness > bestHotness)) {
+                bestIndex = i;
+                bestTierPriority = planTierPriority;
+                bestHotness = planHotness;
+            }
+        }
+        
+        if (didCancel)
+            m_planCompiled.broadcast();
+        
+        if (bestIndex != notFound) {
+            RefPtr<Plan> result = m_queue[bestIndex].release();
+            m_queue.remove(bestIndex);
+            return result;
+        }
+        
+        // A null plan asks a thread to shut down. It is only honored once there
+        // is no other work left.
+        for (size_t i = 0; i < m_queue.size(); ++i) {
+            if (!m_queue[i]) {
+                m_queue.remove(i);
+                return nullptr;
+            }
+        }
+        
+        // Everything that was queued got cancelled.
+    }
+}
+
 void Worklist::runThread(ThreadData* data)
 {
     CompilationScope compilationScope;
@@ -271,10 +373,7 @@ void Worklist::runThread(ThreadData* data)
         RefPtr<Plan> plan;
         {
             MutexLocker locker(m_lock);
-            while (m_queue.isEmpty())
-                m_planEnqueued.wait(m_lock);
-            
-            plan = m_queue.takeFirst();
+            plan = waitForNextPlan(locker);
             if (plan)
                 m_numberOfActiveThreads++;
         }
@@ -30,7 +30,6 @@
 
 #include "DFGPlan.h"
 #include "DFGThreadData.h"
-#include <wtf/Deque.h>
 #include <wtf/HashMap.h>
 #include <wtf/Noncopyable.h>
 #include <wtf/PassOwnPtr.h>
@@ -83,11 +82,17 @@ private:
     static void threadFunction(void* argument);
     
     void removeAllReadyPlansForVM(VM&, Vector<RefPtr<Plan>, 8>&);
+    
+    // Waits for and returns the queued plan that should be compiled next, or
+    // null if the thread should shut down. Along the way, queued plans that
+    // are no longer worth compiling are cancelled and handed back as ready.
+    RefPtr<Plan> waitForNextPlan(const MutexLocker&);
 
     void dump(const MutexLocker&, PrintStream&) const;
 
-    // Used to inform the thread about what work there is left to do.
-    Deque<RefPtr<Plan>> m_queue;
+    // Used to inform the thread about what work there is left to do. This isn't
+    // kept in any order; waitForNextPlan() picks the plan with the highest priority.
+    Vector<RefPtr<Plan>> m_queue;
     
     // Used to answer questions about the current state of a code block. This
     // is particularly great for the cti_optimize OSR slow path, which wants
@@ -132,6 +132,17 @@ void CodeBlockSet::remove(CodeBlock* codeBlock)
     m_newCodeBlocks.remove(codeBlock);
 }
 
+bool CodeBlockSet::contains(void* candidateCodeBlock)
+{
+    // 0 and -1 are the HashSet's empty and deleted values.
+    uintptr_t value = reinterpret_cast<uintptr_t>(candidateCodeBlock);
+    if (value + 1 <= 1)
+        return false;
+
+    CodeBlock* codeBlock = static_cast<CodeBlock*>(candidateCodeBlock);
+    return m_oldCodeBlocks.contains(codeBlock) || m_newCodeBlocks.contains(codeBlock);
+}
+
 void CodeBlockSet::traceMarked(SlotVisitor& visitor)
 {
     if (verbose)
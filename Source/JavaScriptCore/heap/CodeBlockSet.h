@@ -71,6 +71,10 @@ public:
     void deleteUnmarkedAndUnreferenced(HeapOperation);
     
     void remove(CodeBlock*);
+
+    // Checks whether a pointer that may be a CodeBlock, for example one read
+    // off a stack, is a live CodeBlock in this set.
+    bool contains(void* candidateCodeBlock);
     
     // Trace all marked code blocks. The CodeBlock is free to make use of
     // mayBeExecuting.
@@ -224,6 +224,34 @@ void CopiedSpace::didStartFullCollection()
         block->didSurviveGC();
 }
 
+#if ENABLE(GGC)
+void CopiedSpace::didStartIncrementalMarking()
+{
+    ASSERT(heap()->operationInProgress() == FullCollection);
+
+    // An object that has already been visited doesn't report a backing store that the mutator
+    // gives it later on, so we make sure that everything allocated while marking ends up in
+    // blocks of its own. didFinishIncrementalMarking() then pins all of those blocks.
+    m_oldGen.toSpace->append(*m_newGen.toSpace);
+    m_oldGen.oversizeBlocks.append(m_newGen.oversizeBlocks);
+    m_oldGen.blockFilter.add(m_newGen.blockFilter);
+    m_newGen.blockFilter.reset();
+
+    allocateBlock();
+}
+
+void CopiedSpace::didFinishIncrementalMarking()
+{
+    ASSERT(heap()->operationInProgress() == FullCollection);
+
+    for (CopiedBlock* block = m_newGen.toSpace->head(); block; block = block->next())
+        pin(block);
+
+    for (CopiedBlock* block = m_newGen.oversizeBlocks.head(); block; block = block->next())
+        pin(block);
+}
+#endif // ENABLE(GGC)
+
 void CopiedSpace::doneCopying()
 {
     {
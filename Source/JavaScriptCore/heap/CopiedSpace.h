@@ -62,6 +62,10 @@ public:
     CopiedAllocator& allocator() { return m_allocator; }
 
     void didStartFullCollection();
+#if ENABLE(GGC)
+    void didStartIncrementalMarking();
+    void didFinishIncrementalMarking();
+#endif
 
     template <HeapOperation collectionType>
     void startedCopying();
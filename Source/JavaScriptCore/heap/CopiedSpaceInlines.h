@@ -212,6 +212,7 @@ inline void CopiedSpace::startedCopying()
     CopiedBlock* next = 0;
     size_t totalLiveBytes = 0;
     size_t totalUsableBytes = 0;
+    bool hasBlocksToEvacuate = false;
     for (CopiedBlock* block = fromSpace->head(); block; block = next) {
         next = block->next();
         if (!block->isPinned() && block->canBeRecycled()) {
@@ -221,6 +222,8 @@ inline void CopiedSpace::startedCopying()
         ASSERT(block->liveBytes() <= CopiedBlock::blockSize);
         totalLiveBytes += block->liveBytes();
         totalUsableBytes += block->payloadCapacity();
+        if (!block->isPinned() && block->hasWorkList())
+            hasBlocksToEvacuate = true;
         block->didPromote();
     }
 
@@ -242,7 +245,10 @@ inline void CopiedSpace::startedCopying()
 
     double markedSpaceBytes = m_heap->objectSpace().capacity();
     double totalFragmentation = static_cast<double>(totalLiveBytes + markedSpaceBytes) / static_cast<double>(totalUsableBytes + markedSpaceBytes);
-    m_shouldDoCopyPhase = m_heap->operationInProgress() == EdenCollection || totalFragmentation <= Options::minHeapUtilization();
+    // Survivors in blocks that were pinned or were too full to evacuate are promoted
+    // in place, so if no block has anything to evacuate, there is no copying to do.
+    m_shouldDoCopyPhase = hasBlocksToEvacuate
+        && (m_heap->operationInProgress() == EdenCollection || totalFragmentation <= Options::minHeapUtilization());
     if (!m_shouldDoCopyPhase) {
         if (Options::logGC())
             dataLog("Skipped copying, ");
@@ -111,4 +111,16 @@ void GCLogging::dumpObjectGraph(Heap* heap)
     loggingFunctor.log();
 }
 
+void GCLogging::dumpWeakHandleFinalizationCounts(Heap* heap)
+{
+    WeakHandleOwnerCounts& counts = heap->m_weakHandleFinalizationCounts;
+    if (counts.isEmpty())
+        return;
+
+    dataLog("Weak handles finalized since last collection:\n");
+    for (auto& entry : counts)
+        dataLog("    owner ", RawPointer(entry.key), ": ", entry.value, "\n");
+    counts.clear();
+}
+
 } // namespace JSC
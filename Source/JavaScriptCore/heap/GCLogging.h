@@ -27,10 +27,12 @@
 #define GCLogging_h
 
 #include <wtf/Assertions.h>
+#include <wtf/HashMap.h>
 
 namespace JSC {
 
 class Heap;
+class WeakHandleOwner;
 
 class GCLogging {
 public:
@@ -40,8 +42,13 @@ public:
         Verbose
     };
 
+    // Number of weak handles finalized per owner, gathered while sweeping
+    // weak sets when verbose logging is enabled.
+    typedef HashMap<WeakHandleOwner*, size_t> WeakHandleOwnerCounts;
+
     static const char* levelAsString(Level);
     static void dumpObjectGraph(Heap*);
+    static void dumpWeakHandleFinalizationCounts(Heap*);
 };
 
 typedef GCLogging::Level gcLogLevel;
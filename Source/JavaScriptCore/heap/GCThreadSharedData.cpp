@@ -67,6 +67,22 @@ size_t GCThreadSharedData::childBytesCopied()
         result += m_gcThreads[i]->slotVisitor()->bytesCopied();
     return result;
 }
+
+size_t GCThreadSharedData::childStealCount()
+{
+    size_t result = 0;
+    for (unsigned i = 0; i < m_gcThreads.size(); ++i)
+        result += m_gcThreads[i]->slotVisitor()->stealCount();
+    return result;
+}
+
+double GCThreadSharedData::childIdleTime()
+{
+    double result = 0;
+    for (unsigned i = 0; i < m_gcThreads.size(); ++i)
+        result += m_gcThreads[i]->slotVisitor()->idleTime();
+    return result;
+}
 #endif
 
 GCThreadSharedData::GCThreadSharedData(VM* vm)
@@ -67,6 +67,8 @@ public:
     size_t childVisitCount();
     size_t childBytesVisited();
     size_t childBytesCopied();
+    size_t childStealCount();
+    double childIdleTime();
     size_t childDupStrings();
 #endif
     
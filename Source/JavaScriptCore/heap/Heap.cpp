@@ -40,9 +40,12 @@
 #include "JSGlobalObject.h"
 #include "JSLock.h"
 #include "JSONObject.h"
+#include "JSONStringifyCache.h"
 #include "JSCInlines.h"
 #include "JSVirtualMachineInternal.h"
+#include "MegamorphicAccessProfile.h"
 #include "RecursiveAllocationScope.h"
+#include "SamplingProfiler.h"
 #include "Tracing.h"
 #include "UnlinkedCodeBlock.h"
 #include "VM.h"
@@ -306,6 +309,8 @@ Heap::Heap(VM* vm, HeapType heapType)
     , m_totalBytesVisited(0)
     , m_totalBytesCopied(0)
     , m_operationInProgress(NoOperation)
+    , m_incrementalMarkingState(NotMarkingIncrementally)
+    , m_incrementalMarkingAllocationLimit(0)
     , m_blockAllocator()
     , m_objectSpace(this)
     , m_storageSpace(this)
@@ -323,6 +328,7 @@ Heap::Heap(VM* vm, HeapType heapType)
     // schedule the timer if we've never done a collection.
     , m_lastFullGCLength(0.01)
     , m_lastEdenGCLength(0.01)
+    , m_totalGCTime(0)
     , m_lastCodeDiscardTime(WTF::monotonicallyIncreasingTime())
     , m_fullActivityCallback(GCActivityCallback::createFullTimer(this))
 #if ENABLE(GGC)
@@ -352,6 +358,9 @@ void Heap::lastChanceToFinalize()
     RELEASE_ASSERT(!m_vm->entryScope);
     RELEASE_ASSERT(m_operationInProgress == NoOperation);
 
+    if (m_incrementalMarkingState != NotMarkingIncrementally)
+        abandonIncrementalMarking();
+
     m_objectSpace.lastChanceToFinalize();
 }
 
@@ -512,18 +521,7 @@ void Heap::markRoots(double gcStartTime)
 
     {
         ParallelModeEnabler enabler(m_slotVisitor);
-
-        visitExternalRememberedSet();
-        visitSmallStrings();
-        visitConservativeRoots(conservativeRoots);
-        visitCompilerWorklists();
-        visitProtectedObjects(heapRootVisitor);
-        visitTempSortVectors(heapRootVisitor);
-        visitArgumentBuffers(heapRootVisitor);
-        visitException(heapRootVisitor);
-        visitStrongHandles(heapRootVisitor);
-        visitHandleStack(heapRootVisitor);
-        traceCodeBlocksAndJITStubRoutines();
+        visitRoots(conservativeRoots, heapRootVisitor);
         converge();
     }
 
@@ -537,6 +535,30 @@ void Heap::markRoots(double gcStartTime)
     resetVisitors();
 }
 
+void Heap::visitRoots(ConservativeRoots& conservativeRoots, HeapRootVisitor& heapRootVisitor)
+{
+    visitExternalRememberedSet();
+    visitSmallStrings();
+    visitConservativeRoots(conservativeRoots);
+    visitCompilerWorklists();
+    visitProtectedObjects(heapRootVisitor);
+    visitTempSortVectors(heapRootVisitor);
+    visitArgumentBuffers(heapRootVisitor);
+    visitException(heapRootVisitor);
+    visitStrongHandles(heapRootVisitor);
+    visitHandleStack(heapRootVisitor);
+    traceCodeBlocksAndJITStubRoutines();
+}
+
+void Heap::donateAndDrainRoots()
+{
+    // When starting an incremental marking cycle we just push the roots and let the mutator
+    // get going again. The marking slices will drain the mark stack from there.
+    if (m_incrementalMarkingState == StartingIncrementalMarking)
+        return;
+    m_slotVisitor.donateAndDrain();
+}
+
 void Heap::copyBackingStores()
 {
     if (m_operationInProgress == EdenCollection)
@@ -608,7 +630,7 @@ void Heap::visitSmallStrings()
     if (Options::logGC() == GCLogging::Verbose)
         dataLog("Small strings:\n", m_slotVisitor);
 
-    m_slotVisitor.donateAndDrain();
+    donateAndDrainRoots();
 }
 
 void Heap::visitConservativeRoots(ConservativeRoots& roots)
@@ -619,7 +641,7 @@ void Heap::visitConservativeRoots(ConservativeRoots& roots)
     if (Options::logGC() == GCLogging::Verbose)
         dataLog("Conservative Roots:\n", m_slotVisitor);
 
-    m_slotVisitor.donateAndDrain();
+    donateAndDrainRoots();
 }
 
 void Heap::visitCompilerWorklists()
@@ -634,7 +656,7 @@ void Heap::visitCompilerWorklists()
     if (Options::logGC() == GCLogging::Verbose)
         dataLog("DFG Worklists:\n", m_slotVisitor);
 
-    m_slotVisitor.donateAndDrain();
+    donateAndDrainRoots();
 #endif
 }
 
@@ -648,7 +670,7 @@ void Heap::visitProtectedObjects(HeapRootVisitor& heapRootVisitor)
     if (Options::logGC() == GCLogging::Verbose)
         dataLog("Protected Objects:\n", m_slotVisitor);
 
-    m_slotVisitor.donateAndDrain();
+    donateAndDrainRoots();
 }
 
 void Heap::visitTempSortVectors(HeapRootVisitor& heapRootVisitor)
@@ -666,7 +688,7 @@ void Heap::visitTempSortVectors(HeapRootVisitor& heapRootVisitor)
     if (Options::logGC() == GCLogging::Verbose)
         dataLog("Temp Sort Vectors:\n", m_slotVisitor);
 
-    m_slotVisitor.donateAndDrain();
+    donateAndDrainRoots();
 }
 
 void Heap::visitArgumentBuffers(HeapRootVisitor& visitor)
@@ -680,7 +702,7 @@ void Heap::visitArgumentBuffers(HeapRootVisitor& visitor)
     if (Options::logGC() == GCLogging::Verbose)
         dataLog("Argument Buffers:\n", m_slotVisitor);
 
-    m_slotVisitor.donateAndDrain();
+    donateAndDrainRoots();
 }
 
 void Heap::visitException(HeapRootVisitor& visitor)
@@ -694,7 +716,7 @@ void Heap::visitException(HeapRootVisitor& visitor)
     if (Options::logGC() == GCLogging::Verbose)
         dataLog("Exceptions:\n", m_slotVisitor);
 
-    m_slotVisitor.donateAndDrain();
+    donateAndDrainRoots();
 }
 
 void Heap::visitStrongHandles(HeapRootVisitor& visitor)
@@ -705,7 +727,7 @@ void Heap::visitStrongHandles(HeapRootVisitor& visitor)
     if (Options::logGC() == GCLogging::Verbose)
         dataLog("Strong Handles:\n", m_slotVisitor);
 
-    m_slotVisitor.donateAndDrain();
+    donateAndDrainRoots();
 }
 
 void Heap::visitHandleStack(HeapRootVisitor& visitor)
@@ -716,7 +738,7 @@ void Heap::visitHandleStack(HeapRootVisitor& visitor)
     if (Options::logGC() == GCLogging::Verbose)
         dataLog("Handle Stack:\n", m_slotVisitor);
 
-    m_slotVisitor.donateAndDrain();
+    donateAndDrainRoots();
 }
 
 void Heap::traceCodeBlocksAndJITStubRoutines()
@@ -728,7 +750,7 @@ void Heap::traceCodeBlocksAndJITStubRoutines()
     if (Options::logGC() == GCLogging::Verbose)
         dataLog("Code Blocks and JIT Stub Routines:\n", m_slotVisitor);
 
-    m_slotVisitor.donateAndDrain();
+    donateAndDrainRoots();
 }
 
 void Heap::converge()
@@ -784,6 +806,15 @@ void Heap::updateObjectCounts(double gcStartTime)
         visitCount += m_sharedData.childVisitCount();
 #endif
         dataLogF("\nNumber of live Objects after GC %lu, took %.6f secs\n", static_cast<unsigned long>(visitCount), WTF::monotonicallyIncreasingTime() - gcStartTime);
+        if (Options::useWorkStealingMarkStack()) {
+            size_t stealCount = m_slotVisitor.stealCount();
+            double idleTime = m_slotVisitor.idleTime();
+#if ENABLE(PARALLEL_GC)
+            stealCount += m_sharedData.childStealCount();
+            idleTime += m_sharedData.childIdleTime();
+#endif
+            dataLogF("Markers stole %lu cells and were idle for %.6f secs\n", static_cast<unsigned long>(stealCount), idleTime);
+        }
     }
 
     if (m_operationInProgress == EdenCollection) {
@@ -896,6 +927,8 @@ void Heap::deleteAllCompiledCode()
     }
 
     ASSERT(m_operationInProgress == FullCollection || m_operationInProgress == NoOperation);
+    if (SamplingProfiler* samplingProfiler = m_vm->samplingProfiler())
+        samplingProfiler->processUnverifiedStackTraces();
     m_codeBlocks.clearMarksForFullCollection();
     m_codeBlocks.deleteUnmarkedAndUnreferenced(FullCollection);
 }
@@ -929,6 +962,9 @@ void Heap::deleteUnmarkedCompiledCode()
 {
     GCPHASE(DeleteCodeBlocks);
     clearUnmarkedExecutables();
+    // Samples may name CodeBlocks that are about to be deleted.
+    if (SamplingProfiler* samplingProfiler = m_vm->samplingProfiler())
+        samplingProfiler->processUnverifiedStackTraces();
     m_codeBlocks.deleteUnmarkedAndUnreferenced(m_operationInProgress);
     m_jitStubRoutines.deleteUnmarkedJettisonedStubRoutines();
 }
@@ -942,6 +978,11 @@ void Heap::addToRememberedSet(const JSCell* cell)
     MarkedBlock::blockFor(cell)->setRemembered(cell);
     const_cast<JSCell*>(cell)->setRemembered(true);
     m_slotVisitor.unconditionallyAppend(const_cast<JSCell*>(cell));
+
+    // Cells that are written to after being visited get visited again during the final
+    // remark, so that stores made after a revisit from one of the marking slices are not lost.
+    if (m_incrementalMarkingState == MarkingIncrementally)
+        m_incrementalRememberedSet.append(cell);
 }
 
 void Heap::collectAllGarbage()
@@ -977,21 +1018,41 @@ void Heap::collect(HeapOperation collectionType)
     ASSERT(vm()->currentThreadIsHoldingAPILock());
     RELEASE_ASSERT(vm()->atomicStringTable() == wtfThreadData().atomicStringTable());
     ASSERT(m_isSafeToCollect);
-    JAVASCRIPTCORE_GC_BEGIN();
     RELEASE_ASSERT(m_operationInProgress == NoOperation);
 
+    if (shouldStartIncrementalMarking(collectionType)) {
+        startIncrementalMarking();
+        if (Options::logGC()) {
+            double after = currentTimeMS();
+            dataLog(after - before, " ms]\n");
+        }
+        return;
+    }
+
+    JAVASCRIPTCORE_GC_BEGIN();
+
     suspendCompilerThreads();
-    willStartCollection(collectionType);
+    bool isFinishingIncrementalMarking = m_incrementalMarkingState == MarkingIncrementally;
+    if (isFinishingIncrementalMarking) {
+        m_operationInProgress = FullCollection;
+        if (Options::logGC())
+            dataLog("FinishIncrementalMarking, ");
+    } else
+        willStartCollection(collectionType);
     GCPHASE(Collect);
 
     double gcStartTime = WTF::monotonicallyIncreasingTime();
 
-    deleteOldCode(gcStartTime);
-    flushOldStructureIDTables();
-    stopAllocation();
-    flushWriteBarrierBuffer();
+    if (isFinishingIncrementalMarking)
+        finishIncrementalMarking(gcStartTime);
+    else {
+        deleteOldCode(gcStartTime);
+        flushOldStructureIDTables();
+        stopAllocation();
+        flushWriteBarrierBuffer();
 
-    markRoots(gcStartTime);
+        markRoots(gcStartTime);
+    }
 
     JAVASCRIPTCORE_GC_MARKED();
 
@@ -1018,6 +1079,174 @@ void Heap::collect(HeapOperation collectionType)
     }
 }
 
+bool Heap::shouldStartIncrementalMarking(HeapOperation requestedCollectionType) const
+{
+#if ENABLE(GGC)
+    // Explicit requests for a full collection expect all garbage to be gone when they return,
+    // so only collections that the heap decides to do on its own get to mark incrementally.
+    if (!Options::useIncrementalMarking() || requestedCollectionType != AnyCollection)
+        return false;
+    if (m_incrementalMarkingState != NotMarkingIncrementally)
+        return false;
+    return shouldDoFullCollection(requestedCollectionType);
+#else
+    UNUSED_PARAM(requestedCollectionType);
+    return false;
+#endif
+}
+
+void Heap::startIncrementalMarking()
+{
+#if ENABLE(GGC)
+    SamplingRegion samplingRegion("Garbage Collection: Incremental Marking");
+
+    suspendCompilerThreads();
+    willStartCollection(FullCollection);
+    GCPHASE(StartIncrementalMarking);
+    ASSERT(m_operationInProgress == FullCollection);
+    if (Options::logGC())
+        dataLog("StartIncrementalMarking, ");
+
+    double gcStartTime = WTF::monotonicallyIncreasingTime();
+
+    deleteOldCode(gcStartTime);
+    flushOldStructureIDTables();
+    stopAllocation();
+    flushWriteBarrierBuffer();
+
+    // Everything is going to be traced again, so there is no need to revisit the cells that
+    // were remembered since the last collection. Their remembered bits get reset along with
+    // the rest of the mark state below.
+    m_slotVisitor.clearMarkStack();
+    m_codeBlocks.clearMarksForFullCollection();
+
+    void* dummy;
+    ConservativeRoots conservativeRoots(&m_objectSpace.blocks(), &m_storageSpace);
+    gatherStackRoots(conservativeRoots, &dummy);
+    gatherJSStackRoots(conservativeRoots);
+    gatherScratchBufferRoots(conservativeRoots);
+
+    sanitizeStackForVM(m_vm);
+
+    m_sweeper->willFinishSweeping();
+    m_objectSpace.didStartIncrementalMarking();
+    m_storageSpace.didStartIncrementalMarking();
+
+    m_incrementalMarkingState = StartingIncrementalMarking;
+    m_sharedData.didStartMarking();
+    m_slotVisitor.didStartMarking();
+    HeapRootVisitor heapRootVisitor(m_slotVisitor);
+    visitRoots(conservativeRoots, heapRootVisitor);
+
+    m_incrementalMarkingState = MarkingIncrementally;
+    m_incrementalMarkingAllocationLimit = m_bytesAllocatedThisCycle + m_maxEdenSize;
+    m_operationInProgress = NoOperation;
+    resumeCompilerThreads();
+#endif // ENABLE(GGC)
+}
+
+bool Heap::continueIncrementalMarking()
+{
+#if ENABLE(GGC)
+    ASSERT(m_incrementalMarkingState == MarkingIncrementally);
+    if (!m_isSafeToCollect || m_operationInProgress != NoOperation)
+        return false;
+
+    {
+        GCPHASE(IncrementalMarkingSlice);
+        suspendCompilerThreads();
+        m_operationInProgress = FullCollection;
+        flushWriteBarrierBuffer();
+        m_slotVisitor.drainIncrementally(Options::incrementalMarkingSliceSize(), m_incrementalOpaqueRootProducers);
+        m_operationInProgress = NoOperation;
+        resumeCompilerThreads();
+    }
+
+    // If the mutator allocates faster than we mark, we give up on keeping the pauses short
+    // rather than letting the heap grow without bound.
+    if (!m_slotVisitor.isEmpty() && m_bytesAllocatedThisCycle <= m_incrementalMarkingAllocationLimit)
+        return false;
+
+    collect();
+    return true;
+#else
+    return false;
+#endif // ENABLE(GGC)
+}
+
+void Heap::finishIncrementalMarking(double gcStartTime)
+{
+#if ENABLE(GGC)
+    SamplingRegion samplingRegion("Garbage Collection: Marking");
+
+    GCPHASE(FinishIncrementalMarking);
+    ASSERT(isValidThreadState(m_vm));
+    ASSERT(m_incrementalMarkingState == MarkingIncrementally);
+
+    flushOldStructureIDTables();
+    m_objectSpace.stopAllocating();
+    flushWriteBarrierBuffer();
+
+    // Revisit everything that was written to during the cycle. Any CodeBlocks owned by these
+    // cells need to be traced again as well.
+    m_codeBlocks.clearMarksForEdenCollection(m_incrementalRememberedSet);
+    for (const JSCell* cell : m_incrementalRememberedSet)
+        m_slotVisitor.unconditionallyAppend(const_cast<JSCell*>(cell));
+
+    // DOM mutations move wrappers between opaque roots without going through the write barrier.
+    // Revisit every cell that reported opaque roots during the marking slices so that the set
+    // reflects the current state before the weak handle owners consult it below.
+    for (const JSCell* cell : m_incrementalOpaqueRootProducers)
+        m_slotVisitor.unconditionallyAppend(const_cast<JSCell*>(cell));
+    m_incrementalOpaqueRootProducers.clear();
+
+    void* dummy;
+    ConservativeRoots conservativeRoots(&m_objectSpace.blocks(), &m_storageSpace);
+    gatherStackRoots(conservativeRoots, &dummy);
+    gatherJSStackRoots(conservativeRoots);
+    gatherScratchBufferRoots(conservativeRoots);
+
+    sanitizeStackForVM(m_vm);
+
+    m_objectSpace.didFinishIncrementalMarking();
+    m_storageSpace.didFinishIncrementalMarking();
+
+    HeapRootVisitor heapRootVisitor(m_slotVisitor);
+    {
+        ParallelModeEnabler enabler(m_slotVisitor);
+        visitRoots(conservativeRoots, heapRootVisitor);
+        converge();
+    }
+
+    // Weak references must be marked last because their liveness depends on
+    // the liveness of the rest of the object graph.
+    visitWeakHandles(heapRootVisitor);
+
+    clearRememberedSet(m_incrementalRememberedSet);
+    m_incrementalRememberedSet.clear();
+    m_incrementalMarkingState = NotMarkingIncrementally;
+
+    m_sharedData.didFinishMarking();
+    updateObjectCounts(gcStartTime);
+    resetVisitors();
+#else
+    UNUSED_PARAM(gcStartTime);
+#endif // ENABLE(GGC)
+}
+
+void Heap::abandonIncrementalMarking()
+{
+#if ENABLE(GGC)
+    ASSERT(m_incrementalMarkingState == MarkingIncrementally);
+    m_slotVisitor.clearMarkStack();
+    m_incrementalRememberedSet.clear();
+    m_incrementalOpaqueRootProducers.clear();
+    m_incrementalMarkingState = NotMarkingIncrementally;
+    m_sharedData.didFinishMarking();
+    resetVisitors();
+#endif
+}
+
 void Heap::suspendCompilerThreads()
 {
 #if ENABLE(DFG_JIT)
@@ -1134,6 +1363,15 @@ void Heap::deleteSourceProviderCaches()
 {
     GCPHASE(DeleteSourceProviderCaches);
     m_vm->clearSourceProviderCaches();
+    if (m_operationInProgress == FullCollection)
+        m_vm->clearSharedSourceProviderCaches();
+    m_vm->megamorphicPropertyCache.clear();
+    m_vm->jsonStringifyCache->clear();
+#if ENABLE(JIT)
+    // This holds raw Structure pointers, so don't let it outlive too many of them.
+    if (m_operationInProgress == FullCollection)
+        m_vm->megamorphicAccessProfile->clear();
+#endif
 }
 
 void Heap::notifyIncrementalSweeper()
@@ -1202,6 +1440,7 @@ void Heap::didFinishCollection(double gcStartTime)
         m_lastFullGCLength = gcEndTime - gcStartTime;
     else
         m_lastEdenGCLength = gcEndTime - gcStartTime;
+    m_totalGCTime += gcEndTime - gcStartTime;
 
     if (Options::recordGCPauseTimes())
         HeapStatistics::recordGCPauseTime(gcStartTime, gcEndTime);
@@ -1219,8 +1458,10 @@ void Heap::didFinishCollection(double gcStartTime)
     if (Options::showObjectStatistics())
         HeapStatistics::showObjectStatistics(this);
 
-    if (Options::logGC() == GCLogging::Verbose)
+    if (Options::logGC() == GCLogging::Verbose) {
+        GCLogging::dumpWeakHandleFinalizationCounts(this);
         GCLogging::dumpObjectGraph(this);
+    }
 }
 
 void Heap::resumeCompilerThreads()
@@ -188,6 +188,7 @@ public:
     double lastFullGCLength() const { return m_lastFullGCLength; }
     double lastEdenGCLength() const { return m_lastEdenGCLength; }
     void increaseLastFullGCLength(double amount) { m_lastFullGCLength += amount; }
+    double totalGCTime() const { return m_totalGCTime; }
 
     size_t sizeBeforeLastEdenCollection() const { return m_sizeBeforeLastEdenCollect; }
     size_t sizeAfterLastEdenCollection() const { return m_sizeAfterLastEdenCollect; }
@@ -216,6 +217,7 @@ public:
 #endif
 
     void removeCodeBlock(CodeBlock* cb) { m_codeBlocks.remove(cb); }
+    CodeBlockSet& codeBlockSet() { return m_codeBlocks; }
 
 private:
     friend class CodeBlock;
@@ -265,6 +267,8 @@ private:
     void stopAllocation();
 
     void markRoots(double gcStartTime);
+    void visitRoots(ConservativeRoots&, HeapRootVisitor&);
+    void donateAndDrainRoots();
     void gatherStackRoots(ConservativeRoots&, void** dummy);
     void gatherJSStackRoots(ConservativeRoots&);
     void gatherScratchBufferRoots(ConservativeRoots&);
@@ -304,6 +308,12 @@ private:
     void zombifyDeadObjects();
     void markDeadObjects();
 
+    bool shouldStartIncrementalMarking(HeapOperation requestedCollectionType) const;
+    void startIncrementalMarking();
+    bool continueIncrementalMarking();
+    void finishIncrementalMarking(double gcStartTime);
+    void abandonIncrementalMarking();
+
     bool shouldDoFullCollection(HeapOperation requestedCollectionType) const;
     size_t sizeAfterCollect();
 
@@ -331,6 +341,13 @@ private:
     size_t m_totalBytesCopied;
     
     HeapOperation m_operationInProgress;
+
+    enum IncrementalMarkingState { NotMarkingIncrementally, StartingIncrementalMarking, MarkingIncrementally };
+    IncrementalMarkingState m_incrementalMarkingState;
+    size_t m_incrementalMarkingAllocationLimit;
+    Vector<const JSCell*> m_incrementalRememberedSet;
+    Vector<const JSCell*> m_incrementalOpaqueRootProducers;
+
     BlockAllocator m_blockAllocator;
     StructureIDTable m_structureIDTable;
     MarkedSpace m_objectSpace;
@@ -355,6 +372,7 @@ private:
     CodeBlockSet m_codeBlocks;
     JITStubRoutineSet m_jitStubRoutines;
     FinalizerOwner m_finalizerOwner;
+    GCLogging::WeakHandleOwnerCounts m_weakHandleFinalizationCounts;
     
     bool m_isSafeToCollect;
 
@@ -363,6 +381,7 @@ private:
     VM* m_vm;
     double m_lastFullGCLength;
     double m_lastEdenGCLength;
+    double m_totalGCTime;
     double m_lastCodeDiscardTime;
 
     DoublyLinkedList<ExecutableBase> m_compiledCode;
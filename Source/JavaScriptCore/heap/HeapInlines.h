@@ -36,6 +36,8 @@ inline bool Heap::shouldCollect()
 {
     if (isDeferred())
         return false;
+    if (m_incrementalMarkingState != NotMarkingIncrementally)
+        return false;
     if (Options::gcMaxHeapSize())
         return m_bytesAllocatedThisCycle > Options::gcMaxHeapSize() && m_isSafeToCollect && m_operationInProgress == NoOperation;
     return m_bytesAllocatedThisCycle > m_maxEdenSize && m_isSafeToCollect && m_operationInProgress == NoOperation;
@@ -270,6 +272,9 @@ inline bool Heap::collectIfNecessaryOrDefer()
     if (isDeferred())
         return false;
 
+    if (m_incrementalMarkingState == MarkingIncrementally)
+        return continueIncrementalMarking();
+
     if (!shouldCollect())
         return false;
 
@@ -25,6 +25,9 @@ public:
     void reset();
     void stopAllocating();
     void resumeAllocating();
+#if ENABLE(GGC)
+    void didStartIncrementalMarking();
+#endif
     size_t cellSize() { return m_cellSize; }
     MarkedBlock::DestructorType destructorType() { return m_destructorType; }
     void* allocate(size_t);
@@ -129,6 +132,19 @@ inline void MarkedAllocator::resumeAllocating()
     m_lastActiveBlock = 0;
 }
 
+#if ENABLE(GGC)
+inline void MarkedAllocator::didStartIncrementalMarking()
+{
+    // None of our existing blocks can be swept until marking finishes, so forget about
+    // them and allocate out of fresh blocks in the meantime. reset() will bring them back
+    // once the collection is done.
+    m_lastActiveBlock = 0;
+    m_currentBlock = 0;
+    m_freeList = MarkedBlock::FreeList();
+    m_nextBlockToSweep = 0;
+}
+#endif
+
 template <typename Functor> inline void MarkedAllocator::forEachBlock(Functor& functor)
 {
     MarkedBlock* next;
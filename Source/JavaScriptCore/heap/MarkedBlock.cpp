@@ -64,6 +64,37 @@ inline void MarkedBlock::callDestructor(JSCell* cell)
     cell->zap();
 }
 
+// Without destructors to run, sweeping only needs the mark bits, so we read
+// them 64 atoms at a time. A chunk with nothing live needs no per-cell tests,
+// and a chunk of fully live single-atom cells is skipped outright.
+void MarkedBlock::sweepMarkBitsToFreeList(FreeCell*& head, size_t& count)
+{
+    size_t i = firstAtom();
+    while (i < m_endAtom) {
+        size_t chunkBegin = i & ~static_cast<size_t>(63);
+        size_t chunkEnd = std::min(chunkBegin + 64, m_endAtom);
+
+        uint64_t live = m_marks.get64(chunkBegin);
+        if (m_newlyAllocated)
+            live |= m_newlyAllocated->get64(chunkBegin);
+
+        if (!~live) {
+            i += (chunkEnd - i + m_atomsPerCell - 1) / m_atomsPerCell * m_atomsPerCell;
+            continue;
+        }
+
+        for (; i < chunkEnd; i += m_atomsPerCell) {
+            if (live && (live & (static_cast<uint64_t>(1) << (i - chunkBegin))))
+                continue;
+
+            FreeCell* freeCell = reinterpret_cast_ptr<FreeCell*>(&atoms()[i]);
+            freeCell->next = head;
+            head = freeCell;
+            ++count;
+        }
+    }
+}
+
 template<MarkedBlock::BlockState blockState, MarkedBlock::SweepMode sweepMode, MarkedBlock::DestructorType dtorType>
 MarkedBlock::FreeList MarkedBlock::specializedSweep()
 {
@@ -75,20 +106,24 @@ MarkedBlock::FreeList MarkedBlock::specializedSweep()
     // order of the free list.
     FreeCell* head = 0;
     size_t count = 0;
-    for (size_t i = firstAtom(); i < m_endAtom; i += m_atomsPerCell) {
-        if (blockState == Marked && (m_marks.get(i) || (m_newlyAllocated && m_newlyAllocated->get(i))))
-            continue;
-
-        JSCell* cell = reinterpret_cast_ptr<JSCell*>(&atoms()[i]);
-
-        if (dtorType != MarkedBlock::None && blockState != New)
-            callDestructor(cell);
-
-        if (sweepMode == SweepToFreeList) {
-            FreeCell* freeCell = reinterpret_cast<FreeCell*>(cell);
-            freeCell->next = head;
-            head = freeCell;
-            ++count;
+    if (blockState == Marked && dtorType == MarkedBlock::None)
+        sweepMarkBitsToFreeList(head, count);
+    else {
+        for (size_t i = firstAtom(); i < m_endAtom; i += m_atomsPerCell) {
+            if (blockState == Marked && (m_marks.get(i) || (m_newlyAllocated && m_newlyAllocated->get(i))))
+                continue;
+
+            JSCell* cell = reinterpret_cast_ptr<JSCell*>(&atoms()[i]);
+
+            if (dtorType != MarkedBlock::None && blockState != New)
+                callDestructor(cell);
+
+            if (sweepMode == SweepToFreeList) {
+                FreeCell* freeCell = reinterpret_cast<FreeCell*>(cell);
+                freeCell->next = head;
+                head = freeCell;
+                ++count;
+            }
         }
     }
 
@@ -239,6 +274,49 @@ void MarkedBlock::clearMarksWithCollectionType()
         m_state = Marked;
 }
 
+#if ENABLE(GGC)
+void MarkedBlock::didStartIncrementalMarking()
+{
+    HEAP_LOG_BLOCK_STATE_TRANSITION(this);
+    ASSERT(m_state != FreeListed);
+    if (m_state == New)
+        return;
+
+    // The mutator keeps running while we mark, so we cannot sweep this block until marking
+    // is done. In the meantime, conservative root scanning still needs to be able to tell
+    // live cells apart from dead ones, so we record the liveness as of the start of marking
+    // in the "newly allocated" bitmap before clearing the mark bits. We also reset the mark
+    // state in each live cell's header so that the write barrier notices stores into cells
+    // that have been visited during this cycle.
+    if (!m_newlyAllocated)
+        m_newlyAllocated = adoptPtr(new WTF::Bitmap<atomsPerBlock>());
+
+    for (size_t i = firstAtom(); i < m_endAtom; i += m_atomsPerCell) {
+        if (m_state != Allocated && !m_marks.get(i) && !m_newlyAllocated->get(i))
+            continue;
+        m_newlyAllocated->set(i);
+        reinterpret_cast<JSCell*>(&atoms()[i])->setNotMarked();
+    }
+
+    m_marks.clearAll();
+    m_rememberedSet.clearAll();
+    m_state = Marked;
+}
+
+void MarkedBlock::didFinishIncrementalMarking()
+{
+    HEAP_LOG_BLOCK_STATE_TRANSITION(this);
+    ASSERT(m_state != FreeListed);
+
+    // From here on only this cycle's mark bits decide what survives. Blocks that were
+    // used up by the mutator during marking have had their reachable cells marked like
+    // everybody else's.
+    clearNewlyAllocated();
+    if (m_state == Allocated)
+        m_state = Marked;
+}
+#endif // ENABLE(GGC)
+
 void MarkedBlock::lastChanceToFinalize()
 {
     m_weakSet.lastChanceToFinalize();
@@ -150,6 +150,10 @@ namespace JSC {
         void clearRememberedSet();
         template <HeapOperation collectionType>
         void clearMarksWithCollectionType();
+#if ENABLE(GGC)
+        void didStartIncrementalMarking();
+        void didFinishIncrementalMarking();
+#endif
 
         size_t markCount();
         bool isEmpty();
@@ -199,6 +203,7 @@ namespace JSC {
         size_t atomNumber(const void*);
         void callDestructor(JSCell*);
         template<BlockState, SweepMode, DestructorType> FreeList specializedSweep();
+        void sweepMarkBitsToFreeList(FreeCell*& head, size_t& count);
         
         size_t m_atomsPerCell;
         size_t m_endAtom; // This is a fuzzy end. Always test for < m_endAtom.
@@ -346,6 +346,35 @@ void MarkedSpace::clearMarks()
 #endif
 }
 
+#if ENABLE(GGC)
+struct DidStartIncrementalMarkingInBlock : MarkedBlock::VoidFunctor {
+    void operator()(MarkedBlock* block) { block->didStartIncrementalMarking(); }
+};
+
+struct DidStartIncrementalMarkingInAllocator {
+    void operator()(MarkedAllocator& allocator) { allocator.didStartIncrementalMarking(); }
+};
+
+struct DidFinishIncrementalMarkingInBlock : MarkedBlock::VoidFunctor {
+    void operator()(MarkedBlock* block) { block->didFinishIncrementalMarking(); }
+};
+
+void MarkedSpace::didStartIncrementalMarking()
+{
+    ASSERT(m_heap->operationInProgress() == FullCollection);
+    forEachBlock<DidStartIncrementalMarkingInBlock>();
+    forEachAllocator<DidStartIncrementalMarkingInAllocator>();
+    m_blocksWithNewObjects.clear();
+}
+
+void MarkedSpace::didFinishIncrementalMarking()
+{
+    ASSERT(m_heap->operationInProgress() == FullCollection);
+    forEachBlock<DidFinishIncrementalMarkingInBlock>();
+    clearNewlyAllocated();
+}
+#endif // ENABLE(GGC)
+
 void MarkedSpace::willStartIterating()
 {
     ASSERT(!isIterating());
@@ -120,6 +120,10 @@ public:
     void clearMarks();
     void clearRememberedSet();
     void clearNewlyAllocated();
+#if ENABLE(GGC)
+    void didStartIncrementalMarking();
+    void didFinishIncrementalMarking();
+#endif
     void sweep();
     size_t objectCount();
     size_t size();
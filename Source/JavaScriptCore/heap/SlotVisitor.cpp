@@ -12,6 +12,7 @@
 #include "JSObject.h"
 #include "JSString.h"
 #include "JSCInlines.h"
+#include <wtf/CurrentTime.h>
 #include <wtf/StackStats.h>
 
 namespace JSC {
@@ -21,7 +22,13 @@ SlotVisitor::SlotVisitor(GCThreadSharedData& shared)
     , m_bytesVisited(0)
     , m_bytesCopied(0)
     , m_visitCount(0)
+    , m_opaqueRootAdditionCount(0)
     , m_isInParallelMode(false)
+#if ENABLE(PARALLEL_GC)
+    , m_random(static_cast<unsigned>(reinterpret_cast<uintptr_t>(this)))
+#endif
+    , m_stealCount(0)
+    , m_idleTime(0)
     , m_shared(shared)
     , m_shouldHashCons(false)
 #if !ASSERT_DISABLED
@@ -59,7 +66,13 @@ void SlotVisitor::reset()
     m_bytesVisited = 0;
     m_bytesCopied = 0;
     m_visitCount = 0;
+    m_stealCount = 0;
+    m_idleTime = 0;
     ASSERT(m_stack.isEmpty());
+#if ENABLE(PARALLEL_GC)
+    ASSERT(m_stealableCells.isEmpty());
+    m_stealableCells.releaseRetiredBuffers();
+#endif
     if (m_shouldHashCons) {
         m_uniqueStrings.clear();
         m_shouldHashCons = false;
@@ -69,6 +82,10 @@ void SlotVisitor::reset()
 void SlotVisitor::clearMarkStack()
 {
     m_stack.clear();
+#if ENABLE(PARALLEL_GC)
+    const JSCell* cell;
+    while (m_stealableCells.pop(cell)) { }
+#endif
 }
 
 void SlotVisitor::append(ConservativeRoots& conservativeRoots)
@@ -114,6 +131,13 @@ void SlotVisitor::donateKnownParallel()
     if (m_stack.size() < 2)
         return;
 
+#if ENABLE(PARALLEL_GC)
+    if (Options::useWorkStealingMarkStack()) {
+        donateToStealableCells();
+        return;
+    }
+#endif
+
     // If there's already some shared work queued up, be conservative and assume
     // that donating more is not profitable.
     if (m_shared.m_sharedMarkStack.size())
@@ -139,12 +163,14 @@ void SlotVisitor::drain()
    
 #if ENABLE(PARALLEL_GC)
     if (Options::numberOfGCMarkers() > 1) {
-        while (!m_stack.isEmpty()) {
-            m_stack.refill();
-            for (unsigned countdown = Options::minimumNumberOfScansBetweenRebalance(); m_stack.canRemoveLast() && countdown--;)
-                visitChildren(*this, m_stack.removeLast());
-            donateKnownParallel();
-        }
+        do {
+            while (!m_stack.isEmpty()) {
+                m_stack.refill();
+                for (unsigned countdown = Options::minimumNumberOfScansBetweenRebalance(); m_stack.canRemoveLast() && countdown--;)
+                    visitChildren(*this, m_stack.removeLast());
+                donateKnownParallel();
+            }
+        } while (reclaimStealableCells());
         
         mergeOpaqueRootsIfNecessary();
         return;
@@ -158,6 +184,106 @@ void SlotVisitor::drain()
     }
 }
 
+#if ENABLE(PARALLEL_GC)
+void SlotVisitor::donateToStealableCells()
+{
+    // Thieves still have the last batch we offered, so there is no point in offering more.
+    if (!m_stealableCells.isEmpty())
+        return;
+
+    for (size_t count = m_stack.size() / 2; count && m_stack.canRemoveLast(); --count)
+        m_stealableCells.push(m_stack.removeLast());
+
+    // Taking the lock here guarantees that a marker that is about to wait either sees
+    // the cells we just pushed or is woken up by us.
+    std::lock_guard<std::mutex> lock(m_shared.m_markingMutex);
+    if (m_shared.m_numberOfActiveParallelMarkers < Options::numberOfGCMarkers())
+        m_shared.m_markingConditionVariable.notify_all();
+}
+
+bool SlotVisitor::reclaimStealableCells()
+{
+    // Take back whatever nobody stole, so that a visitor that is done draining never
+    // leaves work behind in its deque.
+    bool didReclaim = false;
+    const JSCell* cell;
+    while (m_stealableCells.pop(cell)) {
+        m_stack.append(cell);
+        didReclaim = true;
+    }
+    return didReclaim;
+}
+
+unsigned SlotVisitor::numberOfVisitors()
+{
+    return m_shared.m_gcThreads.size() + 1;
+}
+
+SlotVisitor& SlotVisitor::visitorAt(unsigned index)
+{
+    if (!index)
+        return m_shared.m_vm->heap.m_slotVisitor;
+    return *m_shared.m_gcThreads[index - 1]->slotVisitor();
+}
+
+bool SlotVisitor::stealFromOtherVisitors()
+{
+    unsigned numberOfVisitors = this->numberOfVisitors();
+    unsigned start = m_random.getUint32() % numberOfVisitors;
+    for (unsigned i = 0; i < numberOfVisitors; ++i) {
+        SlotVisitor& victim = visitorAt((start + i) % numberOfVisitors);
+        if (&victim == this)
+            continue;
+
+        size_t stolen = 0;
+        const JSCell* cell;
+        for (size_t count = std::max<size_t>(victim.m_stealableCells.size() / 2, 1); count && victim.m_stealableCells.steal(cell); --count) {
+            m_stack.append(cell);
+            stolen++;
+        }
+        if (stolen) {
+            m_stealCount += stolen;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SlotVisitor::hasStealableCellsInAnyVisitor()
+{
+    for (unsigned i = 0; i < numberOfVisitors(); ++i) {
+        if (!visitorAt(i).m_stealableCells.isEmpty())
+            return true;
+    }
+    return false;
+}
+#endif // ENABLE(PARALLEL_GC)
+
+#if ENABLE(GGC)
+void SlotVisitor::drainIncrementally(size_t visitBudget, Vector<const JSCell*>& opaqueRootProducers)
+{
+    StackStats::probe();
+    ASSERT(!m_isInParallelMode);
+
+    while (visitBudget && !m_stack.isEmpty()) {
+        m_stack.refill();
+        for (; visitBudget && m_stack.canRemoveLast(); --visitBudget) {
+            const JSCell* cell = m_stack.removeLast();
+            size_t opaqueRootAdditionCount = m_opaqueRootAdditionCount;
+            visitChildren(*this, cell);
+            // The opaque roots a cell reports can change without any store to the cell,
+            // so the final remark has to ask it again.
+            if (m_opaqueRootAdditionCount != opaqueRootAdditionCount)
+                opaqueRootProducers.append(cell);
+        }
+    }
+
+#if ENABLE(PARALLEL_GC)
+    mergeOpaqueRootsIfNecessary();
+#endif
+}
+#endif // ENABLE(GGC)
+
 void SlotVisitor::drainFromShared(SharedDrainMode sharedDrainMode)
 {
     StackStats::probe();
@@ -187,7 +313,18 @@ void SlotVisitor::drainFromShared(SharedDrainMode sharedDrainMode)
         std::lock_guard<std::mutex> lock(m_shared.m_markingMutex);
         m_shared.m_numberOfActiveParallelMarkers++;
     }
+    bool useWorkStealing = Options::useWorkStealingMarkStack();
+    auto hasWork = [&] {
+        return !m_shared.m_sharedMarkStack.isEmpty() || (useWorkStealing && hasStealableCellsInAnyVisitor());
+    };
     while (true) {
+        // Steal while we are still counted as active, so that nobody can observe
+        // termination while we hold stolen cells.
+        if (useWorkStealing && stealFromOtherVisitors()) {
+            drain();
+            continue;
+        }
+
         {
             std::unique_lock<std::mutex> lock(m_shared.m_markingMutex);
             m_shared.m_numberOfActiveParallelMarkers--;
@@ -198,27 +335,31 @@ void SlotVisitor::drainFromShared(SharedDrainMode sharedDrainMode)
                 // for us to do.
                 while (true) {
                     // Did we reach termination?
-                    if (!m_shared.m_numberOfActiveParallelMarkers && m_shared.m_sharedMarkStack.isEmpty()) {
+                    if (!m_shared.m_numberOfActiveParallelMarkers && !hasWork()) {
                         // Let any sleeping slaves know it's time for them to return;
                         m_shared.m_markingConditionVariable.notify_all();
                         return;
                     }
                     
                     // Is there work to be done?
-                    if (!m_shared.m_sharedMarkStack.isEmpty())
+                    if (hasWork())
                         break;
                     
                     // Otherwise wait.
+                    double idleStartTime = monotonicallyIncreasingTime();
                     m_shared.m_markingConditionVariable.wait(lock);
+                    m_idleTime += monotonicallyIncreasingTime() - idleStartTime;
                 }
             } else {
                 ASSERT(sharedDrainMode == SlaveDrain);
                 
                 // Did we detect termination? If so, let the master know.
-                if (!m_shared.m_numberOfActiveParallelMarkers && m_shared.m_sharedMarkStack.isEmpty())
+                if (!m_shared.m_numberOfActiveParallelMarkers && !hasWork())
                     m_shared.m_markingConditionVariable.notify_all();
 
-                m_shared.m_markingConditionVariable.wait(lock, [this] { return !m_shared.m_sharedMarkStack.isEmpty() || m_shared.m_parallelMarkersShouldExit; });
+                double idleStartTime = monotonicallyIncreasingTime();
+                m_shared.m_markingConditionVariable.wait(lock, [&] { return hasWork() || m_shared.m_parallelMarkersShouldExit; });
+                m_idleTime += monotonicallyIncreasingTime() - idleStartTime;
                 
                 // Is the current phase done? If so, return from this function.
                 if (m_shared.m_parallelMarkersShouldExit)
@@ -30,6 +30,8 @@
 #include "HandleTypes.h"
 #include "MarkStack.h"
 #include "OpaqueRootSet.h"
+#include "WeakRandom.h"
+#include "WorkStealingDeque.h"
 
 #include <wtf/HashSet.h>
 #include <wtf/text/StringHash.h>
@@ -92,10 +94,15 @@ public:
     size_t bytesVisited() const { return m_bytesVisited; }
     size_t bytesCopied() const { return m_bytesCopied; }
     size_t visitCount() const { return m_visitCount; }
+    size_t stealCount() const { return m_stealCount; }
+    double idleTime() const { return m_idleTime; }
 
     void donate();
     void drain();
     void donateAndDrain();
+#if ENABLE(GGC)
+    void drainIncrementally(size_t visitBudget, Vector<const JSCell*>& opaqueRootProducers);
+#endif
     
     enum SharedDrainMode { SlaveDrain, MasterDrain };
     void drainFromShared(SharedDrainMode);
@@ -134,6 +141,14 @@ private:
     void mergeOpaqueRootsIfProfitable();
     
     void donateKnownParallel();
+#if ENABLE(PARALLEL_GC)
+    void donateToStealableCells();
+    bool reclaimStealableCells();
+    bool stealFromOtherVisitors();
+    bool hasStealableCellsInAnyVisitor();
+    unsigned numberOfVisitors();
+    SlotVisitor& visitorAt(unsigned);
+#endif
 
     MarkStackArray m_stack;
     OpaqueRootSet m_opaqueRoots; // Handle-owning data structures not visible to the garbage collector.
@@ -141,7 +156,17 @@ private:
     size_t m_bytesVisited;
     size_t m_bytesCopied;
     size_t m_visitCount;
+    size_t m_opaqueRootAdditionCount;
     bool m_isInParallelMode;
+
+#if ENABLE(PARALLEL_GC)
+    // When Options::useWorkStealingMarkStack() is set, cells that this visitor offers up
+    // to other markers live here instead of on the shared mark stack.
+    WorkStealingDeque<const JSCell*> m_stealableCells;
+    WeakRandom m_random;
+#endif
+    size_t m_stealCount;
+    double m_idleTime;
     
     GCThreadSharedData& m_shared;
 
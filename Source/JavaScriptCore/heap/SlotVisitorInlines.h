@@ -158,6 +158,7 @@ inline void SlotVisitor::addUnconditionalFinalizer(UnconditionalFinalizer* uncon
 
 inline void SlotVisitor::addOpaqueRoot(void* root)
 {
+    ++m_opaqueRootAdditionCount;
 #if ENABLE(PARALLEL_GC)
     if (Options::numberOfGCMarkers() == 1) {
         // Put directly into the shared HashSet.
@@ -245,6 +246,11 @@ inline void SlotVisitor::copyLater(JSCell* owner, CopyToken token, void* ptr, si
 
     ASSERT(heap()->m_storageSpace.contains(block));
 
+    // An eden collection only evacuates the young generation. Old blocks aren't in
+    // its from-space, so their live bytes and work lists must wait for a full collection.
+    if (heap()->operationInProgress() == EdenCollection && block->isOld())
+        return;
+
     SpinLockHolder locker(&block->workListLock());
     if (heap()->operationInProgress() == FullCollection || block->shouldReportLiveBytes(locker, owner)) {
         m_bytesCopied += bytes;
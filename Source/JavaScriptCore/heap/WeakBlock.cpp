@@ -31,6 +31,8 @@
 #include "JSObject.h"
 #include "JSCInlines.h"
 #include "Structure.h"
+#include <algorithm>
+#include <wtf/Vector.h>
 
 namespace JSC {
 
@@ -63,17 +65,44 @@ void WeakBlock::lastChanceToFinalize()
     }
 }
 
-void WeakBlock::sweep()
+static bool weakImplOwnerLessThan(WeakImpl* a, WeakImpl* b)
+{
+    return a->weakHandleOwner() < b->weakHandleOwner();
+}
+
+void WeakBlock::sweep(GCLogging::WeakHandleOwnerCounts* finalizationCounts)
 {
     // If a block is completely empty, a sweep won't have any effect.
     if (isEmpty())
         return;
 
-    SweepResult sweepResult;
+    // Finalize dead handles grouped by owner, so that runs of finalize() calls
+    // dispatch to the same owner back to back.
+    Vector<WeakImpl*, blockSize / sizeof(WeakImpl)> deadWeakImpls;
     for (size_t i = 0; i < weakImplCount(); ++i) {
         WeakImpl* weakImpl = &weakImpls()[i];
         if (weakImpl->state() == WeakImpl::Dead)
-            finalize(weakImpl);
+            deadWeakImpls.uncheckedAppend(weakImpl);
+    }
+    std::stable_sort(deadWeakImpls.begin(), deadWeakImpls.end(), weakImplOwnerLessThan);
+
+    for (size_t i = 0; i < deadWeakImpls.size();) {
+        WeakHandleOwner* weakHandleOwner = deadWeakImpls[i]->weakHandleOwner();
+        size_t finalizedCount = 0;
+        for (; i < deadWeakImpls.size() && deadWeakImpls[i]->weakHandleOwner() == weakHandleOwner; ++i) {
+            // An earlier finalizer may have deallocated this handle.
+            if (deadWeakImpls[i]->state() != WeakImpl::Dead)
+                continue;
+            finalize(deadWeakImpls[i]);
+            ++finalizedCount;
+        }
+        if (finalizationCounts && weakHandleOwner && finalizedCount)
+            finalizationCounts->add(weakHandleOwner, 0).iterator->value += finalizedCount;
+    }
+
+    SweepResult sweepResult;
+    for (size_t i = 0; i < weakImplCount(); ++i) {
+        WeakImpl* weakImpl = &weakImpls()[i];
         if (weakImpl->state() == WeakImpl::Deallocated)
             addToFreeList(&sweepResult.freeList, weakImpl);
         else
@@ -26,6 +26,7 @@
 #ifndef WeakBlock_h
 #define WeakBlock_h
 
+#include "GCLogging.h"
 #include "HeapBlock.h"
 #include "WeakHandleOwner.h"
 #include "WeakImpl.h"
@@ -62,7 +63,7 @@ public:
 
     bool isEmpty();
 
-    void sweep();
+    void sweep(GCLogging::WeakHandleOwnerCounts* finalizationCounts = 0);
     SweepResult takeSweepResult();
 
     void visit(HeapRootVisitor&);
@@ -44,8 +44,12 @@ WeakSet::~WeakSet()
 
 void WeakSet::sweep()
 {
+    GCLogging::WeakHandleOwnerCounts* finalizationCounts = 0;
+    if (Options::logGC() == GCLogging::Verbose)
+        finalizationCounts = &heap()->m_weakHandleFinalizationCounts;
+
     for (WeakBlock* block = m_blocks.head(); block; block = block->next())
-        block->sweep();
+        block->sweep(finalizationCounts);
 
     resetAllocator();
 }
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WorkStealingDeque_h
+#define WorkStealingDeque_h
+
+#include <atomic>
+#include <wtf/FastMalloc.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/StdLibExtras.h>
+#include <wtf/Vector.h>
+
+namespace JSC {
+
+// A Chase-Lev work-stealing deque. The owning thread pushes and pops at the bottom
+// without taking any locks; other threads steal from the top with a single
+// compare-and-swap. Buffers that are outgrown stay alive until the owner calls
+// releaseRetiredBuffers(), which it may only do once no thief can be looking at them.
+template<typename T>
+class WorkStealingDeque {
+    WTF_MAKE_NONCOPYABLE(WorkStealingDeque);
+public:
+    WorkStealingDeque()
+        : m_top(0)
+        , m_bottom(0)
+        , m_buffer(Buffer::create(s_initialCapacity))
+    {
+    }
+
+    ~WorkStealingDeque()
+    {
+        releaseRetiredBuffers();
+        Buffer::destroy(m_buffer.load(std::memory_order_relaxed));
+    }
+
+    // Only the owning thread may call push() and pop().
+    void push(T value)
+    {
+        intptr_t bottom = m_bottom.load(std::memory_order_relaxed);
+        intptr_t top = m_top.load(std::memory_order_acquire);
+        Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+        if (bottom - top >= static_cast<intptr_t>(buffer->capacity))
+            buffer = grow(buffer, top, bottom);
+        buffer->at(bottom).store(value, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    bool pop(T& result)
+    {
+        intptr_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        intptr_t top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        result = buffer->at(bottom).load(std::memory_order_relaxed);
+        if (top < bottom)
+            return true;
+
+        // We're taking the last element, so we race with the thieves for it.
+        bool won = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return won;
+    }
+
+    // Any thread may call steal(). It fails if the deque is empty or if we lost a race
+    // with another thief or with the owner.
+    bool steal(T& result)
+    {
+        intptr_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        intptr_t bottom = m_bottom.load(std::memory_order_acquire);
+        if (top >= bottom)
+            return false;
+
+        Buffer* buffer = m_buffer.load(std::memory_order_acquire);
+        result = buffer->at(top).load(std::memory_order_relaxed);
+        return m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    // This is only a snapshot when other threads are using the deque.
+    size_t size() const
+    {
+        intptr_t size = m_bottom.load(std::memory_order_relaxed) - m_top.load(std::memory_order_relaxed);
+        return size > 0 ? size : 0;
+    }
+
+    bool isEmpty() const { return !size(); }
+
+    void releaseRetiredBuffers()
+    {
+        for (Buffer* buffer : m_retiredBuffers)
+            Buffer::destroy(buffer);
+        m_retiredBuffers.clear();
+    }
+
+private:
+    static const size_t s_initialCapacity = 256;
+
+    struct Buffer {
+        static Buffer* create(size_t capacity)
+        {
+            void* memory = fastMalloc(sizeof(Buffer) + capacity * sizeof(std::atomic<T>));
+            Buffer* buffer = static_cast<Buffer*>(memory);
+            buffer->capacity = capacity;
+            for (size_t i = 0; i < capacity; ++i)
+                new (NotNull, &buffer->elements()[i]) std::atomic<T>();
+            return buffer;
+        }
+
+        static void destroy(Buffer* buffer)
+        {
+            fastFree(buffer);
+        }
+
+        std::atomic<T>* elements() { return reinterpret_cast<std::atomic<T>*>(this + 1); }
+        std::atomic<T>& at(intptr_t index) { return elements()[index & (capacity - 1)]; }
+
+        size_t capacity;
+    };
+
+    Buffer* grow(Buffer* buffer, intptr_t top, intptr_t bottom)
+    {
+        Buffer* newBuffer = Buffer::create(buffer->capacity * 2);
+        for (intptr_t i = top; i < bottom; ++i)
+            newBuffer->at(i).store(buffer->at(i).load(std::memory_order_relaxed), std::memory_order_relaxed);
+        m_buffer.store(newBuffer, std::memory_order_release);
+        m_retiredBuffers.append(buffer);
+        return newBuffer;
+    }
+
+    std::atomic<intptr_t> m_top;
+    std::atomic<intptr_t> m_bottom;
+    std::atomic<Buffer*> m_buffer;
+    Vector<Buffer*> m_retiredBuffers;
+};
+
+} // namespace JSC
+
+#endif // WorkStealingDeque_h
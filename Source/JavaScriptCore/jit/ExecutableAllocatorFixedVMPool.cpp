@@ -31,6 +31,7 @@
 #if ENABLE(EXECUTABLE_ALLOCATOR_FIXED)
 
 #include "CodeProfiling.h"
+#include <atomic>
 #include <errno.h>
 #include <unistd.h>
 #include <wtf/MetaAllocator.h>
@@ -145,7 +146,25 @@ bool ExecutableAllocator::isValid() const
 bool ExecutableAllocator::underMemoryPressure()
 {
     MetaAllocator::Statistics statistics = allocator->currentStatistics();
-    return statistics.bytesAllocated > statistics.bytesReserved / 2;
+    if (statistics.bytesAllocated > statistics.bytesReserved / 2)
+        return true;
+
+    // Code that is still in use pins its chunk, so the pool can have plenty of free
+    // space left in pieces too small for an optimized compile. Treat that the same
+    // way, so that discarding compiled code lets the free space coalesce again.
+    // Once we have reported fragmentation, we don't report it again until the largest
+    // free chunk has grown well past the threshold. Otherwise a pool that stays close
+    // to it would have all of its compiled code thrown away on nearly every VM entry.
+    static std::atomic<bool> hasReportedFragmentation(false);
+    if (hasReportedFragmentation) {
+        if (statistics.largestFreeChunk >= statistics.bytesReserved / 16)
+            hasReportedFragmentation = false;
+        return false;
+    }
+    if (statistics.largestFreeChunk >= statistics.bytesReserved / 64)
+        return false;
+    hasReportedFragmentation = true;
+    return true;
 }
 
 double ExecutableAllocator::memoryPressureMultiplier(size_t addedMemoryUsage)
@@ -122,9 +122,30 @@ EncodedJSValue JIT_OPERATION operationGetById(ExecState* exec, StructureStubInfo
     NativeCallFrameTracer tracer(vm, exec);
     
     JSValue baseValue = JSValue::decode(base);
+    
+    // Sites that end up here are the megamorphic ones, so try the shared cache
+    // before doing a full lookup.
+    if (baseValue.isCell()) {
+        JSCell* baseCell = baseValue.asCell();
+        PropertyOffset offset = vm->megamorphicPropertyCache.get(baseCell->structureID(), uid);
+        if (offset != invalidOffset)
+            return JSValue::encode(asObject(baseCell)->getDirect(offset));
+    }
+    
     PropertySlot slot(baseValue);
     Identifier ident(vm, uid);
-    return JSValue::encode(baseValue.get(exec, ident, slot));
+    JSValue result = baseValue.get(exec, ident, slot);
+    
+    if (baseValue.isCell() && slot.isCacheableValue() && slot.slotBase() == baseValue) {
+        Structure* structure = baseValue.asCell()->structure(*vm);
+        if (structure->propertyAccessesAreCacheable()
+            && !structure->isDictionary()
+            && !structure->typeInfo().overridesGetOwnPropertySlot()
+            && !structure->typeInfo().hasImpureGetOwnPropertySlot())
+            vm->megamorphicPropertyCache.add(structure->id(), uid, slot.cachedOffset());
+    }
+    
+    return JSValue::encode(result);
 }
 
 EncodedJSValue JIT_OPERATION operationGetByIdBuildList(ExecState* exec, StructureStubInfo* stubInfo, EncodedJSValue base, StringImpl* uid)
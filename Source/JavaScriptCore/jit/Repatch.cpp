@@ -39,6 +39,7 @@
 #include "JITInlines.h"
 #include "LinkBuffer.h"
 #include "JSCInlines.h"
+#include "MegamorphicAccessProfile.h"
 #include "PolymorphicGetByIdList.h"
 #include "PolymorphicPutByIdList.h"
 #include "RepatchBuffer.h"
@@ -744,6 +745,44 @@ static void patchJumpToGetByIdStub(CodeBlock* codeBlock, StructureStubInfo& stub
     replaceWithJump(repatchBuffer, stubInfo, stubRoutine->code().code());
 }
 
+// Sites for the same property that see the same Structures tend to end up
+// megamorphic together. Rather than have each one fill its list with stubs that
+// are about to be thrown away, a site stops at half a list if another site's
+// list already overflowed with a superset of its Structures.
+static const unsigned listSizeForEarlyGiveUp = POLYMORPHIC_LIST_CACHE_SIZE / 2;
+
+static bool shouldStopBuildingGetByIdList(VM& vm, const Identifier& propertyName, PolymorphicGetByIdList* list)
+{
+    if (!list->isFull() && list->size() < listSizeForEarlyGiveUp)
+        return false;
+
+    MegamorphicAccessProfile::StructureList structures;
+    for (unsigned i = 0; i < list->size(); ++i)
+        structures.append(list->at(i).structure());
+
+    if (list->isFull()) {
+        vm.megamorphicAccessProfile->didOverflow(MegamorphicAccessProfile::GetById, propertyName.impl(), structures);
+        return true;
+    }
+    return vm.megamorphicAccessProfile->isKnownMegamorphic(MegamorphicAccessProfile::GetById, propertyName.impl(), structures);
+}
+
+static bool shouldStopBuildingPutByIdList(VM& vm, const Identifier& propertyName, PolymorphicPutByIdList* list)
+{
+    if (!list->isFull() && list->size() < listSizeForEarlyGiveUp)
+        return false;
+
+    MegamorphicAccessProfile::StructureList structures;
+    for (unsigned i = 0; i < list->size(); ++i)
+        structures.append(list->at(i).oldStructure());
+
+    if (list->isFull()) {
+        vm.megamorphicAccessProfile->didOverflow(MegamorphicAccessProfile::PutById, propertyName.impl(), structures);
+        return true;
+    }
+    return vm.megamorphicAccessProfile->isKnownMegamorphic(MegamorphicAccessProfile::PutById, propertyName.impl(), structures);
+}
+
 static bool tryBuildGetByIDList(ExecState* exec, JSValue baseValue, const Identifier& ident, const PropertySlot& slot, StructureStubInfo& stubInfo)
 {
     if (!baseValue.isCell()
@@ -806,7 +845,7 @@ static bool tryBuildGetByIDList(ExecState* exec, JSValue baseValue, const Identi
     
     patchJumpToGetByIdStub(codeBlock, stubInfo, stubRoutine.get());
     
-    return !list->isFull();
+    return !shouldStopBuildingGetByIdList(*vm, ident, list);
 }
 
 void buildGetByIDList(ExecState* exec, JSValue baseValue, const Identifier& propertyName, const PropertySlot& slot, StructureStubInfo& stubInfo)
@@ -1315,7 +1354,7 @@ static bool tryBuildPutByIdList(ExecState* exec, JSValue baseValue, const Identi
         RepatchBuffer repatchBuffer(codeBlock);
         repatchBuffer.relink(stubInfo.callReturnLocation.jumpAtOffset(stubInfo.patch.deltaCallToJump), CodeLocationLabel(stubRoutine->code().code()));
         
-        if (list->isFull())
+        if (shouldStopBuildingPutByIdList(*vm, propertyName, list))
             repatchCall(repatchBuffer, stubInfo.callReturnLocation, appropriateGenericPutByIdFunction(slot, putKind));
         
         return true;
@@ -1351,7 +1390,7 @@ static bool tryBuildPutByIdList(ExecState* exec, JSValue baseValue, const Identi
 
         RepatchBuffer repatchBuffer(codeBlock);
         repatchBuffer.relink(stubInfo.callReturnLocation.jumpAtOffset(stubInfo.patch.deltaCallToJump), CodeLocationLabel(stubRoutine->code().code()));
-        if (list->isFull())
+        if (shouldStopBuildingPutByIdList(*vm, propertyName, list))
             repatchCall(repatchBuffer, stubInfo.callReturnLocation, appropriateGenericPutByIdFunction(slot, putKind));
 
         return true;
@@ -35,9 +35,11 @@
 #include "JSCInlines.h"
 #include "JSFunction.h"
 #include "JSLock.h"
+#include "JSONObject.h"
 #include "JSProxy.h"
 #include "JSString.h"
 #include "ProfilerDatabase.h"
+#include "SamplingProfiler.h"
 #include "SamplingTool.h"
 #include "StackVisitor.h"
 #include "StructureRareDataInlines.h"
@@ -298,6 +300,8 @@ public:
         , m_dump(false)
         , m_exitCode(false)
         , m_profile(false)
+        , m_sample(false)
+        , m_benchmarkIterations(0)
     {
         parseArguments(argc, argv);
     }
@@ -309,6 +313,8 @@ public:
     Vector<String> m_arguments;
     bool m_profile;
     String m_profilerOutput;
+    bool m_sample;
+    unsigned m_benchmarkIterations;
 
     void parseArguments(int, char**);
 };
@@ -956,6 +962,100 @@ static bool runWithScripts(GlobalObject* globalObject, const Vector<Script>& scr
     return success;
 }
 
+static void appendTimesInMilliseconds(StringBuilder& builder, const char* name, const Vector<double>& times)
+{
+    double total = 0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = 0;
+    for (double time : times) {
+        total += time;
+        min = std::min(min, time);
+        max = std::max(max, time);
+    }
+    double mean = total / times.size();
+
+    double squaredDeviations = 0;
+    for (double time : times)
+        squaredDeviations += (time - mean) * (time - mean);
+    double standardDeviation = sqrt(squaredDeviations / times.size());
+
+    builder.appendLiteral(", \"");
+    builder.append(name);
+    builder.appendLiteral("\": {\"mean\": ");
+    builder.appendNumber(mean * 1000);
+    builder.appendLiteral(", \"stddev\": ");
+    builder.appendNumber(standardDeviation * 1000);
+    builder.appendLiteral(", \"min\": ");
+    builder.appendNumber(min * 1000);
+    builder.appendLiteral(", \"max\": ");
+    builder.appendNumber(max * 1000);
+    builder.appendLiteral(", \"samples\": [");
+    for (size_t i = 0; i < times.size(); ++i) {
+        if (i)
+            builder.appendLiteral(", ");
+        builder.appendNumber(times[i] * 1000);
+    }
+    builder.appendLiteral("]}");
+}
+
+static bool runBenchmark(GlobalObject* globalObject, const Vector<Script>& scripts, unsigned iterations)
+{
+    VM& vm = globalObject->vm();
+    ExecState* exec = globalObject->globalExec();
+    Vector<char> scriptBuffer;
+
+    StringBuilder builder;
+    builder.append('[');
+    for (size_t i = 0; i < scripts.size(); i++) {
+        const char* script;
+        String fileName;
+        if (scripts[i].isFile) {
+            fileName = scripts[i].argument;
+            if (!fillBufferWithContentsOfFile(fileName, scriptBuffer))
+                return false;
+            script = scriptBuffer.data();
+        } else {
+            script = scripts[i].argument;
+            fileName = "[Command Line]";
+        }
+        SourceCode source = jscSource(script, fileName);
+
+        Vector<double> times;
+        Vector<double> gcTimes;
+        // The first run is not recorded, so that the timed runs see code that has already tiered up.
+        for (unsigned iteration = 0; iteration <= iterations; ++iteration) {
+            double gcTimeBefore = vm.heap.totalGCTime();
+            double startTime = monotonicallyIncreasingTime();
+            JSValue evaluationException;
+            evaluate(exec, source, JSValue(), &evaluationException);
+            double endTime = monotonicallyIncreasingTime();
+            if (evaluationException) {
+                fprintf(stderr, "Exception: %s\n", evaluationException.toString(exec)->value(exec).utf8().data());
+                exec->clearException();
+                return false;
+            }
+            if (!iteration)
+                continue;
+            times.append(endTime - startTime);
+            gcTimes.append(vm.heap.totalGCTime() - gcTimeBefore);
+        }
+
+        if (i)
+            builder.appendLiteral(", ");
+        builder.appendLiteral("{\"script\": ");
+        builder.append(JSONStringify(exec, jsString(exec, fileName), 0));
+        builder.appendLiteral(", \"iterations\": ");
+        builder.appendNumber(iterations);
+        appendTimesInMilliseconds(builder, "time", times);
+        appendTimesInMilliseconds(builder, "gcTime", gcTimes);
+        builder.append('}');
+    }
+    builder.append(']');
+
+    printf("%s\n", builder.toString().utf8().data());
+    return true;
+}
+
 #define RUNNING_FROM_XCODE 0
 
 static void runInteractive(GlobalObject* globalObject)
@@ -1028,6 +1128,8 @@ static NO_RETURN void printUsageStatement(bool help = false)
     fprintf(stderr, "  -s         Installs signal handlers that exit on a crash (Unix platforms only)\n");
 #endif
     fprintf(stderr, "  -p <file>  Outputs profiling data to a file\n");
+    fprintf(stderr, "  --sample   Samples the running code and prints the hottest functions on exit\n");
+    fprintf(stderr, "  --benchmark <n>  Runs each script once to warm up, then n more times, and prints the timings as JSON\n");
     fprintf(stderr, "  -x         Output exit code before terminating\n");
     fprintf(stderr, "\n");
     fprintf(stderr, "  --options                  Dumps all JSC VM options and exits\n");
@@ -1082,6 +1184,19 @@ void CommandLine::parseArguments(int argc, char** argv)
 #endif
             continue;
         }
+        if (!strcmp(arg, "--sample")) {
+            m_sample = true;
+            continue;
+        }
+        if (!strcmp(arg, "--benchmark")) {
+            if (++i == argc)
+                printUsageStatement();
+            int iterations = atoi(argv[i]);
+            if (iterations <= 0)
+                printUsageStatement();
+            m_benchmarkIterations = iterations;
+            continue;
+        }
         if (!strcmp(arg, "-x")) {
             m_exitCode = true;
             continue;
@@ -1139,9 +1254,15 @@ int jscmain(int argc, char** argv)
 
         if (options.m_profile && !vm->m_perBytecodeProfiler)
             vm->m_perBytecodeProfiler = adoptPtr(new Profiler::Database(*vm));
+        if (options.m_sample)
+            vm->ensureSamplingProfiler().start();
     
         GlobalObject* globalObject = GlobalObject::create(*vm, GlobalObject::createStructure(*vm, jsNull()), options.m_arguments);
-        bool success = runWithScripts(globalObject, options.m_scripts, options.m_dump);
+        bool success;
+        if (options.m_benchmarkIterations)
+            success = runBenchmark(globalObject, options.m_scripts, options.m_benchmarkIterations);
+        else
+            success = runWithScripts(globalObject, options.m_scripts, options.m_dump);
         if (options.m_interactive && success)
             runInteractive(globalObject);
 
@@ -1154,6 +1275,11 @@ int jscmain(int argc, char** argv)
             if (!vm->m_perBytecodeProfiler->save(options.m_profilerOutput.utf8().data()))
                 fprintf(stderr, "could not save profiler output.\n");
         }
+
+        if (SamplingProfiler* samplingProfiler = vm->samplingProfiler()) {
+            samplingProfiler->stop();
+            samplingProfiler->dump(WTF::dataFile());
+        }
     }
     
     return result;
@@ -129,9 +129,9 @@ public:
     int features() const { return m_scope.m_features; }
     int numConstants() const { return m_scope.m_numConstants; }
 
-    void appendToComma(CommaNode* commaNode, ExpressionNode* expr) { commaNode->append(expr); }
+    void appendToComma(CommaNode* commaNode, ExpressionNode* expr) { commaNode->append(m_vm, expr); }
 
-    CommaNode* createCommaExpr(const JSTokenLocation& location, ExpressionNode* lhs, ExpressionNode* rhs) { return new (m_vm) CommaNode(location, lhs, rhs); }
+    CommaNode* createCommaExpr(const JSTokenLocation& location, ExpressionNode* lhs, ExpressionNode* rhs) { return new (m_vm) CommaNode(m_vm, location, lhs, rhs); }
 
     ExpressionNode* makeAssignNode(const JSTokenLocation&, ExpressionNode* left, Operator, ExpressionNode* right, bool leftHasAssignments, bool rightHasAssignments, const JSTextPosition& start, const JSTextPosition& divot, const JSTextPosition& end);
     ExpressionNode* makePrefixNode(const JSTokenLocation&, ExpressionNode*, Operator, const JSTextPosition& start, const JSTextPosition& divot, const JSTextPosition& end);
@@ -558,10 +558,10 @@ public:
         if (!list)
             return init;
         if (list->isCommaNode()) {
-            static_cast<CommaNode*>(list)->append(init);
+            static_cast<CommaNode*>(list)->append(m_vm, init);
             return list;
         }
-        return new (m_vm) CommaNode(location, list, init);
+        return new (m_vm) CommaNode(m_vm, location, list, init);
     }
 
     int evalCount() const { return m_evalCount; }
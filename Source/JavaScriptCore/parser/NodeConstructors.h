@@ -57,6 +57,7 @@ namespace JSC {
     inline StatementNode::StatementNode(const JSTokenLocation& location)
         : Node(location)
         , m_lastLine(-1)
+        , m_next(0)
     {
     }
 
@@ -615,22 +616,30 @@ inline ResolveNode::ResolveNode(const JSTokenLocation& location, const Identifie
     {
     }
 
-    inline CommaNode::CommaNode(const JSTokenLocation& location, ExpressionNode* expr1, ExpressionNode* expr2)
+    inline CommaNode::CommaNode(VM* vm, const JSTokenLocation& location, ExpressionNode* expr1, ExpressionNode* expr2)
         : ExpressionNode(location)
     {
         ASSERT(expr1);
         ASSERT(expr2);
-        m_expressions.append(expr1);
-        m_expressions.append(expr2);
+        m_head = new (vm) Entry(expr1);
+        m_tail = m_head->next = new (vm) Entry(expr2);
+    }
+
+    inline void CommaNode::append(VM* vm, ExpressionNode* expr)
+    {
+        ASSERT(expr);
+        m_tail = m_tail->next = new (vm) Entry(expr);
     }
 
-    inline ConstStatementNode::ConstStatementNode(const JSTokenLocation& location, ConstDeclNode* next)
+    inline ConstStatementNode::ConstStatementNode(const JSTokenLocation& location, ConstDeclNode* declarations)
         : StatementNode(location)
-        , m_next(next)
+        , m_declarations(declarations)
     {
     }
 
     inline SourceElements::SourceElements()
+        : m_head(0)
+        , m_tail(0)
     {
     }
 
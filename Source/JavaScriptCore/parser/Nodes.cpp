@@ -65,13 +65,19 @@ void SourceElements::append(StatementNode* statement)
 {
     if (statement->isEmptyStatement())
         return;
-    m_statements.append(statement);
+
+    if (!m_tail) {
+        m_head = m_tail = statement;
+        return;
+    }
+
+    m_tail->setNext(statement);
+    m_tail = statement;
 }
 
 StatementNode* SourceElements::singleStatement() const
 {
-    size_t size = m_statements.size();
-    return size == 1 ? m_statements[0] : 0;
+    return m_head == m_tail ? m_head : 0;
 }
 
 // ------------------------------ ScopeNode -----------------------------
@@ -181,6 +187,23 @@ FunctionParameters::FunctionParameters(ParameterNode* firstParameter, unsigned s
     }
 }
 
+PassRefPtr<FunctionParameters> FunctionParameters::create(const Vector<RefPtr<DeconstructionPatternNode>>& parameters)
+{
+    size_t objectSize = sizeof(FunctionParameters) - sizeof(void*) + sizeof(DeconstructionPatternNode*) * parameters.size();
+    void* slot = fastMalloc(objectSize);
+    return adoptRef(new (slot) FunctionParameters(parameters));
+}
+
+FunctionParameters::FunctionParameters(const Vector<RefPtr<DeconstructionPatternNode>>& parameters)
+    : m_size(parameters.size())
+{
+    for (unsigned i = 0; i < m_size; ++i) {
+        DeconstructionPatternNode* pattern = parameters[i].get();
+        pattern->ref();
+        patterns()[i] = pattern;
+    }
+}
+
 FunctionParameters::~FunctionParameters()
 {
     for (unsigned i = 0; i < m_size; ++i)
@@ -193,8 +193,12 @@ namespace JSC {
         virtual bool isContinue() const { return false; }
         virtual bool isBlock() const { return false; }
 
+        StatementNode* next() const { return m_next; }
+        void setNext(StatementNode* next) { m_next = next; }
+
     protected:
         int m_lastLine;
+        StatementNode* m_next;
     };
 
     class ConstantNode : public ExpressionNode {
@@ -1094,21 +1098,30 @@ namespace JSC {
         virtual RegisterID* emitBytecode(BytecodeGenerator&, RegisterID* = 0) override;
     };
     
-    typedef Vector<ExpressionNode*, 8> ExpressionVector;
-
-    class CommaNode : public ExpressionNode, public ParserArenaDeletable {
+    class CommaNode : public ExpressionNode {
     public:
-        CommaNode(const JSTokenLocation&, ExpressionNode* expr1, ExpressionNode* expr2);
+        CommaNode(VM*, const JSTokenLocation&, ExpressionNode* expr1, ExpressionNode* expr2);
 
-        using ParserArenaDeletable::operator new;
-
-        void append(ExpressionNode* expr) { ASSERT(expr); m_expressions.append(expr); }
+        void append(VM*, ExpressionNode*);
 
     private:
+        // The list lives in the arena, so CommaNode needs no destructor.
+        struct Entry : public ParserArenaFreeable {
+            Entry(ExpressionNode* expression)
+                : expression(expression)
+                , next(0)
+            {
+            }
+
+            ExpressionNode* expression;
+            Entry* next;
+        };
+
         virtual bool isCommaNode() const override { return true; }
         virtual RegisterID* emitBytecode(BytecodeGenerator&, RegisterID* = 0) override;
 
-        ExpressionVector m_expressions;
+        Entry* m_head;
+        Entry* m_tail;
     };
     
     class ConstDeclNode : public ExpressionNode {
@@ -1133,15 +1146,15 @@ namespace JSC {
 
     class ConstStatementNode : public StatementNode {
     public:
-        ConstStatementNode(const JSTokenLocation&, ConstDeclNode* next);
+        ConstStatementNode(const JSTokenLocation&, ConstDeclNode* declarations);
 
     private:
         virtual void emitBytecode(BytecodeGenerator&, RegisterID* = 0) override;
 
-        ConstDeclNode* m_next;
+        ConstDeclNode* m_declarations;
     };
 
-    class SourceElements : public ParserArenaDeletable {
+    class SourceElements : public ParserArenaFreeable {
     public:
         SourceElements();
 
@@ -1153,7 +1166,10 @@ namespace JSC {
         void emitBytecode(BytecodeGenerator&, RegisterID* destination);
 
     private:
-        Vector<StatementNode*> m_statements;
+        // Statements are chained through StatementNode::next(), so SourceElements
+        // needs no destructor.
+        StatementNode* m_head;
+        StatementNode* m_tail;
     };
 
     class BlockNode : public StatementNode {
@@ -1513,6 +1529,7 @@ namespace JSC {
         WTF_MAKE_NONCOPYABLE(FunctionParameters);
     public:
         static PassRefPtr<FunctionParameters> create(ParameterNode*);
+        static PassRefPtr<FunctionParameters> create(const Vector<RefPtr<DeconstructionPatternNode>>&);
         ~FunctionParameters();
 
         unsigned size() const { return m_size; }
@@ -1520,6 +1537,7 @@ namespace JSC {
 
     private:
         FunctionParameters(ParameterNode*, unsigned size);
+        explicit FunctionParameters(const Vector<RefPtr<DeconstructionPatternNode>>&);
 
         DeconstructionPatternNode** patterns() { return &m_storage; }
 
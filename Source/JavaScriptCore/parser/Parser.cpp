@@ -214,7 +214,12 @@ Parser<LexerType>::Parser(VM* vm, const SourceCode& source, FunctionParameters*
     m_token.m_location.startOffset = source.startOffset();
     m_token.m_location.endOffset = source.startOffset();
     m_token.m_location.lineStartOffset = source.startOffset();
-    m_functionCache = vm->addSourceProviderCache(source.provider());
+    // A program's strictness is fully determined by its text and the strictness it is parsed
+    // with, so its cached function information can be shared with other identical programs.
+    VM::SourceProviderCacheSharing cacheSharing = VM::DontShareSourceProviderCache;
+    if (parserMode == JSParseProgramCode && strictness != JSParseBuiltin)
+        cacheSharing = strictness == JSParseStrict ? VM::ShareStrictSourceProviderCache : VM::ShareNonStrictSourceProviderCache;
+    m_functionCache = vm->addSourceProviderCache(source.provider(), cacheSharing);
     ScopeRef scope = pushScope();
     if (parserMode == JSParseFunctionCode)
         scope->setIsFunction();
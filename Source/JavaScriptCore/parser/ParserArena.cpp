@@ -38,7 +38,7 @@ ParserArena::ParserArena()
 {
 }
 
-inline void* ParserArena::freeablePool()
+inline void* ParserArena::freeablePool() const
 {
     ASSERT(m_freeablePoolEnd);
     return m_freeablePoolEnd - freeablePoolSize;
@@ -80,14 +80,18 @@ void ParserArena::removeLast()
 
 void ParserArena::reset()
 {
-    // Since this code path is used only when parsing fails, it's not bothering to reuse
-    // any of the memory the arena allocated. We could improve that later if we want to
-    // efficiently reuse the same arena.
+    // Keep the most recent pool around so that reparsing into the same arena does not
+    // have to go back to the allocator for its first pool.
+    size_t size = m_deletableObjects.size();
+    for (size_t i = 0; i < size; ++i)
+        m_deletableObjects[i]->~ParserArenaDeletable();
 
-    deallocateObjects();
+    size = m_freeablePools.size();
+    for (size_t i = 0; i < size; ++i)
+        fastFree(m_freeablePools[i]);
 
-    m_freeableMemory = 0;
-    m_freeablePoolEnd = 0;
+    if (m_freeablePoolEnd)
+        m_freeableMemory = static_cast<char*>(freeablePool());
     if (m_identifierArena)
         m_identifierArena->clear();
     m_freeablePools.clear();
@@ -108,7 +112,7 @@ void ParserArena::allocateFreeablePool()
 
 bool ParserArena::isEmpty() const
 {
-    return !m_freeablePoolEnd
+    return (!m_freeablePoolEnd || m_freeableMemory == freeablePool())
         && (!m_identifierArena || m_identifierArena->isEmpty())
         && m_freeablePools.isEmpty()
         && m_deletableObjects.isEmpty()
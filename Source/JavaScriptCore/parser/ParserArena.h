@@ -177,7 +177,7 @@ namespace JSC {
             return (size + sizeof(WTF::AllocAlignmentInteger) - 1) & ~(sizeof(WTF::AllocAlignmentInteger) - 1);
         }
 
-        void* freeablePool();
+        void* freeablePool() const;
         void allocateFreeablePool();
         void deallocateObjects();
 
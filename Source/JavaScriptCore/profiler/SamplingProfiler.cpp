@@ -0,0 +1,329 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "config.h"
+#include "SamplingProfiler.h"
+
+#include "CallFrame.h"
+#include "CallFrameInlines.h"
+#include "CodeBlock.h"
+#include "CodeBlockSet.h"
+#include "Heap.h"
+#include "JSCInlines.h"
+#include "Options.h"
+#include "VM.h"
+#include <algorithm>
+#include <wtf/StackBounds.h>
+#include <wtf/WTFThreadData.h>
+#include <wtf/StringPrintStream.h>
+
+#if OS(DARWIN)
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+namespace JSC {
+
+// The sampler thread can't grow its buffers while the JS thread is suspended,
+// so they are sized up front: enough for a few seconds of deep stacks between
+// two collections. Samples that don't fit are counted and dropped.
+static const unsigned maxFramesPerSample = 128;
+static const unsigned maxFramesWalkedPerSample = 1024;
+static const unsigned unprocessedStackTraceCapacity = 8192;
+static const unsigned unprocessedFrameCapacity = 256 * 1024;
+
+SamplingProfiler::SamplingProfiler(VM& vm)
+    : m_vm(vm)
+    , m_isRunning(false)
+    , m_shouldStop(false)
+    , m_intervalInMicroseconds(std::max(Options::sampleIntervalInMicroseconds(), 1u))
+    , m_timerThread(0)
+#if OS(DARWIN)
+    , m_jsThread(MACH_PORT_NULL)
+#endif
+    , m_stackLow(0)
+    , m_stackHigh(0)
+    , m_droppedSampleCount(0)
+    , m_sampleCount(0)
+{
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    stop();
+}
+
+void SamplingProfiler::start()
+{
+    ASSERT(m_vm.currentThreadIsHoldingAPILock());
+    if (m_isRunning)
+        return;
+
+#if OS(DARWIN)
+    const StackBounds& stack = wtfThreadData().stack();
+    m_stackHigh = static_cast<char*>(stack.origin());
+    m_stackLow = m_stackHigh - stack.size();
+    m_jsThread = pthread_mach_thread_np(pthread_self());
+
+    m_unprocessedFrames.reserveCapacity(unprocessedFrameCapacity);
+    m_unprocessedStackTraces.reserveCapacity(unprocessedStackTraceCapacity);
+
+    m_shouldStop = false;
+    m_isRunning = true;
+    m_timerThread = createThread(threadEntryPoint, this, "JavaScriptCore::SamplingProfiler");
+#else
+    dataLog("The sampling profiler is not supported on this platform.\n");
+#endif
+}
+
+void SamplingProfiler::stop()
+{
+    if (!m_isRunning)
+        return;
+
+    m_shouldStop = true;
+    waitForThreadCompletion(m_timerThread);
+    m_timerThread = 0;
+    m_isRunning = false;
+}
+
+void SamplingProfiler::threadEntryPoint(void* profiler)
+{
+    static_cast<SamplingProfiler*>(profiler)->timerLoop();
+}
+
+void SamplingProfiler::timerLoop()
+{
+#if OS(DARWIN)
+    while (!m_shouldStop) {
+        usleep(m_intervalInMicroseconds);
+        takeSample();
+    }
+#endif
+}
+
+#if OS(DARWIN)
+static bool framePointerOfSuspendedThread(mach_port_t thread, void*& framePointer)
+{
+#if CPU(X86_64)
+    x86_thread_state64_t state;
+    mach_msg_type_number_t count = x86_THREAD_STATE64_COUNT;
+    thread_state_flavor_t flavor = x86_THREAD_STATE64;
+#elif CPU(X86)
+    i386_thread_state_t state;
+    mach_msg_type_number_t count = i386_THREAD_STATE_COUNT;
+    thread_state_flavor_t flavor = i386_THREAD_STATE;
+#elif CPU(ARM64)
+    arm_thread_state64_t state;
+    mach_msg_type_number_t count = ARM_THREAD_STATE64_COUNT;
+    thread_state_flavor_t flavor = ARM_THREAD_STATE64;
+#elif CPU(ARM)
+    arm_thread_state_t state;
+    mach_msg_type_number_t count = ARM_THREAD_STATE_COUNT;
+    thread_state_flavor_t flavor = ARM_THREAD_STATE;
+#else
+    UNUSED_PARAM(thread);
+    UNUSED_PARAM(framePointer);
+    return false;
+#endif
+
+#if CPU(X86_64) || CPU(X86) || CPU(ARM64) || CPU(ARM)
+    if (thread_get_state(thread, flavor, reinterpret_cast<thread_state_t>(&state), &count) != KERN_SUCCESS)
+        return false;
+
+#if CPU(X86_64)
+    framePointer = reinterpret_cast<void*>(state.__rbp);
+#elif CPU(X86)
+    framePointer = reinterpret_cast<void*>(state.__ebp);
+#elif CPU(ARM64)
+    framePointer = reinterpret_cast<void*>(state.__fp);
+#elif CPU(ARM)
+    framePointer = reinterpret_cast<void*>(state.__r[7]);
+#endif
+    return true;
+#endif
+}
+#endif // OS(DARWIN)
+
+void SamplingProfiler::takeSample()
+{
+#if OS(DARWIN)
+    MutexLocker locker(m_lock);
+
+    if (m_unprocessedStackTraces.size() == m_unprocessedStackTraces.capacity()
+        || m_unprocessedFrames.capacity() - m_unprocessedFrames.size() < maxFramesPerSample) {
+        ++m_droppedSampleCount;
+        return;
+    }
+
+    if (thread_suspend(m_jsThread) != KERN_SUCCESS)
+        return;
+
+    // Nothing below may allocate or take a lock. The frame pointer chain also
+    // runs through C++ frames, whose CodeBlock slots hold whatever happens to
+    // be there; those are weeded out when the trace is processed. Every read
+    // is bounds checked against the JS thread's stack, and the walk only moves
+    // towards older frames, so a bogus chain just ends the trace early.
+    void* framePointer;
+    if (framePointerOfSuspendedThread(m_jsThread, framePointer)) {
+        UnprocessedStackTrace trace;
+        trace.firstFrame = m_unprocessedFrames.size();
+        trace.frameCount = 0;
+
+        char* frame = static_cast<char*>(framePointer);
+        for (unsigned walked = 0; walked < maxFramesWalkedPerSample && trace.frameCount < maxFramesPerSample; ++walked) {
+            if (frame < m_stackLow || frame + JSStack::CallFrameHeaderSize * sizeof(Register) > m_stackHigh)
+                break;
+            if (reinterpret_cast<uintptr_t>(frame) % sizeof(void*))
+                break;
+
+            CallFrame* callFrame = reinterpret_cast<CallFrame*>(frame);
+            CallFrame* callerFrame;
+            if (callFrame->isVMEntrySentinel())
+                callerFrame = callFrame->vmEntrySentinelCallerFrame();
+            else {
+                if (void* codeBlock = callFrame->codeBlock()) {
+                    UnprocessedStackFrame stackFrame;
+                    stackFrame.codeBlock = codeBlock;
+                    stackFrame.locationBits = callFrame->locationAsRawBits();
+                    m_unprocessedFrames.uncheckedAppend(stackFrame);
+                    ++trace.frameCount;
+                }
+                callerFrame = callFrame->callerFrame();
+            }
+
+            char* next = reinterpret_cast<char*>(callerFrame);
+            if (next <= frame)
+                break;
+            frame = next;
+        }
+
+        if (trace.frameCount)
+            m_unprocessedStackTraces.uncheckedAppend(trace);
+    }
+
+    thread_resume(m_jsThread);
+#endif
+}
+
+void SamplingProfiler::processUnverifiedStackTraces()
+{
+    ASSERT(m_vm.currentThreadIsHoldingAPILock());
+    MutexLocker locker(m_lock);
+
+    for (unsigned i = 0; i < m_unprocessedStackTraces.size(); ++i)
+        processStackTrace(m_unprocessedStackTraces[i]);
+
+    // Keep the capacity; the sampler thread appends without allocating.
+    m_unprocessedStackTraces.shrink(0);
+    m_unprocessedFrames.shrink(0);
+}
+
+void SamplingProfiler::processStackTrace(const UnprocessedStackTrace& trace)
+{
+    CodeBlockSet& codeBlocks = m_vm.heap.codeBlockSet();
+    HashSet<String> seenInTrace;
+    bool isTopFrame = true;
+
+    for (unsigned i = 0; i < trace.frameCount; ++i) {
+        const UnprocessedStackFrame& frame = m_unprocessedFrames[trace.firstFrame + i];
+        if (!codeBlocks.contains(frame.codeBlock))
+            continue;
+
+        CodeBlock* codeBlock = static_cast<CodeBlock*>(frame.codeBlock);
+        JITCode::JITType jitType = codeBlock->jitType();
+
+        // Optimized code only stores a code origin index in the frame at call
+        // sites and OSR exits, so for a sample taken in straight-line code the
+        // inlined frames are those of the last call the machine frame made.
+        if (CallFrame::Location::isCodeOriginIndex(frame.locationBits)) {
+            unsigned index = CallFrame::Location::decode(frame.locationBits);
+            if (codeBlock->canGetCodeOrigin(index)) {
+                for (InlineCallFrame* inlineCallFrame = codeBlock->codeOrigin(index).inlineCallFrame; inlineCallFrame; inlineCallFrame = inlineCallFrame->caller.inlineCallFrame) {
+                    addSample(toCString(inlineCallFrame->inferredName(), "#", inlineCallFrame->hashAsStringIfPossible()), jitType, true, isTopFrame, seenInTrace);
+                    isTopFrame = false;
+                }
+            }
+        }
+
+        addSample(toCString(codeBlock->inferredName(), "#", codeBlock->hashAsStringIfPossible()), jitType, false, isTopFrame, seenInTrace);
+        isTopFrame = false;
+    }
+
+    if (!isTopFrame)
+        ++m_sampleCount;
+}
+
+void SamplingProfiler::addSample(const CString& function, JITCode::JITType jitType, bool isInlined, bool isTopFrame, HashSet<String>& seenInTrace)
+{
+    String key = toString(function, " ", jitType, isInlined ? " (inlined)" : "");
+    HashMap<String, Entry>::AddResult result = m_entries.add(key, Entry());
+    Entry& entry = result.iterator->value;
+    if (result.isNewEntry) {
+        entry.function = function;
+        entry.jitType = jitType;
+        entry.isInlined = isInlined;
+    }
+
+    if (isTopFrame)
+        ++entry.selfSamples;
+    if (seenInTrace.add(key).isNewEntry)
+        ++entry.totalSamples;
+}
+
+Vector<SamplingProfiler::Entry> SamplingProfiler::entries()
+{
+    processUnverifiedStackTraces();
+
+    Vector<Entry> result;
+    result.reserveInitialCapacity(m_entries.size());
+    for (HashMap<String, Entry>::iterator iter = m_entries.begin(); iter != m_entries.end(); ++iter)
+        result.uncheckedAppend(iter->value);
+
+    std::sort(result.begin(), result.end(), [] (const Entry& a, const Entry& b) {
+        if (a.selfSamples != b.selfSamples)
+            return a.selfSamples > b.selfSamples;
+        return a.totalSamples > b.totalSamples;
+    });
+    return result;
+}
+
+void SamplingProfiler::dump(PrintStream& out, unsigned maxEntries)
+{
+    Vector<Entry> entries = this->entries();
+
+    out.print("Sampling profile: ", m_sampleCount, " samples with JavaScript on the stack");
+    if (m_droppedSampleCount)
+        out.print(", ", m_droppedSampleCount, " dropped");
+    out.print(", every ", m_intervalInMicroseconds, " us.\n");
+    out.print("    self   total  function\n");
+
+    for (unsigned i = 0; i < entries.size() && i < maxEntries; ++i) {
+        const Entry& entry = entries[i];
+        out.printf("  %6u  %6u  ", entry.selfSamples, entry.totalSamples);
+        out.print(entry.function, " [", entry.jitType, entry.isInlined ? ", inlined" : "", "]\n");
+    }
+}
+
+} // namespace JSC
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef SamplingProfiler_h
+#define SamplingProfiler_h
+
+#include "JITCode.h"
+#include <wtf/HashMap.h>
+#include <wtf/HashSet.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/PrintStream.h>
+#include <wtf/Threading.h>
+#include <wtf/ThreadingPrimitives.h>
+#include <wtf/Vector.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/WTFString.h>
+
+#if OS(DARWIN)
+#include <mach/mach.h>
+#endif
+
+namespace JSC {
+
+class VM;
+
+// Periodically suspends the thread that runs JavaScript and records which
+// CodeBlocks are on its stack. Unlike LegacyProfiler, nothing is hooked into
+// calls and returns, so the program is compiled and tiered up exactly as it
+// would be without the profiler.
+//
+// While the JS thread is suspended the sampler thread only copies frame words
+// off its stack into preallocated buffers; it never allocates and never reads
+// the heap, since the suspended thread may hold the malloc or heap locks.
+// Those raw frames are checked against the heap's CodeBlockSet and resolved to
+// functions, tiers and inlined frames later, on the JS thread with the API
+// lock held, before any CodeBlock that they could name is deleted.
+class SamplingProfiler {
+    WTF_MAKE_NONCOPYABLE(SamplingProfiler);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    struct Entry {
+        Entry()
+            : jitType(JITCode::None)
+            , isInlined(false)
+            , selfSamples(0)
+            , totalSamples(0)
+        {
+        }
+
+        CString function; // inferredName#hash
+        JITCode::JITType jitType;
+        bool isInlined;
+        unsigned selfSamples; // Samples where this was the innermost JS frame.
+        unsigned totalSamples; // Samples where this was anywhere on the stack.
+    };
+
+    SamplingProfiler(VM&);
+    JS_EXPORT_PRIVATE ~SamplingProfiler();
+
+    // Samples the calling thread, which must be the one that runs this VM's
+    // JavaScript, until stop() is called. Sampling is only supported on Darwin;
+    // elsewhere this is a no-op.
+    JS_EXPORT_PRIVATE void start();
+    JS_EXPORT_PRIVATE void stop();
+    bool isRunning() const { return m_isRunning; }
+
+    // Must be called with the API lock held. The heap calls this before it
+    // deletes CodeBlocks.
+    void processUnverifiedStackTraces();
+
+    // Both of these process any pending samples first. Entries are sorted by
+    // decreasing self samples.
+    JS_EXPORT_PRIVATE Vector<Entry> entries();
+    JS_EXPORT_PRIVATE void dump(PrintStream&, unsigned maxEntries = 50);
+
+    unsigned sampleCount() const { return m_sampleCount; }
+
+private:
+    struct UnprocessedStackFrame {
+        void* codeBlock;
+        unsigned locationBits;
+    };
+
+    struct UnprocessedStackTrace {
+        unsigned firstFrame;
+        unsigned frameCount;
+    };
+
+    static void threadEntryPoint(void*);
+    void timerLoop();
+    void takeSample();
+
+    void processStackTrace(const UnprocessedStackTrace&);
+    void addSample(const CString& function, JITCode::JITType, bool isInlined, bool isTopFrame, HashSet<String>& seenInTrace);
+
+    VM& m_vm;
+    bool m_isRunning;
+    volatile bool m_shouldStop;
+    unsigned m_intervalInMicroseconds;
+    ThreadIdentifier m_timerThread;
+
+#if OS(DARWIN)
+    mach_port_t m_jsThread;
+#endif
+    char* m_stackLow;
+    char* m_stackHigh;
+
+    // Held by the sampler thread while it has the JS thread suspended, and by
+    // the JS thread while it drains the buffers below.
+    Mutex m_lock;
+    Vector<UnprocessedStackFrame> m_unprocessedFrames;
+    Vector<UnprocessedStackTrace> m_unprocessedStackTraces;
+    unsigned m_droppedSampleCount;
+
+    HashMap<String, Entry> m_entries;
+    unsigned m_sampleCount;
+};
+
+} // namespace JSC
+
+#endif // SamplingProfiler_h
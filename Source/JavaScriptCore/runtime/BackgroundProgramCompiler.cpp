@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "config.h"
+#include "BackgroundProgramCompiler.h"
+
+#include "CodeCache.h"
+#include "Executable.h"
+#include "JSCInlines.h"
+#include "JSGlobalObject.h"
+#include "JSLock.h"
+#include "ParserError.h"
+#include "PersistentCodeCache.h"
+#include "SourceCode.h"
+#include "StrongInlines.h"
+#include "UnlinkedCodeBlock.h"
+#include <mutex>
+#include <wtf/Deque.h>
+
+namespace JSC {
+
+class BackgroundProgramCompiler {
+    WTF_MAKE_NONCOPYABLE(BackgroundProgramCompiler);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static BackgroundProgramCompiler& shared();
+
+    void enqueue(PassRefPtr<BackgroundProgramCompilation>);
+
+private:
+    BackgroundProgramCompiler();
+
+    static void threadFunction(void*);
+    void runThread();
+
+    Mutex m_lock;
+    ThreadCondition m_compilationEnqueued;
+    Deque<RefPtr<BackgroundProgramCompilation>> m_queue;
+};
+
+BackgroundProgramCompiler& BackgroundProgramCompiler::shared()
+{
+    static BackgroundProgramCompiler* compiler;
+    static std::once_flag onceFlag;
+    std::call_once(onceFlag, [] {
+        compiler = new BackgroundProgramCompiler;
+    });
+    return *compiler;
+}
+
+BackgroundProgramCompiler::BackgroundProgramCompiler()
+{
+    ThreadIdentifier identifier = createThread(threadFunction, this, "JSC Background Program Compiler");
+    detachThread(identifier);
+}
+
+void BackgroundProgramCompiler::enqueue(PassRefPtr<BackgroundProgramCompilation> compilation)
+{
+    MutexLocker locker(m_lock);
+    m_queue.append(compilation);
+    m_compilationEnqueued.signal();
+}
+
+void BackgroundProgramCompiler::threadFunction(void* argument)
+{
+    static_cast<BackgroundProgramCompiler*>(argument)->runThread();
+}
+
+void BackgroundProgramCompiler::runThread()
+{
+    RefPtr<VM> vm = VM::create(SmallHeap);
+    Strong<JSGlobalObject> globalObject;
+    {
+        JSLockHolder locker(vm.get());
+        globalObject.set(*vm, JSGlobalObject::create(*vm, JSGlobalObject::createStructure(*vm, jsNull())));
+    }
+
+    while (true) {
+        RefPtr<BackgroundProgramCompilation> compilation;
+        {
+            MutexLocker locker(m_lock);
+            while (m_queue.isEmpty())
+                m_compilationEnqueued.wait(m_lock);
+            compilation = m_queue.takeFirst();
+        }
+
+        // Nobody is waiting for this program any more.
+        if (compilation->hasOneRef())
+            continue;
+
+        JSLockHolder locker(vm.get());
+        compilation->run(*vm, globalObject.get());
+    }
+}
+
+PassRefPtr<BackgroundProgramCompilation> BackgroundProgramCompilation::start(const String& source, CompletionHandler completionHandler)
+{
+    RefPtr<BackgroundProgramCompilation> compilation = adoptRef(new BackgroundProgramCompilation(source, completionHandler));
+    BackgroundProgramCompiler::shared().enqueue(compilation);
+    return compilation.release();
+}
+
+BackgroundProgramCompilation::BackgroundProgramCompilation(const String& source, CompletionHandler completionHandler)
+    : m_source(source)
+    , m_isolatedSource(source.isolatedCopy())
+    , m_completionHandler(completionHandler)
+    , m_isFinished(false)
+{
+}
+
+BackgroundProgramCompilation::~BackgroundProgramCompilation()
+{
+}
+
+bool BackgroundProgramCompilation::isFinished() const
+{
+    MutexLocker locker(m_lock);
+    return m_isFinished;
+}
+
+void BackgroundProgramCompilation::run(VM& vm, JSGlobalObject* globalObject)
+{
+    SourceCode source = makeSource(m_isolatedSource);
+    ProgramExecutable* executable = ProgramExecutable::create(globalObject->globalExec(), source);
+    ParserError error;
+    Vector<uint8_t> encodedCodeBlock;
+    if (UnlinkedProgramCodeBlock* codeBlock = vm.codeCache()->getProgramCodeBlock(vm, executable, source, JSParseNormal, DebuggerOff, ProfilerOff, error))
+        PersistentCodeCache::encode(codeBlock, encodedCodeBlock);
+
+    // The result lives on in encoded form; don't let this VM's cache keep every program alive.
+    vm.codeCache()->clear();
+    m_isolatedSource = String();
+
+    {
+        MutexLocker locker(m_lock);
+        m_encodedCodeBlock.swap(encodedCodeBlock);
+        m_isFinished = true;
+    }
+
+    CompletionHandler completionHandler;
+    std::swap(completionHandler, m_completionHandler);
+    if (completionHandler)
+        completionHandler();
+}
+
+bool BackgroundProgramCompilation::install(VM& vm)
+{
+    ASSERT(isFinished());
+    ASSERT(vm.currentThreadIsHoldingAPILock());
+
+    if (m_encodedCodeBlock.isEmpty())
+        return false;
+
+    UnlinkedProgramCodeBlock* codeBlock = PersistentCodeCache::decode(vm, m_encodedCodeBlock.data(), m_encodedCodeBlock.size());
+    m_encodedCodeBlock.clear();
+    if (!codeBlock)
+        return false;
+
+    vm.codeCache()->addProgramCodeBlock(vm, makeSource(m_source), JSParseNormal, codeBlock);
+    return true;
+}
+
+} // namespace JSC
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef BackgroundProgramCompiler_h
+#define BackgroundProgramCompiler_h
+
+#include <functional>
+#include <wtf/PassRefPtr.h>
+#include <wtf/ThreadSafeRefCounted.h>
+#include <wtf/Threading.h>
+#include <wtf/Vector.h>
+#include <wtf/text/WTFString.h>
+
+namespace JSC {
+
+class JSGlobalObject;
+class VM;
+
+// Parses and generates bytecode for a large program on a background thread,
+// so that the thread that will eventually run it only has to link the result.
+// The background thread has its own VM; the unlinked code block is handed
+// back in the serialized form used by PersistentCodeCache, and install()
+// decodes it into the target VM's CodeCache. Evaluating the same source
+// afterwards then takes the CodeCache hit path instead of the parser.
+class BackgroundProgramCompilation : public ThreadSafeRefCounted<BackgroundProgramCompilation> {
+public:
+    typedef std::function<void ()> CompletionHandler;
+
+    // The completion handler runs on the background thread once compilation
+    // has finished, whether or not it succeeded. If every other reference to
+    // the compilation is dropped before it is started, it is skipped.
+    JS_EXPORT_PRIVATE static PassRefPtr<BackgroundProgramCompilation> start(const String& source, CompletionHandler);
+    JS_EXPORT_PRIVATE ~BackgroundProgramCompilation();
+
+    JS_EXPORT_PRIVATE bool isFinished() const;
+
+    // Must be called on the starting thread with the VM's lock held, after
+    // isFinished() returns true. Returns false if nothing could be installed,
+    // in which case the program is parsed as usual when it is evaluated.
+    JS_EXPORT_PRIVATE bool install(VM&);
+
+private:
+    friend class BackgroundProgramCompiler;
+
+    BackgroundProgramCompilation(const String& source, CompletionHandler);
+
+    void run(VM&, JSGlobalObject*);
+
+    String m_source; // Only used by the starting thread.
+    String m_isolatedSource; // Only used by the background thread.
+    CompletionHandler m_completionHandler;
+
+    mutable Mutex m_lock;
+    bool m_isFinished;
+    Vector<uint8_t> m_encodedCodeBlock;
+};
+
+} // namespace JSC
+
+#endif // BackgroundProgramCompiler_h
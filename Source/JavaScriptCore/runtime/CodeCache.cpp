@@ -31,6 +31,7 @@
 #include "CodeSpecializationKind.h"
 #include "JSCInlines.h"
 #include "Parser.h"
+#include "PersistentCodeCache.h"
 #include "StrongInlines.h"
 #include "UnlinkedCodeBlock.h"
 
@@ -55,6 +56,7 @@ void CodeCacheMap::pruneSlowCase()
 }
 
 CodeCache::CodeCache()
+    : m_persistentCache(PersistentCodeCache::create(Options::diskCodeCachePath()))
 {
 }
 
@@ -67,11 +69,25 @@ template <typename T> struct CacheTypes { };
 template <> struct CacheTypes<UnlinkedProgramCodeBlock> {
     typedef JSC::ProgramNode RootNode;
     static const SourceCodeKey::CodeType codeType = SourceCodeKey::ProgramType;
+
+    static UnlinkedProgramCodeBlock* loadPersistent(PersistentCodeCache* persistentCache, VM& vm, const SourceCodeKey& key)
+    {
+        return persistentCache->load(vm, key);
+    }
+
+    static void storePersistent(PersistentCodeCache* persistentCache, VM& vm, const SourceCodeKey& key, UnlinkedProgramCodeBlock* codeBlock)
+    {
+        persistentCache->store(vm, key, codeBlock);
+    }
 };
 
 template <> struct CacheTypes<UnlinkedEvalCodeBlock> {
     typedef JSC::EvalNode RootNode;
     static const SourceCodeKey::CodeType codeType = SourceCodeKey::EvalType;
+
+    // Eval code is too transient to be worth persisting.
+    static UnlinkedEvalCodeBlock* loadPersistent(PersistentCodeCache*, VM&, const SourceCodeKey&) { return 0; }
+    static void storePersistent(PersistentCodeCache*, VM&, const SourceCodeKey&, UnlinkedEvalCodeBlock*) { }
 };
 
 template <class UnlinkedCodeBlockType, class ExecutableType>
@@ -80,7 +96,14 @@ UnlinkedCodeBlockType* CodeCache::getGlobalCodeBlock(VM& vm, ExecutableType* exe
     SourceCodeKey key = SourceCodeKey(source, String(), CacheTypes<UnlinkedCodeBlockType>::codeType, strictness);
     CodeCacheMap::AddResult addResult = m_sourceCode.add(key, SourceCodeValue());
     bool canCache = debuggerMode == DebuggerOff && profilerMode == ProfilerOff;
-    if (!addResult.isNewEntry && canCache) {
+    bool isCached = !addResult.isNewEntry;
+    if (!isCached && canCache && m_persistentCache) {
+        if (UnlinkedCodeBlockType* unlinkedCodeBlock = CacheTypes<UnlinkedCodeBlockType>::loadPersistent(m_persistentCache.get(), vm, key)) {
+            addResult.iterator->value = SourceCodeValue(vm, unlinkedCodeBlock, m_sourceCode.age());
+            isCached = true;
+        }
+    }
+    if (isCached && canCache) {
         UnlinkedCodeBlockType* unlinkedCodeBlock = jsCast<UnlinkedCodeBlockType*>(addResult.iterator->value.cell.get());
         unsigned firstLine = source.firstLine() + unlinkedCodeBlock->firstLine();
         unsigned lineCount = unlinkedCodeBlock->lineCount();
@@ -121,6 +144,8 @@ UnlinkedCodeBlockType* CodeCache::getGlobalCodeBlock(VM& vm, ExecutableType* exe
     }
 
     addResult.iterator->value = SourceCodeValue(vm, unlinkedCodeBlock, m_sourceCode.age());
+    if (m_persistentCache)
+        CacheTypes<UnlinkedCodeBlockType>::storePersistent(m_persistentCache.get(), vm, key, unlinkedCodeBlock);
     return unlinkedCodeBlock;
 }
 
@@ -129,6 +154,14 @@ UnlinkedProgramCodeBlock* CodeCache::getProgramCodeBlock(VM& vm, ProgramExecutab
     return getGlobalCodeBlock<UnlinkedProgramCodeBlock>(vm, executable, source, strictness, debuggerMode, profilerMode, error);
 }
 
+void CodeCache::addProgramCodeBlock(VM& vm, const SourceCode& source, JSParserStrictness strictness, UnlinkedProgramCodeBlock* unlinkedCodeBlock)
+{
+    SourceCodeKey key = SourceCodeKey(source, String(), SourceCodeKey::ProgramType, strictness);
+    CodeCacheMap::AddResult addResult = m_sourceCode.add(key, SourceCodeValue());
+    if (addResult.isNewEntry)
+        addResult.iterator->value = SourceCodeValue(vm, unlinkedCodeBlock, m_sourceCode.age());
+}
+
 UnlinkedEvalCodeBlock* CodeCache::getEvalCodeBlock(VM& vm, EvalExecutable* executable, const SourceCode& source, JSParserStrictness strictness, DebuggerMode debuggerMode, ProfilerMode profilerMode, ParserError& error)
 {
     return getGlobalCodeBlock<UnlinkedEvalCodeBlock>(vm, executable, source, strictness, debuggerMode, profilerMode, error);
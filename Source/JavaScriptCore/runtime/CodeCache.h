@@ -33,6 +33,7 @@
 #include "WeakRandom.h"
 #include <wtf/CurrentTime.h>
 #include <wtf/Forward.h>
+#include <wtf/OwnPtr.h>
 #include <wtf/PassOwnPtr.h>
 #include <wtf/RandomNumber.h>
 #include <wtf/text/WTFString.h>
@@ -43,6 +44,7 @@ class EvalExecutable;
 class FunctionBodyNode;
 class Identifier;
 class JSScope;
+class PersistentCodeCache;
 class ProgramExecutable;
 class UnlinkedCodeBlock;
 class UnlinkedEvalCodeBlock;
@@ -81,6 +83,9 @@ public:
 
     size_t length() const { return m_sourceCode.length(); }
 
+    const String& name() const { return m_name; }
+    unsigned flags() const { return m_flags; }
+
     bool isNull() const { return m_sourceCode.isNull(); }
 
     // To save memory, we compute our string on demand. It's expected that source
@@ -241,6 +246,7 @@ public:
     UnlinkedProgramCodeBlock* getProgramCodeBlock(VM&, ProgramExecutable*, const SourceCode&, JSParserStrictness, DebuggerMode, ProfilerMode, ParserError&);
     UnlinkedEvalCodeBlock* getEvalCodeBlock(VM&, EvalExecutable*, const SourceCode&, JSParserStrictness, DebuggerMode, ProfilerMode, ParserError&);
     UnlinkedFunctionExecutable* getFunctionExecutableFromGlobalCode(VM&, const Identifier&, const SourceCode&, ParserError&);
+    void addProgramCodeBlock(VM&, const SourceCode&, JSParserStrictness, UnlinkedProgramCodeBlock*);
     ~CodeCache();
 
     void clear()
@@ -255,6 +261,7 @@ private:
     UnlinkedCodeBlockType* getGlobalCodeBlock(VM&, ExecutableType*, const SourceCode&, JSParserStrictness, DebuggerMode, ProfilerMode, ParserError&);
 
     CodeCacheMap m_sourceCode;
+    OwnPtr<PersistentCodeCache> m_persistentCache;
 };
 
 }
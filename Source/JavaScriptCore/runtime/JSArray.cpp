@@ -1369,6 +1369,28 @@ void JSArray::sortVector(ExecState* exec, JSValue compareFunction, CallType call
         throwOutOfMemoryError(exec);
         return;
     }
+
+    // Re-sorting an array that is already in order is common, for example when a table is
+    // sorted again on the same column. A single pass of comparisons detects that case, and
+    // bails out at the first out-of-order pair otherwise. The tree inserts equal values after
+    // each other, so an array with no pair that compares as less than its predecessor is
+    // already exactly what the tree would produce.
+    bool isAlreadySorted = true;
+    JSValue previous;
+    for (unsigned i = 0; i < usedVectorLength; ++i) {
+        if (i >= m_butterfly->vectorLength()) {
+            isAlreadySorted = false;
+            break;
+        }
+        JSValue v = getHolyIndexQuickly(i);
+        if (!v || v.isUndefined() || (previous && tree.abstractor().compare_key_key(v, previous) < 0)) {
+            isAlreadySorted = false;
+            break;
+        }
+        previous = v;
+    }
+    if (isAlreadySorted)
+        return;
         
     // FIXME: If the compare function modifies the array, the vector, map, etc. could be modified
     // right out from under us while we're building the tree here.
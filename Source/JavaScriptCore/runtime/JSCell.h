@@ -153,6 +153,7 @@ public:
     };
 
     void setMarked() { m_gcData = Marked; }
+    void setNotMarked() { m_gcData = NotMarked; }
     void setRemembered(bool remembered)
     {
         ASSERT(m_gcData == (remembered ? Marked : MarkedAndRemembered));
@@ -257,6 +257,9 @@ private:
     bool setWithSpecificType(
         ExecState*, JSGenericTypedArrayView<OtherAdaptor>*,
         unsigned offset, unsigned length);
+
+    // Returns how many leading elements were copied; the caller handles the rest.
+    unsigned setFromContiguousArray(JSObject*, unsigned offset, unsigned length);
 };
 
 template<typename Adaptor>
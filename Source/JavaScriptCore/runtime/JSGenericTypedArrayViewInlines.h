@@ -181,10 +181,19 @@ bool JSGenericTypedArrayView<Adaptor>::setWithSpecificType(
 
     unsigned otherElementSize = sizeof(typename OtherAdaptor::Type);
     
-    // Handle cases (1) and (2B).
+    // Handle case (1) with a plain forward loop over the two vectors, which the compiler
+    // is free to vectorize.
     if (!hasArrayBuffer() || !other->hasArrayBuffer()
-        || existingBuffer() != other->existingBuffer()
-        || (elementSize == otherElementSize && vector() > other->vector())) {
+        || existingBuffer() != other->existingBuffer()) {
+        typename Adaptor::Type* destination = typedVector() + offset;
+        const typename OtherAdaptor::Type* source = other->typedVector();
+        for (unsigned i = 0; i < length; ++i)
+            destination[i] = OtherAdaptor::template convertTo<Adaptor>(source[i]);
+        return true;
+    }
+
+    // Handle case (2B).
+    if (elementSize == otherElementSize && vector() > other->vector()) {
         for (unsigned i = length; i--;) {
             setIndexQuicklyToNativeValue(
                 offset + i, OtherAdaptor::template convertTo<Adaptor>(
@@ -264,8 +273,7 @@ bool JSGenericTypedArrayView<Adaptor>::set(
     case TypeDataView: {
         if (!validateRange(exec, offset, length))
             return false;
-        // We could optimize this case. But right now, we don't.
-        for (unsigned i = 0; i < length; ++i) {
+        for (unsigned i = setFromContiguousArray(object, offset, length); i < length; ++i) {
             JSValue value = object->get(exec, i);
             if (!setIndex(exec, offset + i, value))
                 return false;
@@ -277,6 +285,40 @@ bool JSGenericTypedArrayView<Adaptor>::set(
     return false;
 }
 
+template<typename Adaptor>
+unsigned JSGenericTypedArrayView<Adaptor>::setFromContiguousArray(
+    JSObject* object, unsigned offset, unsigned length)
+{
+    // Int32 and Double arrays can be read straight out of the butterfly. We stop at the
+    // first hole, since reading one goes to the prototype chain and may run arbitrary code.
+    IndexingType indexingType = object->indexingType();
+    if (!isJSArray(object) || !(hasInt32(indexingType) || hasDouble(indexingType)))
+        return 0;
+    Butterfly* butterfly = object->butterfly();
+    unsigned count = std::min(length, butterfly->publicLength());
+    typename Adaptor::Type* destination = typedVector() + offset;
+
+    if (hasInt32(indexingType)) {
+        WriteBarrier<Unknown>* source = butterfly->contiguousInt32().data();
+        for (unsigned i = 0; i < count; ++i) {
+            JSValue value = source[i].get();
+            if (!value)
+                return i;
+            destination[i] = Adaptor::toNativeFromInt32(value.asInt32());
+        }
+        return count;
+    }
+
+    double* source = butterfly->contiguousDouble().data();
+    for (unsigned i = 0; i < count; ++i) {
+        double value = source[i];
+        if (value != value)
+            return i;
+        destination[i] = Adaptor::toNativeFromDouble(value);
+    }
+    return count;
+}
+
 template<typename Adaptor>
 ArrayBuffer* JSGenericTypedArrayView<Adaptor>::existingBuffer()
 {
@@ -79,6 +79,7 @@ JSLockHolder::~JSLockHolder()
 
 JSLock::JSLock(VM* vm)
     : m_ownerThreadID(std::thread::id())
+    , m_contendedLockCount(0)
     , m_lockCount(0)
     , m_lockDropDepth(0)
     , m_hasExclusiveThread(false)
@@ -117,7 +118,10 @@ void JSLock::lock(intptr_t lockCount)
     }
 
     if (!m_hasExclusiveThread) {
-        m_lock.lock();
+        if (!m_lock.try_lock()) {
+            ++m_contendedLockCount;
+            m_lock.lock();
+        }
         m_ownerThreadID = std::this_thread::get_id();
     }
     ASSERT(!m_lockCount);
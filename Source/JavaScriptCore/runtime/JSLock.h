@@ -21,6 +21,7 @@
 #ifndef JSLock_h
 #define JSLock_h
 
+#include <atomic>
 #include <mutex>
 #include <thread>
 #include <wtf/Assertions.h>
@@ -104,6 +105,9 @@ namespace JSC {
         JS_EXPORT_PRIVATE void setExclusiveThread(std::thread::id);
         JS_EXPORT_PRIVATE bool currentThreadIsHoldingLock();
 
+        // Number of times a thread had to wait for another thread to release the lock.
+        unsigned contendedLockCount() const { return m_contendedLockCount.load(std::memory_order_relaxed); }
+
         void willDestroyVM(VM*);
 
         class DropAllLocks {
@@ -134,7 +138,8 @@ namespace JSC {
         void grabAllLocks(DropAllLocks*, unsigned lockCount);
 
         std::mutex m_lock;
-        std::thread::id m_ownerThreadID;
+        std::atomic<std::thread::id> m_ownerThreadID;
+        std::atomic<unsigned> m_contendedLockCount;
         intptr_t m_lockCount;
         unsigned m_lockDropDepth;
         bool m_hasExclusiveThread;
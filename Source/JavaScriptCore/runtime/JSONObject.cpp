@@ -31,6 +31,7 @@
 #include "ExceptionHelpers.h"
 #include "JSArray.h"
 #include "JSGlobalObject.h"
+#include "JSONStringifyCache.h"
 #include "LiteralParser.h"
 #include "Local.h"
 #include "LocalScope.h"
@@ -98,16 +99,19 @@ private:
 
     private:
         Local<JSObject> m_object;
+        Local<Structure> m_structure;
         const bool m_isArray;
         bool m_isJSArray;
         unsigned m_index;
         unsigned m_size;
         RefPtr<PropertyNameArrayData> m_propertyNames;
+        RefPtr<JSONStringifyCache::Entry> m_cachedProperties;
     };
 
     friend class Holder;
 
     static void appendQuotedString(StringBuilder&, const String&);
+    PassRefPtr<JSONStringifyCache::Entry> cachedPropertiesFor(JSObject*);
 
     JSValue toJSON(JSValue, const PropertyNameForFunctionCall&);
 
@@ -245,11 +249,14 @@ Local<Unknown> Stringifier::stringify(Handle<Unknown> value)
     PropertyNameForFunctionCall emptyPropertyName(m_exec->vm().propertyNames->emptyIdentifier);
     object->putDirect(m_exec->vm(), m_exec->vm().propertyNames->emptyIdentifier, value.get());
 
+    JSONStringifyCache& cache = *m_exec->vm().jsonStringifyCache;
     StringBuilder result;
+    result.reserveCapacity(cache.lastResultLength());
     if (appendStringifiedValue(result, value.get(), object, emptyPropertyName) != StringifySucceeded)
         return Local<Unknown>(m_exec->vm(), jsUndefined());
     if (m_exec->hadException())
         return Local<Unknown>(m_exec->vm(), jsNull());
+    cache.setLastResultLength(result.length());
 
     return Local<Unknown>(m_exec->vm(), jsString(m_exec, result.toString()));
 }
@@ -325,6 +332,42 @@ void Stringifier::appendQuotedString(StringBuilder& builder, const String& value
     builder.append('"');
 }
 
+PassRefPtr<JSONStringifyCache::Entry> Stringifier::cachedPropertiesFor(JSObject* object)
+{
+    // Only plain objects qualify: their own enumerable properties are exactly the
+    // non-DontEnum entries of the Structure, and each one is a value at a fixed offset.
+    if (m_usingArrayReplacer || !isJSFinalObject(object))
+        return 0;
+    Structure* structure = object->structure();
+    if (structure->isDictionary() || structure->hasGetterSetterProperties() || hasIndexedProperties(structure->indexingType()))
+        return 0;
+
+    VM& vm = m_exec->vm();
+    JSONStringifyCache& cache = *vm.jsonStringifyCache;
+    if (JSONStringifyCache::Entry* entry = cache.get(structure))
+        return entry;
+
+    PropertyNameArray propertyNames(m_exec);
+    object->methodTable()->getOwnPropertyNames(object, m_exec, propertyNames, ExcludeDontEnumProperties);
+    RefPtr<JSONStringifyCache::Entry> entry = JSONStringifyCache::Entry::create(propertyNames.releaseData());
+    PropertyNameArrayData::PropertyNameVector& names = entry->propertyNames()->propertyNameVector();
+    entry->offsets.reserveInitialCapacity(names.size());
+    entry->quotedNames.reserveInitialCapacity(names.size());
+    for (unsigned i = 0; i < names.size(); ++i) {
+        unsigned attributes;
+        JSCell* specificValue;
+        PropertyOffset offset = structure->get(vm, names[i], attributes, specificValue);
+        if (!isValidOffset(offset) || (attributes & (Accessor | CustomAccessor)))
+            return 0;
+        StringBuilder quotedName;
+        appendQuotedString(quotedName, names[i].string());
+        entry->offsets.uncheckedAppend(offset);
+        entry->quotedNames.uncheckedAppend(quotedName.toString());
+    }
+    cache.add(structure, entry);
+    return entry.release();
+}
+
 inline JSValue Stringifier::toJSON(JSValue value, const PropertyNameForFunctionCall& propertyName)
 {
     ASSERT(!m_exec->hadException());
@@ -398,7 +441,7 @@ Stringifier::StringifyResult Stringifier::appendStringifiedValue(StringBuilder&
         if (!std::isfinite(number))
             builder.appendLiteral("null");
         else
-            builder.append(String::numberToStringECMAScript(number));
+            builder.appendECMAScriptNumber(number);
         return StringifySucceeded;
     }
 
@@ -469,6 +512,7 @@ inline void Stringifier::startNewLine(StringBuilder& builder) const
 
 inline Stringifier::Holder::Holder(VM& vm, JSObject* object)
     : m_object(vm, object)
+    , m_structure(vm, object->structure())
     , m_isArray(object->inherits(JSArray::info()))
     , m_index(0)
 #ifndef NDEBUG
@@ -492,6 +536,8 @@ bool Stringifier::Holder::appendNextProperty(Stringifier& stringifier, StringBui
         } else {
             if (stringifier.m_usingArrayReplacer)
                 m_propertyNames = stringifier.m_arrayReplacerPropertyNames.data();
+            else if ((m_cachedProperties = stringifier.cachedPropertiesFor(m_object.get())))
+                m_propertyNames = m_cachedProperties->propertyNames();
             else {
                 PropertyNameArray objectPropertyNames(exec);
                 m_object->methodTable()->getOwnPropertyNames(m_object.get(), exec, objectPropertyNames, ExcludeDontEnumProperties);
@@ -539,14 +585,21 @@ bool Stringifier::Holder::appendNextProperty(Stringifier& stringifier, StringBui
         // Append the stringified value.
         stringifyResult = stringifier.appendStringifiedValue(builder, value, m_object.get(), index);
     } else {
-        // Get the value.
-        PropertySlot slot(m_object.get());
+        // Get the value. A toJSON or replacer call may have reshaped the object since
+        // the cached offsets were computed, in which case take the generic path.
         Identifier& propertyName = m_propertyNames->propertyNameVector()[index];
-        if (!m_object->methodTable()->getOwnPropertySlot(m_object.get(), exec, propertyName, slot))
-            return true;
-        JSValue value = slot.getValue(exec, propertyName);
-        if (exec->hadException())
-            return false;
+        bool useCachedProperty = m_cachedProperties && m_object->structure() == m_structure.get();
+        JSValue value;
+        if (useCachedProperty)
+            value = m_object->getDirect(m_cachedProperties->offsets[index]);
+        else {
+            PropertySlot slot(m_object.get());
+            if (!m_object->methodTable()->getOwnPropertySlot(m_object.get(), exec, propertyName, slot))
+                return true;
+            value = slot.getValue(exec, propertyName);
+            if (exec->hadException())
+                return false;
+        }
 
         rollBackPoint = builder.length();
 
@@ -556,7 +609,10 @@ bool Stringifier::Holder::appendNextProperty(Stringifier& stringifier, StringBui
         stringifier.startNewLine(builder);
 
         // Append the property name.
-        appendQuotedString(builder, propertyName.string());
+        if (useCachedProperty)
+            builder.append(m_cachedProperties->quotedNames[index]);
+        else
+            appendQuotedString(builder, propertyName.string());
         builder.append(':');
         if (stringifier.willIndent())
             builder.append(' ');
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef JSONStringifyCache_h
+#define JSONStringifyCache_h
+
+#include "PropertyNameArray.h"
+#include "PropertyOffset.h"
+#include <wtf/HashMap.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/RefCounted.h>
+#include <wtf/Vector.h>
+#include <wtf/text/WTFString.h>
+
+namespace JSC {
+
+class Structure;
+
+// Remembers, per Structure, the property names JSON.stringify enumerates for a
+// plain object along with their offsets and already-quoted forms. Code that
+// stringifies objects of the same shape over and over (every animation frame,
+// say) then skips getOwnPropertyNames and key escaping entirely.
+//
+// Structures are keyed by address, which is only unique between two
+// collections, so the cache is cleared by every collection.
+class JSONStringifyCache {
+    WTF_MAKE_NONCOPYABLE(JSONStringifyCache);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    class Entry : public RefCounted<Entry> {
+    public:
+        static PassRefPtr<Entry> create(PassRefPtr<PropertyNameArrayData> propertyNames)
+        {
+            return adoptRef(new Entry(propertyNames));
+        }
+
+        PropertyNameArrayData* propertyNames() const { return m_propertyNames.get(); }
+
+        // Indexed in parallel with propertyNames()->propertyNameVector().
+        Vector<PropertyOffset> offsets;
+        Vector<String> quotedNames;
+
+    private:
+        Entry(PassRefPtr<PropertyNameArrayData> propertyNames)
+            : m_propertyNames(propertyNames)
+        {
+        }
+
+        RefPtr<PropertyNameArrayData> m_propertyNames;
+    };
+
+    JSONStringifyCache()
+        : m_lastResultLength(0)
+    {
+    }
+
+    Entry* get(Structure* structure) const { return m_entries.get(structure); }
+
+    void add(Structure* structure, PassRefPtr<Entry> entry)
+    {
+        if (m_entries.size() >= maxEntries)
+            m_entries.clear();
+        m_entries.add(structure, entry);
+    }
+
+    // Length of the most recent result, used to size the next result up front.
+    unsigned lastResultLength() const { return m_lastResultLength; }
+    void setLastResultLength(unsigned length) { m_lastResultLength = length; }
+
+    void clear() { m_entries.clear(); }
+
+private:
+    static const int maxEntries = 256;
+
+    HashMap<Structure*, RefPtr<Entry>> m_entries;
+    unsigned m_lastResultLength;
+};
+
+} // namespace JSC
+
+#endif // JSONStringifyCache_h
@@ -232,9 +232,52 @@ void JSRopeString::outOfMemory(ExecState* exec) const
         throwOutOfMemoryError(exec);
 }
 
+// Returns the deepest fiber that holds all of [offset, offset + length), adjusting offset to
+// be relative to it. Touching a few characters of a large rope then only needs that fiber
+// rather than the whole rope to be resolved; a single character always lands in a leaf.
+// Returns null if that fiber is more than s_maxRopeWalkDepth levels down, so that callers
+// resolve ropes built up by repeated concatenation instead of walking them on every access.
+const JSString* JSRopeString::fiberContaining(unsigned& offset, unsigned length) const
+{
+    ASSERT(offset + length <= m_length);
+    const JSString* node = this;
+    for (unsigned depth = 0; node->isRope(); ++depth) {
+        if (depth == s_maxRopeWalkDepth)
+            return 0;
+        const JSRopeString* rope = static_cast<const JSRopeString*>(node);
+        unsigned fiberOffset = offset;
+        const JSString* next = 0;
+        for (size_t i = 0; i < s_maxInternalRopeLength && rope->m_fibers[i]; ++i) {
+            JSString* fiber = rope->m_fibers[i].get();
+            if (fiberOffset < fiber->length()) {
+                if (length <= fiber->length() - fiberOffset)
+                    next = fiber;
+                break;
+            }
+            fiberOffset -= fiber->length();
+        }
+        if (!next)
+            break;
+        node = next;
+        offset = fiberOffset;
+    }
+    return node;
+}
+
 JSString* JSRopeString::getIndexSlowCase(ExecState* exec, unsigned i)
 {
     ASSERT(isRope());
+    unsigned offset = i;
+    if (const JSString* leaf = fiberContaining(offset, 1)) {
+        // Only a rope whose resolution ran out of memory has no leaf to find.
+        const String& string = leaf->value(exec);
+        // Return a safe no-value result, this should never be used, since the excetion will be thrown.
+        if (exec->exception())
+            return jsEmptyString(exec);
+        RELEASE_ASSERT(offset < string.length());
+        return jsSingleCharacterSubstring(exec, string, offset);
+    }
+
     resolveRope(exec);
     // Return a safe no-value result, this should never be used, since the excetion will be thrown.
     if (exec->exception())
@@ -244,6 +287,68 @@ JSString* JSRopeString::getIndexSlowCase(ExecState* exec, unsigned i)
     return jsSingleCharacterSubstring(exec, m_value, i);
 }
 
+JSString* JSRopeString::substringSlowCase(ExecState* exec, unsigned offset, unsigned length) const
+{
+    ASSERT(isRope());
+    unsigned fiberOffset = offset;
+    const JSString* fiber = fiberContaining(fiberOffset, length);
+    if (!fiber) {
+        fiber = this;
+        fiberOffset = offset;
+    }
+    const String& string = fiber->value(exec);
+    // Return a safe no-value result, this should never be used, since the excetion will be thrown.
+    if (exec->exception())
+        return jsEmptyString(exec);
+    return jsSubstring(&exec->vm(), string, fiberOffset, length);
+}
+
+size_t JSRopeString::findSlowCase(ExecState* exec, UChar character, unsigned start) const
+{
+    ASSERT(isRope());
+    unsigned ropesWalked = 0;
+    Vector<const JSString*, 32, UnsafeVectorOverflow> workQueue; // These strings are kept alive by the parent rope, so using a Vector is OK.
+    for (size_t i = s_maxInternalRopeLength; i--;) {
+        if (m_fibers[i])
+            workQueue.append(m_fibers[i].get());
+    }
+
+    // Walk the leaves in order, skipping any that end before start.
+    unsigned position = 0;
+    while (!workQueue.isEmpty()) {
+        const JSString* currentFiber = workQueue.last();
+        workQueue.removeLast();
+
+        unsigned length = currentFiber->length();
+        if (start >= position + length) {
+            position += length;
+            continue;
+        }
+
+        if (currentFiber->isRope()) {
+            // A rope that is this deep is probably being searched in a loop; resolve it once.
+            if (++ropesWalked > s_maxRopeWalkDepth) {
+                resolveRope(exec);
+                if (exec->exception())
+                    return notFound;
+                return m_value.find(character, start);
+            }
+            const JSRopeString* currentFiberAsRope = static_cast<const JSRopeString*>(currentFiber);
+            for (size_t i = s_maxInternalRopeLength; i--;) {
+                if (currentFiberAsRope->m_fibers[i])
+                    workQueue.append(currentFiberAsRope->m_fibers[i].get());
+            }
+            continue;
+        }
+
+        size_t result = currentFiber->m_value.find(character, start > position ? start - position : 0);
+        if (result != notFound)
+            return position + result;
+        position += length;
+    }
+    return notFound;
+}
+
 JSValue JSString::toPrimitive(ExecState*, PreferredPrimitiveType) const
 {
     return const_cast<JSString*>(this);
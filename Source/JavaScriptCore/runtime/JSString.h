@@ -156,6 +156,7 @@ namespace JSC {
 
         bool canGetIndex(unsigned i) { return i < m_length; }
         JSString* getIndex(ExecState*, unsigned);
+        size_t find(ExecState*, UChar, unsigned start = 0) const;
 
         static Structure* createStructure(VM& vm, JSGlobalObject* globalObject, JSValue proto)
         {
@@ -323,10 +324,13 @@ namespace JSC {
         static ptrdiff_t offsetOfFibers() { return OBJECT_OFFSETOF(JSRopeString, m_fibers); }
 
         static const unsigned s_maxInternalRopeLength = 3;
+        // Deeper ropes are resolved rather than walked, so that repeated accesses get back to flat strings.
+        static const unsigned s_maxRopeWalkDepth = 8;
             
     private:
         friend JSValue jsStringFromRegisterArray(ExecState*, Register*, unsigned);
         friend JSValue jsStringFromArguments(ExecState*, JSValue);
+        friend JSString* jsSubstring(ExecState*, JSString*, unsigned offset, unsigned length);
 
         JS_EXPORT_PRIVATE void resolveRope(ExecState*) const;
         void resolveRopeSlowCase8(LChar*) const;
@@ -334,6 +338,9 @@ namespace JSC {
         void outOfMemory(ExecState*) const;
             
         JS_EXPORT_PRIVATE JSString* getIndexSlowCase(ExecState*, unsigned);
+        JSString* substringSlowCase(ExecState*, unsigned offset, unsigned length) const;
+        size_t findSlowCase(ExecState*, UChar, unsigned start) const;
+        const JSString* fiberContaining(unsigned& offset, unsigned length) const;
 
         mutable std::array<WriteBarrier<JSString>, s_maxInternalRopeLength> m_fibers;
     };
@@ -403,6 +410,13 @@ namespace JSC {
         return jsSingleCharacterSubstring(exec, m_value, i);
     }
 
+    inline size_t JSString::find(ExecState* exec, UChar character, unsigned start) const
+    {
+        if (isRope())
+            return static_cast<const JSRopeString*>(this)->findSlowCase(exec, character, start);
+        return m_value.find(character, start);
+    }
+
     inline JSString* jsString(VM* vm, const String& s)
     {
         int size = s.length();
@@ -424,6 +438,8 @@ namespace JSC {
         VM* vm = &exec->vm();
         if (!length)
             return vm->smallStrings.emptyString();
+        if (s->isRope())
+            return static_cast<JSRopeString*>(s)->substringSlowCase(exec, offset, length);
         return jsSubstring(vm, s->value(exec), offset, length);
     }
 
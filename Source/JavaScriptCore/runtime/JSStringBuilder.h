@@ -29,6 +29,7 @@
 #include "ExceptionHelpers.h"
 #include "JSString.h"
 #include <wtf/Vector.h>
+#include <wtf/text/StringView.h>
 
 namespace JSC {
 
@@ -69,6 +70,16 @@ public:
         append(reinterpret_cast<const LChar*>(str), strlen(str));
     }
 
+    void append(StringView string)
+    {
+        if (string.is8Bit())
+            append(string.characters8(), string.length());
+        else
+            append(string.characters16(), string.length());
+    }
+
+    bool isEmpty() const { return m_is8Bit ? buffer8.isEmpty() : buffer16.isEmpty(); }
+
     JSValue build(ExecState* exec)
     {
         if (!m_okay)
@@ -100,6 +111,13 @@ private:
         }
     }
 
+    void append(const UChar* characters, size_t length)
+    {
+        if (m_is8Bit)
+            upConvert();
+        m_okay &= buffer16.tryAppend(characters, length);
+    }
+
     void upConvert()
     {
         ASSERT(m_is8Bit);
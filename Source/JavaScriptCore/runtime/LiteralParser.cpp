@@ -39,6 +39,10 @@
 #include <wtf/dtoa.h>
 #include <wtf/text/StringBuilder.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace JSC {
 
 template <typename CharType>
@@ -345,6 +349,62 @@ template <ParserMode mode, typename CharType, UChar terminator> static inline bo
     return (c >= ' ' && (mode == StrictJSON || c <= 0xff) && c != '\\' && c != terminator) || (c == '\t' && mode != StrictJSON);
 }
 
+// Skips whole blocks of characters that isSafeStringCharacter would accept, stopping at the
+// first block containing anything interesting (the terminator, a backslash, a control
+// character or, for non-strict 16-bit input, a character above 0xff). The caller finishes
+// the run with the scalar loop, which also deals with tabs in non-strict mode.
+#ifdef __SSE2__
+template <ParserMode mode, LChar terminator> static ALWAYS_INLINE const LChar* skipSafeStringCharacters(const LChar* ptr, const LChar* end)
+{
+    const __m128i terminatorMask = _mm_set1_epi8(terminator);
+    const __m128i backslashMask = _mm_set1_epi8('\\');
+    const __m128i lastControlCharacter = _mm_set1_epi8(0x1f);
+    while (end - ptr >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+        __m128i unsafe = _mm_or_si128(_mm_cmpeq_epi8(chunk, terminatorMask), _mm_cmpeq_epi8(chunk, backslashMask));
+        // min(c, 0x1f) == c exactly when c is a control character.
+        unsafe = _mm_or_si128(unsafe, _mm_cmpeq_epi8(_mm_min_epu8(chunk, lastControlCharacter), chunk));
+        if (_mm_movemask_epi8(unsafe))
+            break;
+        ptr += 16;
+    }
+    return ptr;
+}
+
+template <ParserMode mode, UChar terminator> static ALWAYS_INLINE const UChar* skipSafeStringCharacters(const UChar* ptr, const UChar* end)
+{
+    // SSE2 only has signed 16-bit comparisons, so the range checks are done on
+    // characters biased by 0x8000.
+    const __m128i bias = _mm_set1_epi16(static_cast<short>(0x8000));
+    const __m128i terminatorMask = _mm_set1_epi16(terminator);
+    const __m128i backslashMask = _mm_set1_epi16('\\');
+    const __m128i biasedSpace = _mm_set1_epi16(static_cast<short>(0x8020));
+    const __m128i biasedLatin1Limit = _mm_set1_epi16(static_cast<short>(0x80ff));
+    while (end - ptr >= 8) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+        __m128i biased = _mm_xor_si128(chunk, bias);
+        __m128i unsafe = _mm_or_si128(_mm_cmpeq_epi16(chunk, terminatorMask), _mm_cmpeq_epi16(chunk, backslashMask));
+        unsafe = _mm_or_si128(unsafe, _mm_cmplt_epi16(biased, biasedSpace));
+        if (mode != StrictJSON)
+            unsafe = _mm_or_si128(unsafe, _mm_cmpgt_epi16(biased, biasedLatin1Limit));
+        if (_mm_movemask_epi8(unsafe))
+            break;
+        ptr += 8;
+    }
+    return ptr;
+}
+#else
+template <ParserMode mode, LChar terminator> static ALWAYS_INLINE const LChar* skipSafeStringCharacters(const LChar* ptr, const LChar*)
+{
+    return ptr;
+}
+
+template <ParserMode mode, UChar terminator> static ALWAYS_INLINE const UChar* skipSafeStringCharacters(const UChar* ptr, const UChar*)
+{
+    return ptr;
+}
+#endif
+
 template <typename CharType>
 template <ParserMode mode, char terminator> ALWAYS_INLINE TokenType LiteralParser<CharType>::Lexer::lexString(LiteralParserToken<CharType>& token)
 {
@@ -353,6 +413,7 @@ template <ParserMode mode, char terminator> ALWAYS_INLINE TokenType LiteralParse
     StringBuilder builder;
     do {
         runStart = m_ptr;
+        m_ptr = skipSafeStringCharacters<mode, terminator>(m_ptr, m_end);
         while (m_ptr < m_end && isSafeStringCharacter<mode, CharType, terminator>(*m_ptr))
             ++m_ptr;
         if (builder.length())
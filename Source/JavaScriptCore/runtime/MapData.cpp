@@ -80,15 +80,22 @@ bool MapData::contains(CallFrame* callFrame, KeyType key)
 
 template <typename Map, typename Key> MapData::Entry* MapData::add(CallFrame* callFrame, Map& map, Key key, KeyType keyValue)
 {
-    typename Map::iterator location = map.find(key);
-    if (location != map.end())
-        return &m_entries[location->value];
-    
-    if (!ensureSpaceForAppend(callFrame))
-        return 0;
+    // Growing the backing store may pack it, which renumbers the indices stored in
+    // the tables, so it has to happen before the key is added. Only check for an
+    // existing key separately when that is about to happen; otherwise a single
+    // hash table operation both finds and adds the key.
+    if (m_capacity == m_size) {
+        typename Map::iterator location = map.find(key);
+        if (location != map.end())
+            return &m_entries[location->value];
+
+        if (!ensureSpaceForAppend(callFrame))
+            return 0;
+    }
 
     auto result = map.add(key, m_size);
-    RELEASE_ASSERT(result.isNewEntry);
+    if (!result.isNewEntry)
+        return &m_entries[result.iterator->value];
     Entry* entry = &m_entries[m_size++];
     new (entry) Entry();
     entry->key.set(callFrame->vm(), this, keyValue.value);
@@ -167,6 +174,8 @@ void MapData::replaceAndPackBackingStore(Entry* destination, int32_t newCapacity
     }
 
     // Fixup for the hashmaps
+    for (auto ptr = m_cellKeyedTable.begin(); ptr != m_cellKeyedTable.end(); ++ptr)
+        ptr->value = m_entries[ptr->value].value.get().asInt32();
     for (auto ptr = m_valueKeyedTable.begin(); ptr != m_valueKeyedTable.end(); ++ptr)
         ptr->value = m_entries[ptr->value].value.get().asInt32();
     for (auto ptr = m_stringKeyedTable.begin(); ptr != m_stringKeyedTable.end(); ++ptr)
@@ -142,6 +142,7 @@ private:
 
 ALWAYS_INLINE void MapData::clear()
 {
+    m_cellKeyedTable.clear();
     m_valueKeyedTable.clear();
     m_stringKeyedTable.clear();
     m_capacity = 0;
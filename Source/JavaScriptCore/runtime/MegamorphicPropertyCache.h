@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef MegamorphicPropertyCache_h
+#define MegamorphicPropertyCache_h
+
+#include "PropertyOffset.h"
+#include "StructureIDTable.h"
+#include <wtf/HashFunctions.h>
+#include <wtf/HashTraits.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/RefPtr.h>
+#include <wtf/text/StringImpl.h>
+
+namespace JSC {
+
+// A direct-mapped (StructureID, uid) -> offset cache for own data properties.
+// It backs get_by_id sites that have outgrown their polymorphic stub lists, so
+// that those don't do a full property lookup on every access.
+//
+// A StructureID only names a single live Structure between two collections, so
+// the cache is cleared by every collection. Only Structures whose property
+// offsets can't change without a transition (no dictionaries, no custom
+// getOwnPropertySlot) are entered.
+class MegamorphicPropertyCache {
+    WTF_MAKE_NONCOPYABLE(MegamorphicPropertyCache);
+public:
+    MegamorphicPropertyCache() { }
+
+    PropertyOffset get(StructureID structureID, StringImpl* uid) const
+    {
+        const Entry& entry = m_entries[indexFor(structureID, uid)];
+        if (entry.structureID != structureID || entry.uid != uid)
+            return invalidOffset;
+        return entry.offset;
+    }
+
+    void add(StructureID structureID, StringImpl* uid, PropertyOffset offset)
+    {
+        Entry& entry = m_entries[indexFor(structureID, uid)];
+        entry.structureID = structureID;
+        entry.uid = uid; // Held so that the address can't be reused by another uid.
+        entry.offset = offset;
+    }
+
+    void clear()
+    {
+        for (unsigned i = 0; i < size; ++i)
+            m_entries[i] = Entry();
+    }
+
+private:
+    static const unsigned size = 1024;
+
+    struct Entry {
+        Entry()
+            : structureID(0)
+            , offset(invalidOffset)
+        {
+        }
+
+        StructureID structureID;
+        RefPtr<StringImpl> uid;
+        PropertyOffset offset;
+    };
+
+    static unsigned indexFor(StructureID structureID, StringImpl* uid)
+    {
+        unsigned hash = WTF::pairIntHash(DefaultHash<StructureID>::Hash::hash(structureID), PtrHash<StringImpl*>::hash(uid));
+        return hash & (size - 1);
+    }
+
+    Entry m_entries[size];
+};
+
+} // namespace JSC
+
+#endif // MegamorphicPropertyCache_h
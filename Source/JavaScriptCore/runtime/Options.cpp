@@ -32,6 +32,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <wtf/DataLog.h>
+#include <wtf/FastMalloc.h>
 #include <wtf/NumberOfCores.h>
 #include <wtf/PageBlock.h>
 #include <wtf/StdLibExtras.h>
@@ -76,6 +77,13 @@ static bool parse(const char* string, OptionRange& value)
     return value.init(string);
 }
 
+static bool parse(const char* string, const char*& value)
+{
+    // The string being parsed may not outlive the option (e.g. a setOption() argument), so keep a copy.
+    value = fastStrDup(string);
+    return true;
+}
+
 static bool parse(const char* string, GCLogging::Level& value)
 {
     if (!strcasecmp(string, "none") || !strcasecmp(string, "no") || !strcasecmp(string, "false") || !strcmp(string, "0")) {
@@ -350,6 +358,9 @@ void Options::dumpOption(OptionID id, FILE* stream, const char* header, const ch
     case optionRangeType:
         fprintf(stream, "%s", s_options[id].u.optionRangeVal.rangeString());
         break;
+    case optionStringType:
+        fprintf(stream, "%s", s_options[id].u.optionStringVal ? s_options[id].u.optionStringVal : "");
+        break;
     case gcLogLevelType:
         fprintf(stream, "%s", GCLogging::levelAsString(s_options[id].u.gcLogLevelVal));
         break;
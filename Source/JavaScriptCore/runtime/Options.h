@@ -89,6 +89,7 @@ private:
 };
 
 typedef OptionRange optionRange;
+typedef const char* optionString;
 
 #define JSC_OPTIONS(v) \
     v(bool, useLLInt,  true) \
@@ -108,9 +109,14 @@ typedef OptionRange optionRange;
     v(bool, dumpGeneratedBytecodes, false) \
     v(bool, dumpBytecodeLivenessResults, false) \
     v(bool, validateBytecode, false) \
+    v(bool, coalesceBytecodeTemporaries, false) \
     v(bool, forceDebuggerBytecodeGeneration, false) \
     v(bool, forceProfilerBytecodeGeneration, false) \
     \
+    /* Directory in which unlinked program code blocks are persisted across */ \
+    /* process launches. The persistent code cache is disabled when unset. */ \
+    v(optionString, diskCodeCachePath, nullptr) \
+    \
     /* showDisassembly implies showDFGDisassembly. */ \
     v(bool, showDisassembly, false) \
     v(bool, showDFGDisassembly, false) \
@@ -124,6 +130,7 @@ typedef OptionRange optionRange;
     v(bool, verboseFTLCompilation, false) \
     v(bool, logCompilationChanges, false) \
     v(bool, printEachOSRExit, false) \
+    v(bool, logJettisons, false) \
     v(bool, validateGraph, false) \
     v(bool, validateGraphAtEachPhase, false) \
     v(bool, verboseOSR, false) \
@@ -166,12 +173,14 @@ typedef OptionRange optionRange;
     v(bool, enablePolymorphicAccessInlining, true) \
     \
     v(bool, enableConcurrentJIT, true) \
-    v(unsigned, numberOfDFGCompilerThreads, computeNumberOfWorkerThreads(2, 2) - 1) \
+    v(unsigned, numberOfDFGCompilerThreads, computeNumberOfWorkerThreads(4, 2) - 1) \
     v(unsigned, numberOfFTLCompilerThreads, computeNumberOfWorkerThreads(8, 2) - 1) \
     v(int32, priorityDeltaOfDFGCompilerThreads, computePriorityDeltaOfWorkerThreads(-1, 0)) \
     v(int32, priorityDeltaOfFTLCompilerThreads, computePriorityDeltaOfWorkerThreads(-2, 0)) \
     \
     v(bool, enableProfiler, false) \
+    v(bool, useSamplingProfiler, false) \
+    v(unsigned, sampleIntervalInMicroseconds, 1000) \
     \
     v(bool, forceUDis86Disassembler, false) \
     v(bool, forceLLVMDisassembler, false) \
@@ -246,11 +255,17 @@ typedef OptionRange optionRange;
     \
     v(unsigned, minimumNumberOfScansBetweenRebalance, 100) \
     v(unsigned, numberOfGCMarkers, computeNumberOfGCMarkers(7)) \
+    v(bool, useWorkStealingMarkStack, false) \
     v(unsigned, opaqueRootMergeThreshold, 1000) \
     v(double, minHeapUtilization, 0.8) \
     v(double, minCopiedBlockUtilization, 0.9) \
     v(double, minMarkedBlockUtilization, 0.9) \
     \
+    /* When set, full collections mark incrementally: the mutator keeps running */ \
+    /* between marking slices and only stops for a short final remark. */ \
+    v(bool, useIncrementalMarking, false) \
+    v(unsigned, incrementalMarkingSliceSize, 1000) \
+    \
     v(double, percentCPUPerMBForFullTimer, 0.0003125) \
     v(double, percentCPUPerMBForEdenTimer, 0.0025) \
     v(double, collectionTimerMaxPercentCPU, 0.05) \
@@ -307,6 +322,7 @@ private:
         doubleType,
         int32Type,
         optionRangeType,
+        optionStringType,
         gcLogLevelType,
     };
 
@@ -318,6 +334,7 @@ private:
             double doubleVal;
             int32 int32Val;
             OptionRange optionRangeVal;
+            const char* optionStringVal;
             GCLogging::Level gcLogLevelVal;
         } u;
         bool didOverride;
@@ -0,0 +1,1066 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "PersistentCodeCache.h"
+
+#include "CodeCache.h"
+#include "JSCInlines.h"
+#include "Nodes.h"
+#include "NodeConstructors.h"
+#include "StrongInlines.h"
+#include "UnlinkedCodeBlock.h"
+#include "UnlinkedInstructionStream.h"
+#include <mutex>
+#include <string.h>
+#include <wtf/Deque.h>
+#include <wtf/Threading.h>
+#include <wtf/ThreadingPrimitives.h>
+#include <wtf/text/StringBuilder.h>
+
+#if OS(UNIX)
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace JSC {
+
+// Bump this whenever the layout written by PersistentCodeCacheEncoder changes.
+static const uint32_t persistentCodeCacheFormatVersion = 2;
+static const uint32_t persistentCodeCacheMagic = 0x4a534343; // 'JSCC'
+
+struct PersistentCodeCacheHeader {
+    uint32_t magic;
+    uint32_t formatVersion;
+    uint32_t buildSignature;
+    uint32_t payloadSize;
+    SHA1::Digest digest;
+    SHA1::Digest payloadDigest;
+};
+
+static SHA1::Digest computePayloadDigest(const uint8_t* payload, size_t size)
+{
+    SHA1 sha1;
+    sha1.addBytes(payload, size);
+    SHA1::Digest digest;
+    sha1.computeHash(digest);
+    return digest;
+}
+
+// The payload stores instruction operands and POD tables verbatim, so a cache
+// file is only usable by a build with the same opcode layout and struct sizes.
+static uint32_t computeBuildSignature()
+{
+    SHA1 sha1;
+    Vector<uint32_t> values;
+    values.append(persistentCodeCacheFormatVersion);
+    values.append(sizeof(void*));
+    values.append(sizeof(ExpressionRangeInfo));
+    values.append(sizeof(ExpressionRangeInfo::FatPosition));
+    values.append(sizeof(UnlinkedHandlerInfo));
+    values.append(numOpcodeIDs);
+    for (int i = 0; i < numOpcodeIDs; ++i)
+        values.append(opcodeLength(static_cast<OpcodeID>(i)));
+    sha1.addBytes(reinterpret_cast<const uint8_t*>(values.data()), values.size() * sizeof(uint32_t));
+
+    SHA1::Digest digest;
+    sha1.computeHash(digest);
+    uint32_t signature;
+    memcpy(&signature, digest.data(), sizeof(signature));
+    return signature;
+}
+
+enum PersistentConstantTag : uint8_t {
+    EmptyConstantTag,
+    UndefinedConstantTag,
+    NullConstantTag,
+    TrueConstantTag,
+    FalseConstantTag,
+    Int32ConstantTag,
+    DoubleConstantTag,
+    StringConstantTag,
+    ConstantRegisterConstantTag
+};
+
+class PersistentCodeCacheEncoder {
+public:
+    PersistentCodeCacheEncoder()
+        : m_failed(false)
+    {
+    }
+
+    bool failed() const { return m_failed; }
+    const Vector<uint8_t>& buffer() const { return m_buffer; }
+    Vector<uint8_t> takeBuffer() { return std::move(m_buffer); }
+
+    void encodeProgramCodeBlock(UnlinkedProgramCodeBlock*);
+
+private:
+    template<typename T> void encodePOD(const T& value)
+    {
+        m_buffer.append(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
+    }
+
+    template<typename T, size_t inlineCapacity, typename OverflowHandler>
+    void encodePODVector(const Vector<T, inlineCapacity, OverflowHandler>& vector)
+    {
+        encodePOD<uint32_t>(vector.size());
+        m_buffer.append(reinterpret_cast<const uint8_t*>(vector.data()), vector.size() * sizeof(T));
+    }
+
+    void encodeBool(bool value) { encodePOD<uint8_t>(value); }
+    void encodeString(const String&);
+    void encodeIdentifier(const Identifier&);
+    void encodeTextPosition(const JSTextPosition&);
+    void encodeConstant(JSValue, const UnlinkedCodeBlock* = 0);
+    void encodeCodeBlock(UnlinkedCodeBlock*);
+    void encodeFunctionExecutable(UnlinkedFunctionExecutable*);
+
+    Vector<uint8_t> m_buffer;
+    bool m_failed;
+};
+
+void PersistentCodeCacheEncoder::encodeString(const String& string)
+{
+    if (string.isNull()) {
+        encodePOD<uint32_t>(UINT_MAX);
+        return;
+    }
+
+    unsigned length = string.length();
+    encodePOD<uint32_t>(length);
+    encodeBool(string.is8Bit());
+    if (string.is8Bit())
+        m_buffer.append(string.characters8(), length);
+    else
+        m_buffer.append(reinterpret_cast<const uint8_t*>(string.characters16()), length * sizeof(UChar));
+}
+
+void PersistentCodeCacheEncoder::encodeIdentifier(const Identifier& identifier)
+{
+    // Private names are only meaningful inside the VM that created them.
+    if (identifier.impl() && identifier.impl()->isEmptyUnique()) {
+        m_failed = true;
+        return;
+    }
+    encodeString(identifier.string());
+}
+
+void PersistentCodeCacheEncoder::encodeTextPosition(const JSTextPosition& position)
+{
+    encodePOD<int32_t>(position.line);
+    encodePOD<int32_t>(position.offset);
+    encodePOD<int32_t>(position.lineStartOffset);
+}
+
+void PersistentCodeCacheEncoder::encodeConstant(JSValue value, const UnlinkedCodeBlock* constantPool)
+{
+    if (!value) {
+        encodePOD<uint8_t>(EmptyConstantTag);
+        return;
+    }
+    if (value.isUndefined()) {
+        encodePOD<uint8_t>(UndefinedConstantTag);
+        return;
+    }
+    if (value.isNull()) {
+        encodePOD<uint8_t>(NullConstantTag);
+        return;
+    }
+    if (value.isBoolean()) {
+        encodePOD<uint8_t>(value.asBoolean() ? TrueConstantTag : FalseConstantTag);
+        return;
+    }
+    if (value.isInt32()) {
+        encodePOD<uint8_t>(Int32ConstantTag);
+        encodePOD<int32_t>(value.asInt32());
+        return;
+    }
+    if (value.isDouble()) {
+        encodePOD<uint8_t>(DoubleConstantTag);
+        encodePOD<double>(value.asDouble());
+        return;
+    }
+
+    // Constant buffers are not visited by the GC; the strings they hold are kept
+    // alive by the constant pool, so refer to the pool entry instead.
+    if (constantPool) {
+        for (size_t i = 0; i < constantPool->m_constantRegisters.size(); ++i) {
+            if (constantPool->m_constantRegisters[i].get() == value) {
+                encodePOD<uint8_t>(ConstantRegisterConstantTag);
+                encodePOD<uint32_t>(i);
+                return;
+            }
+        }
+        m_failed = true;
+        return;
+    }
+
+    if (value.isString() && asString(value)->tryGetValueImpl()) {
+        encodePOD<uint8_t>(StringConstantTag);
+        encodeString(asString(value)->tryGetValue());
+        return;
+    }
+
+    m_failed = true;
+}
+
+void PersistentCodeCacheEncoder::encodeFunctionExecutable(UnlinkedFunctionExecutable* executable)
+{
+    if (executable->m_isBuiltinFunction) {
+        m_failed = true;
+        return;
+    }
+
+    encodePOD<uint32_t>(executable->m_numCapturedVariables);
+    encodeBool(executable->m_forceUsesArguments);
+    encodeBool(executable->m_isInStrictContext);
+    encodeBool(executable->m_hasCapturedVariables);
+    encodeBool(executable->m_isFromGlobalCode);
+    encodeIdentifier(executable->m_name);
+    encodeIdentifier(executable->m_inferredName);
+
+    // Deconstructing parameters carry a pattern AST that we do not persist.
+    FunctionParameters& parameters = *executable->m_parameters;
+    encodePOD<uint32_t>(parameters.size());
+    for (unsigned i = 0; i < parameters.size(); ++i) {
+        DeconstructionPatternNode* pattern = parameters.at(i);
+        if (!pattern->isBindingNode()) {
+            m_failed = true;
+            return;
+        }
+        BindingNode* binding = static_cast<BindingNode*>(pattern);
+        encodeIdentifier(binding->boundProperty());
+        encodeTextPosition(binding->divotStart());
+        encodeTextPosition(binding->divotEnd());
+    }
+
+    encodePOD<uint32_t>(executable->m_firstLineOffset);
+    encodePOD<uint32_t>(executable->m_lineCount);
+    encodePOD<uint32_t>(executable->m_unlinkedFunctionNameStart);
+    encodePOD<uint32_t>(executable->m_unlinkedBodyStartColumn);
+    encodePOD<uint32_t>(executable->m_unlinkedBodyEndColumn);
+    encodePOD<uint32_t>(executable->m_startOffset);
+    encodePOD<uint32_t>(executable->m_sourceLength);
+    encodePOD<uint32_t>(executable->m_features);
+    encodePOD<uint8_t>(executable->m_functionMode);
+}
+
+void PersistentCodeCacheEncoder::encodeCodeBlock(UnlinkedCodeBlock* codeBlock)
+{
+    encodeBool(codeBlock->m_needsFullScopeChain);
+    encodeBool(codeBlock->m_usesEval);
+    encodeBool(codeBlock->m_isStrictMode);
+    encodeBool(codeBlock->m_isConstructor);
+    encodeBool(codeBlock->m_isBuiltinFunction);
+    encodeBool(codeBlock->m_isNumericCompareFunction);
+    encodeBool(codeBlock->m_hasCapturedVariables);
+
+    encodePOD<int32_t>(codeBlock->m_numVars);
+    encodePOD<int32_t>(codeBlock->m_numCapturedVars);
+    encodePOD<int32_t>(codeBlock->m_numCalleeRegisters);
+    encodePOD<int32_t>(codeBlock->m_numParameters);
+    encodePOD<int32_t>(codeBlock->m_thisRegister.offset());
+    encodePOD<int32_t>(codeBlock->m_argumentsRegister.offset());
+    encodePOD<int32_t>(codeBlock->m_activationRegister.offset());
+    encodePOD<int32_t>(codeBlock->m_globalObjectRegister.offset());
+    encodePOD<uint32_t>(codeBlock->m_firstLine);
+    encodePOD<uint32_t>(codeBlock->m_lineCount);
+    encodePOD<uint32_t>(codeBlock->m_endColumn);
+    encodePOD<uint32_t>(codeBlock->m_features);
+
+    const UnlinkedInstructionStream& instructions = codeBlock->instructions();
+    encodePOD<uint32_t>(instructions.m_instructionCount);
+    encodePOD<uint32_t>(instructions.m_data.size());
+    m_buffer.append(instructions.m_data.data(), instructions.m_data.size());
+
+    encodePODVector(codeBlock->m_jumpTargets);
+
+    encodePOD<uint32_t>(codeBlock->m_identifiers.size());
+    for (size_t i = 0; i < codeBlock->m_identifiers.size(); ++i)
+        encodeIdentifier(codeBlock->m_identifiers[i]);
+
+    encodePOD<uint32_t>(codeBlock->m_constantRegisters.size());
+    for (size_t i = 0; i < codeBlock->m_constantRegisters.size(); ++i)
+        encodeConstant(codeBlock->m_constantRegisters[i].get());
+
+    encodePOD<uint32_t>(codeBlock->m_functionDecls.size());
+    for (size_t i = 0; i < codeBlock->m_functionDecls.size(); ++i)
+        encodeFunctionExecutable(codeBlock->m_functionDecls[i].get());
+
+    encodePOD<uint32_t>(codeBlock->m_functionExprs.size());
+    for (size_t i = 0; i < codeBlock->m_functionExprs.size(); ++i)
+        encodeFunctionExecutable(codeBlock->m_functionExprs[i].get());
+
+    encodePODVector(codeBlock->m_propertyAccessInstructions);
+
+    encodePOD<uint32_t>(codeBlock->m_arrayProfileCount);
+    encodePOD<uint32_t>(codeBlock->m_arrayAllocationProfileCount);
+    encodePOD<uint32_t>(codeBlock->m_objectAllocationProfileCount);
+    encodePOD<uint32_t>(codeBlock->m_valueProfileCount);
+    encodePOD<uint32_t>(codeBlock->m_llintCallLinkInfoCount);
+
+    encodePODVector(codeBlock->m_expressionInfo);
+
+    UnlinkedCodeBlock::RareData* rareData = codeBlock->m_rareData.get();
+    encodeBool(rareData);
+    if (!rareData)
+        return;
+
+    encodePODVector(rareData->m_exceptionHandlers);
+
+    encodePOD<uint32_t>(rareData->m_regexps.size());
+    for (size_t i = 0; i < rareData->m_regexps.size(); ++i) {
+        RegExp* regExp = rareData->m_regexps[i].get();
+        encodeString(regExp->pattern());
+        encodeBool(regExp->global());
+        encodeBool(regExp->ignoreCase());
+        encodeBool(regExp->multiline());
+    }
+
+    encodePOD<uint32_t>(rareData->m_constantBuffers.size());
+    for (size_t i = 0; i < rareData->m_constantBuffers.size(); ++i) {
+        const UnlinkedCodeBlock::ConstantBuffer& constantBuffer = rareData->m_constantBuffers[i];
+        encodePOD<uint32_t>(constantBuffer.size());
+        for (size_t j = 0; j < constantBuffer.size(); ++j)
+            encodeConstant(constantBuffer[j], codeBlock);
+    }
+
+    encodePOD<uint32_t>(rareData->m_switchJumpTables.size());
+    for (size_t i = 0; i < rareData->m_switchJumpTables.size(); ++i) {
+        encodePODVector(rareData->m_switchJumpTables[i].branchOffsets);
+        encodePOD<int32_t>(rareData->m_switchJumpTables[i].min);
+    }
+
+    encodePOD<uint32_t>(rareData->m_stringSwitchJumpTables.size());
+    for (size_t i = 0; i < rareData->m_stringSwitchJumpTables.size(); ++i) {
+        const UnlinkedStringJumpTable::StringOffsetTable& offsetTable = rareData->m_stringSwitchJumpTables[i].offsetTable;
+        encodePOD<uint32_t>(offsetTable.size());
+        for (auto it = offsetTable.begin(), end = offsetTable.end(); it != end; ++it) {
+            encodeString(it->key.get());
+            encodePOD<int32_t>(it->value);
+        }
+    }
+
+    encodePODVector(rareData->m_expressionInfoFatPositions);
+}
+
+void PersistentCodeCacheEncoder::encodeProgramCodeBlock(UnlinkedProgramCodeBlock* codeBlock)
+{
+    ASSERT(codeBlock->codeType() == GlobalCode);
+    encodeCodeBlock(codeBlock);
+
+    encodePOD<uint32_t>(codeBlock->m_varDeclarations.size());
+    for (size_t i = 0; i < codeBlock->m_varDeclarations.size(); ++i) {
+        encodeIdentifier(codeBlock->m_varDeclarations[i].first);
+        encodeBool(codeBlock->m_varDeclarations[i].second);
+    }
+
+    encodePOD<uint32_t>(codeBlock->m_functionDeclarations.size());
+    for (size_t i = 0; i < codeBlock->m_functionDeclarations.size(); ++i) {
+        encodeIdentifier(codeBlock->m_functionDeclarations[i].first);
+        encodeFunctionExecutable(codeBlock->m_functionDeclarations[i].second.get());
+    }
+}
+
+class PersistentCodeCacheDecoder {
+public:
+    PersistentCodeCacheDecoder(VM& vm, const uint8_t* data, size_t size)
+        : m_vm(vm)
+        , m_position(data)
+        , m_end(data + size)
+    {
+    }
+
+    UnlinkedProgramCodeBlock* decodeProgramCodeBlock();
+
+private:
+    bool decodeBytes(void* destination, size_t size)
+    {
+        if (static_cast<size_t>(m_end - m_position) < size)
+            return false;
+        memcpy(destination, m_position, size);
+        m_position += size;
+        return true;
+    }
+
+    template<typename T> bool decodePOD(T& value)
+    {
+        return decodeBytes(&value, sizeof(T));
+    }
+
+    template<typename T, size_t inlineCapacity, typename OverflowHandler>
+    bool decodePODVector(Vector<T, inlineCapacity, OverflowHandler>& vector)
+    {
+        uint32_t size;
+        if (!decodePOD(size))
+            return false;
+        if (static_cast<size_t>(m_end - m_position) / sizeof(T) < size)
+            return false;
+        vector.resizeToFit(size);
+        return decodeBytes(vector.data(), size * sizeof(T));
+    }
+
+    bool decodeBool(bool& value)
+    {
+        uint8_t byte;
+        if (!decodePOD(byte) || byte > 1)
+            return false;
+        value = byte;
+        return true;
+    }
+
+    bool decodeString(String&);
+    bool decodeIdentifier(Identifier&);
+    bool decodeTextPosition(JSTextPosition&);
+    bool decodeConstant(JSValue&, const UnlinkedCodeBlock* = 0);
+    bool decodeCodeBlock(UnlinkedCodeBlock*);
+    UnlinkedFunctionExecutable* decodeFunctionExecutable();
+    bool decodeExecutableInfo(ExecutableInfo&);
+
+    VM& m_vm;
+    const uint8_t* m_position;
+    const uint8_t* m_end;
+};
+
+bool PersistentCodeCacheDecoder::decodeString(String& string)
+{
+    uint32_t length;
+    if (!decodePOD(length))
+        return false;
+    if (length == UINT_MAX) {
+        string = String();
+        return true;
+    }
+
+    bool is8Bit;
+    if (!decodeBool(is8Bit))
+        return false;
+    size_t characterSize = is8Bit ? sizeof(LChar) : sizeof(UChar);
+    if (static_cast<size_t>(m_end - m_position) / characterSize < length)
+        return false;
+
+    if (is8Bit) {
+        LChar* characters;
+        string = StringImpl::createUninitialized(length, characters);
+        return decodeBytes(characters, length * sizeof(LChar));
+    }
+    UChar* characters;
+    string = StringImpl::createUninitialized(length, characters);
+    return decodeBytes(characters, length * sizeof(UChar));
+}
+
+bool PersistentCodeCacheDecoder::decodeIdentifier(Identifier& identifier)
+{
+    String string;
+    if (!decodeString(string))
+        return false;
+    identifier = string.isNull() ? Identifier() : Identifier(&m_vm, string);
+    return true;
+}
+
+bool PersistentCodeCacheDecoder::decodeTextPosition(JSTextPosition& position)
+{
+    return decodePOD(position.line) && decodePOD(position.offset) && decodePOD(position.lineStartOffset);
+}
+
+bool PersistentCodeCacheDecoder::decodeConstant(JSValue& value, const UnlinkedCodeBlock* constantPool)
+{
+    uint8_t tag;
+    if (!decodePOD(tag))
+        return false;
+
+    switch (tag) {
+    case EmptyConstantTag:
+        value = JSValue();
+        return true;
+    case UndefinedConstantTag:
+        value = jsUndefined();
+        return true;
+    case NullConstantTag:
+        value = jsNull();
+        return true;
+    case TrueConstantTag:
+        value = jsBoolean(true);
+        return true;
+    case FalseConstantTag:
+        value = jsBoolean(false);
+        return true;
+    case Int32ConstantTag: {
+        int32_t number;
+        if (!decodePOD(number))
+            return false;
+        value = jsNumber(number);
+        return true;
+    }
+    case DoubleConstantTag: {
+        double number;
+        if (!decodePOD(number))
+            return false;
+        value = JSValue(JSValue::EncodeAsDouble, number);
+        return true;
+    }
+    case StringConstantTag: {
+        String string;
+        if (!decodeString(string) || string.isNull())
+            return false;
+        value = jsString(&m_vm, string);
+        return true;
+    }
+    case ConstantRegisterConstantTag: {
+        uint32_t index;
+        if (!constantPool || !decodePOD(index) || index >= constantPool->m_constantRegisters.size())
+            return false;
+        value = constantPool->m_constantRegisters[index].get();
+        return true;
+    }
+    }
+    return false;
+}
+
+UnlinkedFunctionExecutable* PersistentCodeCacheDecoder::decodeFunctionExecutable()
+{
+    UnlinkedFunctionExecutable* executable = new (NotNull, allocateCell<UnlinkedFunctionExecutable>(m_vm.heap)) UnlinkedFunctionExecutable(&m_vm, m_vm.unlinkedFunctionExecutableStructure.get());
+
+    uint32_t numCapturedVariables;
+    bool forceUsesArguments;
+    bool isInStrictContext;
+    bool hasCapturedVariables;
+    bool isFromGlobalCode;
+    if (!decodePOD(numCapturedVariables)
+        || !decodeBool(forceUsesArguments)
+        || !decodeBool(isInStrictContext)
+        || !decodeBool(hasCapturedVariables)
+        || !decodeBool(isFromGlobalCode)
+        || !decodeIdentifier(executable->m_name)
+        || !decodeIdentifier(executable->m_inferredName))
+        return 0;
+    executable->m_numCapturedVariables = numCapturedVariables;
+    executable->m_forceUsesArguments = forceUsesArguments;
+    executable->m_isInStrictContext = isInStrictContext;
+    executable->m_hasCapturedVariables = hasCapturedVariables;
+    executable->m_isFromGlobalCode = isFromGlobalCode;
+
+    uint32_t parameterCount;
+    if (!decodePOD(parameterCount))
+        return 0;
+    Vector<RefPtr<DeconstructionPatternNode>> parameters;
+    for (uint32_t i = 0; i < parameterCount; ++i) {
+        Identifier boundProperty;
+        JSTextPosition divotStart;
+        JSTextPosition divotEnd;
+        if (!decodeIdentifier(boundProperty) || !decodeTextPosition(divotStart) || !decodeTextPosition(divotEnd))
+            return 0;
+        parameters.append(BindingNode::create(&m_vm, boundProperty, divotStart, divotEnd));
+    }
+    executable->m_parameters = FunctionParameters::create(parameters);
+
+    uint8_t functionMode;
+    if (!decodePOD(executable->m_firstLineOffset)
+        || !decodePOD(executable->m_lineCount)
+        || !decodePOD(executable->m_unlinkedFunctionNameStart)
+        || !decodePOD(executable->m_unlinkedBodyStartColumn)
+        || !decodePOD(executable->m_unlinkedBodyEndColumn)
+        || !decodePOD(executable->m_startOffset)
+        || !decodePOD(executable->m_sourceLength)
+        || !decodePOD(executable->m_features)
+        || !decodePOD(functionMode)
+        || functionMode > FunctionDeclaration)
+        return 0;
+    executable->m_functionMode = static_cast<enum FunctionMode>(functionMode);
+
+    executable->finishCreation(m_vm);
+    return executable;
+}
+
+bool PersistentCodeCacheDecoder::decodeExecutableInfo(ExecutableInfo& info)
+{
+    bool needsActivation;
+    bool usesEval;
+    bool isStrictMode;
+    bool isConstructor;
+    bool isBuiltinFunction;
+    if (!decodeBool(needsActivation)
+        || !decodeBool(usesEval)
+        || !decodeBool(isStrictMode)
+        || !decodeBool(isConstructor)
+        || !decodeBool(isBuiltinFunction))
+        return false;
+    info = ExecutableInfo(needsActivation, usesEval, isStrictMode, isConstructor, isBuiltinFunction);
+    return true;
+}
+
+bool PersistentCodeCacheDecoder::decodeCodeBlock(UnlinkedCodeBlock* codeBlock)
+{
+    bool isNumericCompareFunction;
+    bool hasCapturedVariables;
+    if (!decodeBool(isNumericCompareFunction) || !decodeBool(hasCapturedVariables))
+        return false;
+    codeBlock->m_isNumericCompareFunction = isNumericCompareFunction;
+    codeBlock->m_hasCapturedVariables = hasCapturedVariables;
+
+    int32_t thisRegister;
+    int32_t argumentsRegister;
+    int32_t activationRegister;
+    int32_t globalObjectRegister;
+    if (!decodePOD(codeBlock->m_numVars)
+        || !decodePOD(codeBlock->m_numCapturedVars)
+        || !decodePOD(codeBlock->m_numCalleeRegisters)
+        || !decodePOD(codeBlock->m_numParameters)
+        || !decodePOD(thisRegister)
+        || !decodePOD(argumentsRegister)
+        || !decodePOD(activationRegister)
+        || !decodePOD(globalObjectRegister)
+        || !decodePOD(codeBlock->m_firstLine)
+        || !decodePOD(codeBlock->m_lineCount)
+        || !decodePOD(codeBlock->m_endColumn)
+        || !decodePOD(codeBlock->m_features))
+        return false;
+    codeBlock->m_thisRegister = VirtualRegister(thisRegister);
+    codeBlock->m_argumentsRegister = VirtualRegister(argumentsRegister);
+    codeBlock->m_activationRegister = VirtualRegister(activationRegister);
+    codeBlock->m_globalObjectRegister = VirtualRegister(globalObjectRegister);
+
+    uint32_t instructionCount;
+    uint32_t instructionDataSize;
+    if (!decodePOD(instructionCount) || !decodePOD(instructionDataSize))
+        return false;
+    if (static_cast<size_t>(m_end - m_position) < instructionDataSize)
+        return false;
+    RefCountedArray<unsigned char> instructionData(instructionDataSize);
+    if (!decodeBytes(instructionData.data(), instructionDataSize))
+        return false;
+    codeBlock->setInstructions(std::unique_ptr<UnlinkedInstructionStream>(new UnlinkedInstructionStream(instructionData, instructionCount)));
+
+    if (!decodePODVector(codeBlock->m_jumpTargets))
+        return false;
+
+    uint32_t count;
+    if (!decodePOD(count))
+        return false;
+    for (uint32_t i = 0; i < count; ++i) {
+        Identifier identifier;
+        if (!decodeIdentifier(identifier))
+            return false;
+        codeBlock->addIdentifier(identifier);
+    }
+
+    if (!decodePOD(count))
+        return false;
+    for (uint32_t i = 0; i < count; ++i) {
+        JSValue constant;
+        if (!decodeConstant(constant))
+            return false;
+        codeBlock->addConstant(constant);
+    }
+
+    if (!decodePOD(count))
+        return false;
+    for (uint32_t i = 0; i < count; ++i) {
+        UnlinkedFunctionExecutable* executable = decodeFunctionExecutable();
+        if (!executable)
+            return false;
+        codeBlock->addFunctionDecl(executable);
+    }
+
+    if (!decodePOD(count))
+        return false;
+    for (uint32_t i = 0; i < count; ++i) {
+        UnlinkedFunctionExecutable* executable = decodeFunctionExecutable();
+        if (!executable)
+            return false;
+        codeBlock->addFunctionExpr(executable);
+    }
+
+    if (!decodePODVector(codeBlock->m_propertyAccessInstructions)
+        || !decodePOD(codeBlock->m_arrayProfileCount)
+        || !decodePOD(codeBlock->m_arrayAllocationProfileCount)
+        || !decodePOD(codeBlock->m_objectAllocationProfileCount)
+        || !decodePOD(codeBlock->m_valueProfileCount)
+        || !decodePOD(codeBlock->m_llintCallLinkInfoCount)
+        || !decodePODVector(codeBlock->m_expressionInfo))
+        return false;
+
+    bool hasRareData;
+    if (!decodeBool(hasRareData))
+        return false;
+    if (!hasRareData)
+        return true;
+
+    codeBlock->createRareDataIfNecessary();
+    UnlinkedCodeBlock::RareData* rareData = codeBlock->m_rareData.get();
+
+    if (!decodePODVector(rareData->m_exceptionHandlers))
+        return false;
+
+    if (!decodePOD(count))
+        return false;
+    for (uint32_t i = 0; i < count; ++i) {
+        String pattern;
+        bool global;
+        bool ignoreCase;
+        bool multiline;
+        if (!decodeString(pattern) || !decodeBool(global) || !decodeBool(ignoreCase) || !decodeBool(multiline))
+            return false;
+        unsigned flags = NoFlags;
+        if (global)
+            flags |= FlagGlobal;
+        if (ignoreCase)
+            flags |= FlagIgnoreCase;
+        if (multiline)
+            flags |= FlagMultiline;
+        codeBlock->addRegExp(RegExp::create(m_vm, pattern, static_cast<RegExpFlags>(flags)));
+    }
+
+    if (!decodePOD(count))
+        return false;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t length;
+        if (!decodePOD(length))
+            return false;
+        UnlinkedCodeBlock::ConstantBuffer& constantBuffer = codeBlock->constantBuffer(codeBlock->addConstantBuffer(0));
+        for (uint32_t j = 0; j < length; ++j) {
+            JSValue constant;
+            if (!decodeConstant(constant, codeBlock))
+                return false;
+            constantBuffer.append(constant);
+        }
+    }
+
+    if (!decodePOD(count))
+        return false;
+    for (uint32_t i = 0; i < count; ++i) {
+        UnlinkedSimpleJumpTable& jumpTable = codeBlock->addSwitchJumpTable();
+        if (!decodePODVector(jumpTable.branchOffsets) || !decodePOD(jumpTable.min))
+            return false;
+    }
+
+    if (!decodePOD(count))
+        return false;
+    for (uint32_t i = 0; i < count; ++i) {
+        UnlinkedStringJumpTable& jumpTable = codeBlock->addStringSwitchJumpTable();
+        uint32_t size;
+        if (!decodePOD(size))
+            return false;
+        for (uint32_t j = 0; j < size; ++j) {
+            String key;
+            int32_t offset;
+            if (!decodeString(key) || key.isNull() || !decodePOD(offset))
+                return false;
+            jumpTable.offsetTable.add(key.impl(), offset);
+        }
+    }
+
+    return decodePODVector(rareData->m_expressionInfoFatPositions);
+}
+
+UnlinkedProgramCodeBlock* PersistentCodeCacheDecoder::decodeProgramCodeBlock()
+{
+    ExecutableInfo info(false, false, false, false, false);
+    if (!decodeExecutableInfo(info))
+        return 0;
+
+    UnlinkedProgramCodeBlock* codeBlock = UnlinkedProgramCodeBlock::create(&m_vm, info);
+    if (!decodeCodeBlock(codeBlock))
+        return 0;
+
+    uint32_t count;
+    if (!decodePOD(count))
+        return 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        Identifier name;
+        bool isConstant;
+        if (!decodeIdentifier(name) || !decodeBool(isConstant))
+            return 0;
+        codeBlock->addVariableDeclaration(name, isConstant);
+    }
+
+    if (!decodePOD(count))
+        return 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        Identifier name;
+        if (!decodeIdentifier(name))
+            return 0;
+        UnlinkedFunctionExecutable* executable = decodeFunctionExecutable();
+        if (!executable)
+            return 0;
+        codeBlock->addFunctionDeclaration(m_vm, name, executable);
+    }
+
+    if (m_position != m_end)
+        return 0;
+    return codeBlock;
+}
+
+bool PersistentCodeCache::encode(UnlinkedProgramCodeBlock* codeBlock, Vector<uint8_t>& result)
+{
+    PersistentCodeCacheEncoder encoder;
+    encoder.encodeProgramCodeBlock(codeBlock);
+    if (encoder.failed())
+        return false;
+    result = encoder.takeBuffer();
+    return true;
+}
+
+UnlinkedProgramCodeBlock* PersistentCodeCache::decode(VM& vm, const uint8_t* data, size_t size)
+{
+    PersistentCodeCacheDecoder decoder(vm, data, size);
+    return decoder.decodeProgramCodeBlock();
+}
+
+PersistentCodeCache::PersistentCodeCache(const char* directory)
+    : m_directory(directory)
+{
+}
+
+PassOwnPtr<PersistentCodeCache> PersistentCodeCache::create(const char* directory)
+{
+#if OS(UNIX)
+    if (!directory || !*directory)
+        return nullptr;
+    return adoptPtr(new PersistentCodeCache(directory));
+#else
+    UNUSED_PARAM(directory);
+    return nullptr;
+#endif
+}
+
+SHA1::Digest PersistentCodeCache::computeDigest(const SourceCodeKey& key)
+{
+    SHA1 sha1;
+    unsigned flags = key.flags();
+    sha1.addBytes(reinterpret_cast<const uint8_t*>(&flags), sizeof(flags));
+    sha1.addBytes(key.name().utf8());
+
+    String source = key.string();
+    if (source.is8Bit())
+        sha1.addBytes(source.characters8(), source.length());
+    else
+        sha1.addBytes(reinterpret_cast<const uint8_t*>(source.characters16()), source.length() * sizeof(UChar));
+
+    SHA1::Digest digest;
+    sha1.computeHash(digest);
+    return digest;
+}
+
+CString PersistentCodeCache::pathForDigest(const SHA1::Digest& digest) const
+{
+    StringBuilder builder;
+    builder.append(m_directory.data());
+    builder.append('/');
+    for (size_t i = 0; i < digest.size(); ++i) {
+        builder.append(lowerNibbleToASCIIHexDigit(digest[i] >> 4));
+        builder.append(lowerNibbleToASCIIHexDigit(digest[i]));
+    }
+    builder.appendLiteral(".jsccache");
+    return builder.toString().utf8();
+}
+
+#if OS(UNIX)
+
+UnlinkedProgramCodeBlock* PersistentCodeCache::load(VM& vm, const SourceCodeKey& key)
+{
+    SHA1::Digest digest = computeDigest(key);
+    CString path = pathForDigest(digest);
+
+    int fd = open(path.data(), O_RDONLY);
+    if (fd == -1)
+        return 0;
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) || fileStat.st_size < static_cast<off_t>(sizeof(PersistentCodeCacheHeader))) {
+        close(fd);
+        return 0;
+    }
+
+    size_t fileSize = fileStat.st_size;
+    void* fileData = mmap(0, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (fileData == MAP_FAILED)
+        return 0;
+
+    UnlinkedProgramCodeBlock* codeBlock = 0;
+    PersistentCodeCacheHeader header;
+    memcpy(&header, fileData, sizeof(header));
+    const uint8_t* payload = static_cast<const uint8_t*>(fileData) + sizeof(header);
+    if (header.magic == persistentCodeCacheMagic
+        && header.formatVersion == persistentCodeCacheFormatVersion
+        && header.buildSignature == computeBuildSignature()
+        && header.digest == digest) {
+        // The decoder trusts the payload, so refuse to decode a truncated or corrupted
+        // entry, and remove it so that the next store() replaces it.
+        if (header.payloadSize == fileSize - sizeof(header) && header.payloadDigest == computePayloadDigest(payload, header.payloadSize)) {
+            PersistentCodeCacheDecoder decoder(vm, payload, header.payloadSize);
+            codeBlock = decoder.decodeProgramCodeBlock();
+        } else
+            unlink(path.data());
+    }
+
+    munmap(fileData, fileSize);
+    return codeBlock;
+}
+
+static bool writeAll(int fd, const uint8_t* data, size_t size)
+{
+    while (size) {
+        ssize_t written = write(fd, data, size);
+        if (written == -1) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += written;
+        size -= written;
+    }
+    return true;
+}
+
+struct PendingCacheWrite {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    CString path;
+    Vector<uint8_t> contents;
+};
+
+// Writes cache entries on a background thread, so that storing a freshly
+// compiled program never blocks the thread that is about to run it.
+class PersistentCodeCacheWriter {
+    WTF_MAKE_NONCOPYABLE(PersistentCodeCacheWriter);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static PersistentCodeCacheWriter& shared();
+
+    void enqueue(std::unique_ptr<PendingCacheWrite>);
+
+private:
+    PersistentCodeCacheWriter();
+
+    static void threadFunction(void*);
+    void runThread();
+    static void write(const PendingCacheWrite&);
+
+    Mutex m_lock;
+    ThreadCondition m_writeEnqueued;
+    Deque<std::unique_ptr<PendingCacheWrite>> m_queue;
+};
+
+PersistentCodeCacheWriter& PersistentCodeCacheWriter::shared()
+{
+    static PersistentCodeCacheWriter* writer;
+    static std::once_flag onceFlag;
+    std::call_once(onceFlag, [] {
+        writer = new PersistentCodeCacheWriter;
+    });
+    return *writer;
+}
+
+PersistentCodeCacheWriter::PersistentCodeCacheWriter()
+{
+    ThreadIdentifier identifier = createThread(threadFunction, this, "JSC Persistent Code Cache Writer");
+    detachThread(identifier);
+}
+
+void PersistentCodeCacheWriter::enqueue(std::unique_ptr<PendingCacheWrite> pendingWrite)
+{
+    MutexLocker locker(m_lock);
+    m_queue.append(std::move(pendingWrite));
+    m_writeEnqueued.signal();
+}
+
+void PersistentCodeCacheWriter::threadFunction(void* argument)
+{
+    static_cast<PersistentCodeCacheWriter*>(argument)->runThread();
+}
+
+void PersistentCodeCacheWriter::runThread()
+{
+    while (true) {
+        std::unique_ptr<PendingCacheWrite> pendingWrite;
+        {
+            MutexLocker locker(m_lock);
+            while (m_queue.isEmpty())
+                m_writeEnqueued.wait(m_lock);
+            pendingWrite = m_queue.takeFirst();
+        }
+        write(*pendingWrite);
+    }
+}
+
+void PersistentCodeCacheWriter::write(const PendingCacheWrite& pendingWrite)
+{
+    // Write to a private file and rename it into place, so that concurrent
+    // readers never observe a partially written entry.
+    CString temporaryPath = String::format("%s.%d", pendingWrite.path.data(), getpid()).utf8();
+    int fd = open(temporaryPath.data(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd == -1)
+        return;
+
+    bool success = writeAll(fd, pendingWrite.contents.data(), pendingWrite.contents.size());
+    success = !close(fd) && success;
+    if (!success || rename(temporaryPath.data(), pendingWrite.path.data()))
+        unlink(temporaryPath.data());
+}
+
+void PersistentCodeCache::store(VM&, const SourceCodeKey& key, UnlinkedProgramCodeBlock* codeBlock)
+{
+    PersistentCodeCacheEncoder encoder;
+    encoder.encodeProgramCodeBlock(codeBlock);
+    if (encoder.failed())
+        return;
+
+    PersistentCodeCacheHeader header;
+    header.magic = persistentCodeCacheMagic;
+    header.formatVersion = persistentCodeCacheFormatVersion;
+    header.buildSignature = computeBuildSignature();
+    header.payloadSize = encoder.buffer().size();
+    header.digest = computeDigest(key);
+    header.payloadDigest = computePayloadDigest(encoder.buffer().data(), encoder.buffer().size());
+
+    // Encoding walks the code block, so it has to happen here; only the file I/O is deferred.
+    auto pendingWrite = std::make_unique<PendingCacheWrite>();
+    pendingWrite->path = pathForDigest(header.digest);
+    pendingWrite->contents.reserveInitialCapacity(sizeof(header) + encoder.buffer().size());
+    pendingWrite->contents.append(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+    pendingWrite->contents.append(encoder.buffer().data(), encoder.buffer().size());
+    PersistentCodeCacheWriter::shared().enqueue(std::move(pendingWrite));
+}
+
+#else
+
+UnlinkedProgramCodeBlock* PersistentCodeCache::load(VM&, const SourceCodeKey&)
+{
+    return 0;
+}
+
+void PersistentCodeCache::store(VM&, const SourceCodeKey&, UnlinkedProgramCodeBlock*)
+{
+}
+
+#endif // OS(UNIX)
+
+} // namespace JSC
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PersistentCodeCache_h
+#define PersistentCodeCache_h
+
+#include <wtf/Noncopyable.h>
+#include <wtf/PassOwnPtr.h>
+#include <wtf/SHA1.h>
+#include <wtf/Vector.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/WTFString.h>
+
+namespace JSC {
+
+class SourceCodeKey;
+class UnlinkedProgramCodeBlock;
+class VM;
+
+// Stores unlinked program code blocks on disk so that a later process that
+// evaluates the same script (same source, name, and strictness) can skip
+// parsing and bytecode generation entirely. Entries are named after a SHA-1
+// of the SourceCodeKey contents, are written out on a background thread, and
+// are memory mapped when they are read back. Enabled by pointing
+// Options::diskCodeCachePath() at a directory.
+class PersistentCodeCache {
+    WTF_MAKE_NONCOPYABLE(PersistentCodeCache);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static PassOwnPtr<PersistentCodeCache> create(const char* directory);
+
+    UnlinkedProgramCodeBlock* load(VM&, const SourceCodeKey&);
+    void store(VM&, const SourceCodeKey&, UnlinkedProgramCodeBlock*);
+
+    // In-memory form of the on-disk payload, for moving a code block between VMs.
+    static bool encode(UnlinkedProgramCodeBlock*, Vector<uint8_t>& result);
+    static UnlinkedProgramCodeBlock* decode(VM&, const uint8_t* data, size_t size);
+
+private:
+    explicit PersistentCodeCache(const char* directory);
+
+    static SHA1::Digest computeDigest(const SourceCodeKey&);
+    CString pathForDigest(const SHA1::Digest&) const;
+
+    CString m_directory;
+};
+
+} // namespace JSC
+
+#endif // PersistentCodeCache_h
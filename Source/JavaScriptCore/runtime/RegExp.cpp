@@ -243,8 +243,10 @@ void RegExp::finishCreation(VM& vm)
     Yarr::YarrPattern pattern(m_patternString, ignoreCase(), multiline(), &m_constructionError);
     if (m_constructionError)
         m_state = ParseError;
-    else
+    else {
         m_numSubpatterns = pattern.m_numSubpatterns;
+        m_literalPrefix = Yarr::LiteralPrefix::create(pattern);
+    }
 }
 
 void RegExp::destroy(JSCell* cell)
@@ -324,6 +326,21 @@ void RegExp::compileIfNecessary(VM& vm, Yarr::YarrCharSize charSize)
     compile(&vm, charSize);
 }
 
+bool RegExp::skipToLiteralPrefix(const String& s, unsigned& startOffset) const
+{
+    if (!m_literalPrefix)
+        return true;
+
+    size_t prefixStart = s.is8Bit()
+        ? m_literalPrefix->find(s.characters8(), s.length(), startOffset)
+        : m_literalPrefix->find(s.characters16(), s.length(), startOffset);
+    if (prefixStart == notFound)
+        return false;
+    // No match can start before the first occurrence of the prefix.
+    startOffset = prefixStart;
+    return true;
+}
+
 int RegExp::match(VM& vm, const String& s, unsigned startOffset, Vector<int, 32>& ovector)
 {
 #if ENABLE(REGEXP_TRACING)
@@ -332,12 +349,19 @@ int RegExp::match(VM& vm, const String& s, unsigned startOffset, Vector<int, 32>
 #endif
 
     ASSERT(m_state != ParseError);
-    compileIfNecessary(vm, s.is8Bit() ? Yarr::Char8 : Yarr::Char16);
 
     int offsetVectorSize = (m_numSubpatterns + 1) * 2;
     ovector.resize(offsetVectorSize);
     int* offsetVector = ovector.data();
 
+    if (!skipToLiteralPrefix(s, startOffset)) {
+        for (int i = 0; i < offsetVectorSize; ++i)
+            offsetVector[i] = -1;
+        return -1;
+    }
+
+    compileIfNecessary(vm, s.is8Bit() ? Yarr::Char8 : Yarr::Char16);
+
     int result;
 #if ENABLE(YARR_JIT)
     if (m_state == JITCode) {
@@ -455,6 +479,8 @@ MatchResult RegExp::match(VM& vm, const String& s, unsigned startOffset)
 #endif
 
     ASSERT(m_state != ParseError);
+    if (!skipToLiteralPrefix(s, startOffset))
+        return MatchResult::failed();
     compileIfNecessaryMatchOnly(vm, s.is8Bit() ? Yarr::Char8 : Yarr::Char16);
 
 #if ENABLE(YARR_JIT)
@@ -27,6 +27,7 @@
 #include "RegExpKey.h"
 #include "Structure.h"
 #include "yarr/Yarr.h"
+#include "yarr/YarrLiteralPrefix.h"
 #include <wtf/Forward.h>
 #include <wtf/RefCounted.h>
 #include <wtf/text/WTFString.h>
@@ -108,6 +109,8 @@ namespace JSC {
         void compileMatchOnly(VM*, Yarr::YarrCharSize);
         void compileIfNecessaryMatchOnly(VM&, Yarr::YarrCharSize);
 
+        bool skipToLiteralPrefix(const String&, unsigned& startOffset) const;
+
 #if ENABLE(YARR_JIT_DEBUG)
         void matchCompareWithInterpreter(const String&, int startOffset, int* offsetVector, int jitResult);
 #endif
@@ -129,6 +132,7 @@ namespace JSC {
         Yarr::YarrCodeBlock m_regExpJITCode;
 #endif
         OwnPtr<Yarr::BytecodePattern> m_regExpBytecode;
+        OwnPtr<Yarr::LiteralPrefix> m_literalPrefix;
     };
 
 } // namespace JSC
@@ -158,9 +158,9 @@ static inline JSString* jsStringWithReuse(ExecState* exec, JSValue originalValue
     return jsString(exec, string);
 }
 
-static NEVER_INLINE String substituteBackreferencesSlow(StringView replacement, StringView source, const int* ovector, RegExp* reg, size_t i)
+template<typename BuilderType>
+static void appendSubstitutedReplacement(BuilderType& substitutedReplacement, StringView replacement, StringView source, const int* ovector, RegExp* reg, size_t i)
 {
-    StringBuilder substitutedReplacement;
     int offset = 0;
     do {
         if (i + 1 == replacement.length())
@@ -219,7 +219,12 @@ static NEVER_INLINE String substituteBackreferencesSlow(StringView replacement,
 
     if (replacement.length() - offset)
         substitutedReplacement.append(replacement.substring(offset));
+}
 
+static NEVER_INLINE String substituteBackreferencesSlow(StringView replacement, StringView source, const int* ovector, RegExp* reg, size_t i)
+{
+    StringBuilder substitutedReplacement;
+    appendSubstitutedReplacement(substitutedReplacement, replacement, source, ovector, reg, i);
     return substitutedReplacement.toString();
 }
 
@@ -426,6 +431,56 @@ static NEVER_INLINE EncodedJSValue removeUsingRegExpSearch(ExecState* exec, JSSt
     return JSValue::encode(jsSpliceSubstrings(exec, string, source, sourceRanges.data(), sourceRanges.size()));
 }
 
+// A global replace with a string writes the unmatched parts of the source and the substituted
+// replacement straight into the result, without a String per match.
+static NEVER_INLINE EncodedJSValue replaceAllUsingRegExpSearchWithString(ExecState* exec, JSString* string, const String& source, RegExp* regExp, const String& replacement)
+{
+    size_t lastIndex = 0;
+    unsigned startPosition = 0;
+    bool matched = false;
+    size_t firstDollar = replacement.find('$');
+
+    JSStringBuilder result;
+    VM* vm = &exec->vm();
+    RegExpConstructor* regExpConstructor = exec->lexicalGlobalObject()->regExpConstructor();
+    StringView sourceView(source);
+    unsigned sourceLen = source.length();
+
+    while (true) {
+        int* ovector;
+        MatchResult match = regExpConstructor->performMatch(*vm, regExp, string, source, startPosition, &ovector);
+        if (!match)
+            break;
+        matched = true;
+
+        result.append(sourceView.substring(lastIndex, match.start - lastIndex));
+        if (firstDollar == notFound)
+            result.append(replacement);
+        else
+            appendSubstitutedReplacement(result, replacement, sourceView, ovector, regExp, firstDollar);
+
+        lastIndex = match.end;
+        startPosition = lastIndex;
+
+        // special case of empty match
+        if (match.empty()) {
+            startPosition++;
+            if (startPosition > sourceLen)
+                break;
+        }
+    }
+
+    if (!matched)
+        return JSValue::encode(string);
+
+    if (static_cast<unsigned>(lastIndex) < sourceLen)
+        result.append(sourceView.substring(lastIndex));
+
+    if (result.isEmpty())
+        return JSValue::encode(jsEmptyString(exec));
+    return JSValue::encode(result.build(exec));
+}
+
 static NEVER_INLINE EncodedJSValue replaceUsingRegExpSearch(ExecState* exec, JSString* string, JSValue searchValue)
 {
     JSValue replaceValue = exec->argument(1);
@@ -449,8 +504,11 @@ static NEVER_INLINE EncodedJSValue replaceUsingRegExpSearch(ExecState* exec, JSS
         if (exec->hadException())
             return JSValue::encode(JSValue());
 
-        if (callType == CallTypeNone && !replacementString.length())
-            return removeUsingRegExpSearch(exec, string, source, regExp);
+        if (callType == CallTypeNone) {
+            if (!replacementString.length())
+                return removeUsingRegExpSearch(exec, string, source, regExp);
+            return replaceAllUsingRegExpSearchWithString(exec, string, source, regExp, replacementString);
+        }
     }
 
     RegExpConstructor* regExpConstructor = exec->lexicalGlobalObject()->regExpConstructor();
@@ -698,18 +756,19 @@ EncodedJSValue JSC_HOST_CALL stringProtoFuncCharAt(ExecState* exec)
     JSValue thisValue = exec->thisValue();
     if (!checkObjectCoercible(thisValue))
         return throwVMTypeError(exec);
-    String s = thisValue.toString(exec)->value(exec);
-    unsigned len = s.length();
+    // getIndex finds the character without resolving the string if it is a rope.
+    JSString* string = thisValue.toString(exec);
+    unsigned len = string->length();
     JSValue a0 = exec->argument(0);
     if (a0.isUInt32()) {
         uint32_t i = a0.asUInt32();
         if (i < len)
-            return JSValue::encode(jsSingleCharacterSubstring(exec, s, i));
+            return JSValue::encode(string->getIndex(exec, i));
         return JSValue::encode(jsEmptyString(exec));
     }
     double dpos = a0.toInteger(exec);
     if (dpos >= 0 && dpos < len)
-        return JSValue::encode(jsSingleCharacterSubstring(exec, s, static_cast<unsigned>(dpos)));
+        return JSValue::encode(string->getIndex(exec, static_cast<unsigned>(dpos)));
     return JSValue::encode(jsEmptyString(exec));
 }
 
@@ -778,7 +837,12 @@ EncodedJSValue JSC_HOST_CALL stringProtoFuncIndexOf(ExecState* exec)
     if (thisJSString->length() < otherJSString->length() + pos)
         return JSValue::encode(jsNumber(-1));
 
-    size_t result = thisJSString->value(exec).find(otherJSString->value(exec), pos);
+    // Single characters are searched for without resolving a rope.
+    size_t result;
+    if (otherJSString->length() == 1)
+        result = thisJSString->find(exec, otherJSString->value(exec)[0], pos);
+    else
+        result = thisJSString->value(exec).find(otherJSString->value(exec), pos);
     if (result == notFound)
         return JSValue::encode(jsNumber(-1));
     return JSValue::encode(jsNumber(result));
@@ -915,8 +979,8 @@ EncodedJSValue JSC_HOST_CALL stringProtoFuncSlice(ExecState* exec)
     JSValue thisValue = exec->thisValue();
     if (!checkObjectCoercible(thisValue))
         return throwVMTypeError(exec);
-    String s = thisValue.toString(exec)->value(exec);
-    int len = s.length();
+    JSString* string = thisValue.toString(exec);
+    int len = string->length();
     RELEASE_ASSERT(len >= 0);
 
     JSValue a0 = exec->argument(0);
@@ -932,7 +996,7 @@ EncodedJSValue JSC_HOST_CALL stringProtoFuncSlice(ExecState* exec)
             from = 0;
         if (to > len)
             to = len;
-        return JSValue::encode(jsSubstring(exec, s, static_cast<unsigned>(from), static_cast<unsigned>(to) - static_cast<unsigned>(from)));
+        return JSValue::encode(jsSubstring(exec, string, static_cast<unsigned>(from), static_cast<unsigned>(to) - static_cast<unsigned>(from)));
     }
 
     return JSValue::encode(jsEmptyString(exec));
@@ -293,7 +293,13 @@ void Structure::materializePropertyMap(VM& vm)
     findStructuresAndMapForMaterialization(structures, structure, table);
     
     if (table) {
-        table = table->copy(vm, structure, numberOfSlotsForLastOffset(m_offset, m_inlineCapacity));
+        // An unpinned table can always be rebuilt from the transition chain, so take it
+        // instead of copying it. That way only one structure along an unpinned chain holds
+        // a property table at a time.
+        if (structure->m_isPinnedPropertyTable)
+            table = table->copy(vm, structure, numberOfSlotsForLastOffset(m_offset, m_inlineCapacity));
+        else
+            structure->propertyTable().clear();
         structure->m_lock.unlock();
     }
     
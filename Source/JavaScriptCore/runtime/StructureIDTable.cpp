@@ -35,31 +35,67 @@ namespace JSC {
 
 StructureIDTable::StructureIDTable()
     : m_firstFreeOffset(0)
-    , m_table(adoptPtr(new StructureOrOffset[s_initialSize]))
+    , m_table(0)
+    , m_reservationCommittedSize(0)
     , m_size(0)
-    , m_capacity(s_initialSize)
+    , m_capacity(0)
 {
+#if USE(JSVALUE64)
+    // PageReservation::reserve() crashes rather than fail.
+    m_reservation = PageReservation::reserve(s_reservedCapacity * sizeof(StructureOrOffset));
+    ASSERT(m_reservation);
+#endif
+    resize(s_initialSize);
+
     // We pre-allocate the first offset so that the null Structure
     // can still be represented as the StructureID '0'.
     allocateID(0);
 }
 
+StructureIDTable::~StructureIDTable()
+{
+    if (!m_reservation)
+        return;
+    if (m_reservationCommittedSize)
+        m_reservation.decommit(m_reservation.base(), m_reservationCommittedSize);
+    m_reservation.deallocate();
+}
+
 void StructureIDTable::resize(size_t newCapacity)
 {
+#if USE(JSVALUE64)
+    if (newCapacity <= s_reservedCapacity) {
+        // Commit more of the reservation. Existing entries stay where they are, so a
+        // concurrent reader holding the table pointer never sees a stale copy.
+        size_t newCommittedSize = WTF::roundUpToMultipleOf(pageSize(), newCapacity * sizeof(StructureOrOffset));
+        char* base = static_cast<char*>(m_reservation.base());
+        m_reservation.commit(base + m_reservationCommittedSize, newCommittedSize - m_reservationCommittedSize);
+        m_reservationCommittedSize = newCommittedSize;
+
+        WTF::storeStoreFence();
+        m_table = reinterpret_cast<StructureOrOffset*>(base);
+        m_capacity = newCommittedSize / sizeof(StructureOrOffset);
+        return;
+    }
+#endif
+
     // Create the new table.
     OwnPtr<StructureOrOffset> newTable = adoptPtr(new StructureOrOffset[newCapacity]);
 
     // Copy the contents of the old table to the new table.
-    memcpy(newTable.get(), table(), m_capacity * sizeof(StructureOrOffset));
+    if (m_capacity)
+        memcpy(newTable.get(), table(), m_capacity * sizeof(StructureOrOffset));
 
     // Store fence to make sure we've copied everything before doing the swap.
     WTF::storeStoreFence();
 
-    // Swap the old and new tables.
-    swap(m_table, newTable);
+    m_table = newTable.get();
 
-    // Put the old table (now labeled as new) into the list of old tables.
-    m_oldTables.append(newTable.release());
+    // Keep the old table alive until flushOldTables(), since a concurrent reader may
+    // still be using it. A table carved out of the reservation lives as long as we do.
+    if (m_ownedTable)
+        m_oldTables.append(m_ownedTable.release());
+    m_ownedTable = newTable.release();
 
     // Update the capacity.
     m_capacity = newCapacity;
@@ -28,6 +28,7 @@
 
 #include "UnusedPointer.h"
 #include <wtf/OwnPtr.h>
+#include <wtf/PageReservation.h>
 #include <wtf/Vector.h>
 
 namespace JSC {
@@ -44,6 +45,7 @@ class StructureIDTable {
     friend class LLIntOffsetsExtractor;
 public:
     StructureIDTable();
+    ~StructureIDTable();
 
     void** base() { return reinterpret_cast<void**>(&m_table); }
 
@@ -63,14 +65,28 @@ private:
         StructureID offset;
     };
 
-    StructureOrOffset* table() const { return m_table.get(); }
+    StructureOrOffset* table() const { return m_table; }
     
     static const size_t s_initialSize = 256;
+#if USE(JSVALUE64)
+    // The table grows in place within this much reserved address space, so entries
+    // never move and growing does not copy. Past it, we fall back to copying.
+    // Every VM reserves this, so keep it small where address space is scarce.
+#if PLATFORM(IOS)
+    static const size_t s_reservedCapacity = 1 << 18;
+#else
+    static const size_t s_reservedCapacity = 1 << 21;
+#endif
+#endif
 
     Vector<OwnPtr<StructureOrOffset>> m_oldTables;
 
     uint32_t m_firstFreeOffset;
-    OwnPtr<StructureOrOffset> m_table;
+    StructureOrOffset* m_table;
+    OwnPtr<StructureOrOffset> m_ownedTable;
+
+    PageReservation m_reservation;
+    size_t m_reservationCommittedSize;
 
     size_t m_size;
     size_t m_capacity;
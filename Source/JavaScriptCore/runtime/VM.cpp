@@ -61,6 +61,7 @@
 #include "JSLock.h"
 #include "JSNameScope.h"
 #include "JSNotAnObject.h"
+#include "JSONStringifyCache.h"
 #include "JSPromiseDeferred.h"
 #include "JSPromiseReaction.h"
 #include "JSPropertyNameIterator.h"
@@ -68,6 +69,7 @@
 #include "Lexer.h"
 #include "Lookup.h"
 #include "MapData.h"
+#include "MegamorphicAccessProfile.h"
 #include "Nodes.h"
 #include "Parser.h"
 #include "ParserArena.h"
@@ -75,6 +77,7 @@
 #include "PropertyMapHashTable.h"
 #include "RegExpCache.h"
 #include "RegExpObject.h"
+#include "SamplingProfiler.h"
 #include "SimpleTypedArrayController.h"
 #include "SourceProviderCache.h"
 #include "StrictEvalActivation.h"
@@ -200,6 +203,7 @@ VM::VM(VMType vmType, HeapType heapType)
     , propertyNames(nullptr)
     , emptyList(new MarkedArgumentBuffer)
     , parserArena(adoptPtr(new ParserArena))
+    , sharedSourceProviderCacheSourceLength(0)
     , keywords(adoptPtr(new Keywords(*this)))
     , interpreter(0)
     , jsArrayClassInfo(JSArray::info())
@@ -289,8 +293,10 @@ VM::VM(VMType vmType, HeapType heapType)
 #if ENABLE(JIT)
     jitStubs = adoptPtr(new JITThunks());
     arityCheckFailReturnThunks = std::make_unique<ArityCheckFailReturnThunks>();
+    megamorphicAccessProfile = std::make_unique<MegamorphicAccessProfile>();
 #endif
     arityCheckData = std::make_unique<CommonSlowPaths::ArityCheckData>();
+    jsonStringifyCache = std::make_unique<JSONStringifyCache>();
 
 #if ENABLE(FTL_JIT)
     ftlThunks = std::make_unique<FTL::Thunks>();
@@ -319,6 +325,9 @@ VM::VM(VMType vmType, HeapType heapType)
         m_perBytecodeProfiler->registerToSaveAtExit(pathOut.toCString().data());
     }
 
+    if (Options::useSamplingProfiler())
+        ensureSamplingProfiler().start();
+
 #if ENABLE(DFG_JIT)
     if (canUseJIT())
         dfgState = adoptPtr(new DFG::LongLivedState());
@@ -347,6 +356,7 @@ VM::~VM()
     
     // Clear this first to ensure that nobody tries to remove themselves from it.
     m_perBytecodeProfiler.clear();
+    m_samplingProfiler.clear();
     
     ASSERT(m_apiLock->currentThreadIsHoldingLock());
     m_apiLock->willDestroyVM(this);
@@ -543,11 +553,36 @@ void VM::dumpSampleData(ExecState* exec)
 #endif
 }
 
-SourceProviderCache* VM::addSourceProviderCache(SourceProvider* sourceProvider)
+static const unsigned minimumSourceLengthForSharedCache = 4096;
+static const size_t maximumSharedSourceProviderCacheSourceLength = 16 * MB;
+
+SourceProviderCache* VM::addSourceProviderCache(SourceProvider* sourceProvider, SourceProviderCacheSharing sharing)
 {
     auto addResult = sourceProviderCacheMap.add(sourceProvider, nullptr);
-    if (addResult.isNewEntry)
+    if (!addResult.isNewEntry)
+        return addResult.iterator->value.get();
+
+    // Cached positions are only meaningful for identical text starting at the same
+    // place, so only share caches between sources that start at the beginning.
+    const String& source = sourceProvider->source();
+    if (sharing == DontShareSourceProviderCache
+        || source.length() < minimumSourceLengthForSharedCache
+        || sourceProvider->startPosition() != TextPosition::minimumPosition()) {
         addResult.iterator->value = adoptRef(new SourceProviderCache);
+        return addResult.iterator->value.get();
+    }
+
+    auto key = std::make_pair(source, static_cast<unsigned>(sharing));
+    auto sharedIterator = sharedSourceProviderCacheMap.find(key);
+    if (sharedIterator == sharedSourceProviderCacheMap.end()) {
+        // The map keeps its source strings alive, so bound how much text it holds.
+        if (sharedSourceProviderCacheSourceLength + source.length() > maximumSharedSourceProviderCacheSourceLength)
+            clearSharedSourceProviderCaches();
+        sharedIterator = sharedSourceProviderCacheMap.add(key, adoptRef(new SourceProviderCache)).iterator;
+        sharedSourceProviderCacheSourceLength += source.length();
+    }
+
+    addResult.iterator->value = sharedIterator->value;
     return addResult.iterator->value.get();
 }
 
@@ -556,6 +591,12 @@ void VM::clearSourceProviderCaches()
     sourceProviderCacheMap.clear();
 }
 
+void VM::clearSharedSourceProviderCaches()
+{
+    sharedSourceProviderCacheMap.clear();
+    sharedSourceProviderCacheSourceLength = 0;
+}
+
 struct StackPreservingRecompiler : public MarkedBlock::VoidFunctor {
     HashSet<FunctionExecutable*> currentlyExecutingFunctions;
     void operator()(JSCell* cell)
@@ -919,6 +960,13 @@ void VM::setEnabledProfiler(LegacyProfiler* profiler)
     }
 }
 
+SamplingProfiler& VM::ensureSamplingProfiler()
+{
+    if (!m_samplingProfiler)
+        m_samplingProfiler = adoptPtr(new SamplingProfiler(*this));
+    return *m_samplingProfiler;
+}
+
 void sanitizeStackForVM(VM* vm)
 {
     logSanitizeStack(vm);
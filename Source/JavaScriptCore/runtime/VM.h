@@ -38,6 +38,7 @@
 #include "JSLock.h"
 #include "LLIntData.h"
 #include "MacroAssemblerCodeRef.h"
+#include "MegamorphicPropertyCache.h"
 #include "NumericStrings.h"
 #include "PrivateName.h"
 #include "PrototypeMap.h"
@@ -77,13 +78,16 @@ namespace JSC {
     class Identifier;
     class Interpreter;
     class JSGlobalObject;
+    class JSONStringifyCache;
     class JSObject;
     class Keywords;
     class LLIntOffsetsExtractor;
     class LegacyProfiler;
+    class MegamorphicAccessProfile;
     class NativeExecutable;
     class ParserArena;
     class RegExpCache;
+    class SamplingProfiler;
     class SourceProvider;
     class SourceProviderCache;
     struct StackFrame;
@@ -328,14 +332,26 @@ namespace JSC {
         bool canUseRegExpJIT() { return false; } // interpreter only
 #endif
 
-        SourceProviderCache* addSourceProviderCache(SourceProvider*);
+        // Cached function information records strict mode, so it can only be shared between
+        // sources parsed as whole programs with the same strictness.
+        enum SourceProviderCacheSharing { DontShareSourceProviderCache, ShareNonStrictSourceProviderCache, ShareStrictSourceProviderCache };
+        SourceProviderCache* addSourceProviderCache(SourceProvider*, SourceProviderCacheSharing);
         void clearSourceProviderCaches();
+        void clearSharedSourceProviderCaches();
 
         PrototypeMap prototypeMap;
 
         OwnPtr<ParserArena> parserArena;
         typedef HashMap<RefPtr<SourceProvider>, RefPtr<SourceProviderCache>> SourceProviderCacheMap;
         SourceProviderCacheMap sourceProviderCacheMap;
+        // Caches for large programs, keyed by their text and strictness, so that a SourceProvider
+        // for a script we've already parsed (e.g. a reloaded library) can reuse the cached
+        // function information. These outlive eden collections.
+        typedef HashMap<std::pair<String, unsigned>, RefPtr<SourceProviderCache>> SharedSourceProviderCacheMap;
+        SharedSourceProviderCacheMap sharedSourceProviderCacheMap;
+        size_t sharedSourceProviderCacheSourceLength;
+        MegamorphicPropertyCache megamorphicPropertyCache;
+        std::unique_ptr<JSONStringifyCache> jsonStringifyCache;
         OwnPtr<Keywords> keywords;
         Interpreter* interpreter;
 #if ENABLE(JIT)
@@ -347,6 +363,7 @@ namespace JSC {
         NativeExecutable* getHostFunction(NativeFunction, Intrinsic);
         
         std::unique_ptr<ArityCheckFailReturnThunks> arityCheckFailReturnThunks;
+        std::unique_ptr<MegamorphicAccessProfile> megamorphicAccessProfile;
 #endif // ENABLE(JIT)
         std::unique_ptr<CommonSlowPaths::ArityCheckData> arityCheckData;
 #if ENABLE(FTL_JIT)
@@ -456,6 +473,11 @@ namespace JSC {
         double cachedDateStringValue;
 
         OwnPtr<Profiler::Database> m_perBytecodeProfiler;
+
+        SamplingProfiler* samplingProfiler() { return m_samplingProfiler.get(); }
+        JS_EXPORT_PRIVATE SamplingProfiler& ensureSamplingProfiler();
+        OwnPtr<SamplingProfiler> m_samplingProfiler;
+
         RefPtr<TypedArrayController> m_typedArrayController;
         RegExpCache* m_regExpCache;
         BumpPointerAllocator m_regExpAllocator;
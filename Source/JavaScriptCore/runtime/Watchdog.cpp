@@ -45,6 +45,11 @@ Watchdog::Watchdog()
     , m_callback(0)
     , m_callbackData1(0)
     , m_callbackData2(0)
+    , m_yieldInterval(NO_LIMIT)
+    , m_lastYieldTime(0)
+    , m_yieldCallback(0)
+    , m_yieldCallbackData1(0)
+    , m_yieldCallbackData2(0)
 {
     initTimer();
 }
@@ -71,6 +76,26 @@ void Watchdog::setTimeLimit(VM& vm, double limit,
     m_callbackData1 = data1;
     m_callbackData2 = data2;
 
+    enableIfNeeded(vm, wasEnabled);
+}
+
+void Watchdog::setYieldInterval(VM& vm, double interval, YieldCallback callback, void* data1, void* data2)
+{
+    bool wasEnabled = isEnabled();
+
+    if (!m_isStopped)
+        stopCountdown();
+
+    m_yieldInterval = callback ? interval : NO_LIMIT;
+    m_yieldCallback = callback;
+    m_yieldCallbackData1 = data1;
+    m_yieldCallbackData2 = data2;
+
+    enableIfNeeded(vm, wasEnabled);
+}
+
+void Watchdog::enableIfNeeded(VM& vm, bool wasEnabled)
+{
     // If this is the first time that timeout is being enabled, then any
     // previously JIT compiled code will not have the needed polling checks.
     // Hence, we need to flush all the pre-existing compiled code.
@@ -78,7 +103,7 @@ void Watchdog::setTimeLimit(VM& vm, double limit,
     // However, if the timeout is already enabled, and we're just changing the
     // timeout value, then any existing JITted code will have the appropriate
     // polling checks. Hence, there is no need to re-do this flushing.
-    if (!wasEnabled) {
+    if (!wasEnabled && isEnabled()) {
         // And if we've previously compiled any functions, we need to revert
         // them because they don't have the needed polling checks yet.
         vm.releaseExecutableMemory();
@@ -87,6 +112,13 @@ void Watchdog::setTimeLimit(VM& vm, double limit,
     startCountdownIfNeeded();
 }
 
+double Watchdog::timeUntilNextYield(double currentTime)
+{
+    if (m_yieldInterval == NO_LIMIT)
+        return NO_LIMIT;
+    return std::max(0.0, m_lastYieldTime + m_yieldInterval - currentTime);
+}
+
 bool Watchdog::didFire(ExecState* exec)
 {
     if (m_didFire)
@@ -97,6 +129,17 @@ bool Watchdog::didFire(ExecState* exec)
     m_timerDidFire = false;
     stopCountdown();
 
+    if (m_yieldCallback && !timeUntilNextYield(monotonicallyIncreasingTime())) {
+        m_yieldCallback(exec, m_yieldCallbackData1, m_yieldCallbackData2);
+        m_lastYieldTime = monotonicallyIncreasingTime();
+
+        // The callback may have changed the settings, and already restarted the countdown.
+        if (!m_isStopped)
+            return false;
+        if (!isEnabled())
+            return false;
+    }
+
     double currentTime = currentCPUTime();
     double deltaTime = currentTime - m_startTime;
     double totalElapsedTime = m_elapsedTime + deltaTime;
@@ -124,7 +167,7 @@ bool Watchdog::didFire(ExecState* exec)
         double remainingTime = m_limit - totalElapsedTime;
         m_elapsedTime = totalElapsedTime;
         m_startTime = currentTime;
-        startCountdown(remainingTime);
+        startCountdown(std::min(remainingTime, timeUntilNextYield(monotonicallyIncreasingTime())));
     }
 
     return false;
@@ -132,7 +175,7 @@ bool Watchdog::didFire(ExecState* exec)
 
 bool Watchdog::isEnabled()
 {
-    return (m_limit != NO_LIMIT);
+    return (m_limit != NO_LIMIT) || (m_yieldInterval != NO_LIMIT);
 }
 
 void Watchdog::fire()
@@ -166,7 +209,8 @@ void Watchdog::startCountdownIfNeeded()
     if (isEnabled()) {
         m_elapsedTime = 0;
         m_startTime = currentCPUTime();
-        startCountdown(m_limit);
+        m_lastYieldTime = monotonicallyIncreasingTime();
+        startCountdown(std::min(m_limit, m_yieldInterval));
     }
 }
 
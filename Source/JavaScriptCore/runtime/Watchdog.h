@@ -45,6 +45,13 @@ public:
     typedef bool (*ShouldTerminateCallback)(ExecState*, void* data1, void* data2);
     void setTimeLimit(VM&, double seconds, ShouldTerminateCallback = 0, void* data1 = 0, void* data2 = 0);
 
+    // Calls the callback from the script thread roughly every interval seconds of
+    // uninterrupted script execution, at the same polling points that enforce the time
+    // limit. Execution resumes when the callback returns. An infinite interval or a null
+    // callback turns yielding off.
+    typedef void (*YieldCallback)(ExecState*, void* data1, void* data2);
+    void setYieldInterval(VM&, double seconds, YieldCallback, void* data1 = 0, void* data2 = 0);
+
     // This version of didFire() will check the elapsed CPU time and call the
     // callback (if needed) to determine if the watchdog should fire.
     bool didFire(ExecState*);
@@ -64,6 +71,8 @@ private:
     void disarm();
     void startCountdownIfNeeded();
     void startCountdown(double limit);
+    double timeUntilNextYield(double currentTime);
+    void enableIfNeeded(VM&, bool wasEnabled);
     void stopCountdown();
     bool isArmed() { return !!m_reentryCount; }
 
@@ -93,6 +102,13 @@ private:
     void* m_callbackData1;
     void* m_callbackData2;
 
+    // Yield times are wall clock, since the point is to bound latency for the embedder.
+    double m_yieldInterval;
+    double m_lastYieldTime;
+    YieldCallback m_yieldCallback;
+    void* m_yieldCallbackData1;
+    void* m_yieldCallbackData2;
+
 #if OS(DARWIN) && !PLATFORM(EFL) && !PLATFORM(GTK)
     dispatch_queue_t m_queue;
     dispatch_source_t m_timer;
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "config.h"
+#include "YarrLiteralPrefix.h"
+
+#include "YarrPattern.h"
+#include <string.h>
+#include <wtf/ASCIICType.h>
+
+namespace JSC { namespace Yarr {
+
+static void appendLiteralPrefix(const YarrPattern& pattern, const PatternAlternative& alternative, Vector<UChar>& prefix, unsigned maxLength)
+{
+    for (unsigned i = 0; i < alternative.m_terms.size() && prefix.size() < maxLength; ++i) {
+        const PatternTerm& term = alternative.m_terms[i];
+        if (term.type != PatternTerm::TypePatternCharacter || term.quantityType != QuantifierFixedCount)
+            return;
+        // Case-insensitive ASCII letters are matched in both cases by a single term.
+        if (pattern.m_ignoreCase && isASCIIAlpha(term.patternCharacter))
+            return;
+        for (unsigned count = 0; count < term.quantityCount.unsafeGet() && prefix.size() < maxLength; ++count)
+            prefix.append(term.patternCharacter);
+    }
+}
+
+PassOwnPtr<LiteralPrefix> LiteralPrefix::create(const YarrPattern& pattern)
+{
+    const Vector<OwnPtr<PatternAlternative>>& alternatives = pattern.m_body->m_alternatives;
+    if (alternatives.isEmpty())
+        return nullptr;
+
+    // Every alternative has to begin with the prefix, so use the common part of theirs.
+    Vector<UChar> prefix;
+    appendLiteralPrefix(pattern, *alternatives[0], prefix, maxLength);
+    for (unsigned i = 1; i < alternatives.size() && !prefix.isEmpty(); ++i) {
+        Vector<UChar> alternativePrefix;
+        appendLiteralPrefix(pattern, *alternatives[i], alternativePrefix, prefix.size());
+        unsigned commonLength = 0;
+        while (commonLength < alternativePrefix.size() && alternativePrefix[commonLength] == prefix[commonLength])
+            ++commonLength;
+        prefix.shrink(commonLength);
+    }
+
+    if (prefix.isEmpty())
+        return nullptr;
+    return adoptPtr(new LiteralPrefix(prefix));
+}
+
+LiteralPrefix::LiteralPrefix(const Vector<UChar>& characters)
+    : m_characters(characters)
+    , m_is8Bit(true)
+{
+    ASSERT(!m_characters.isEmpty() && m_characters.size() <= maxLength);
+    unsigned last = m_characters.size() - 1;
+    memset(m_skipTable, m_characters.size(), sizeof(m_skipTable));
+    for (unsigned i = 0; i < m_characters.size(); ++i) {
+        if (m_characters[i] > 0xff)
+            m_is8Bit = false;
+        if (i < last)
+            m_skipTable[m_characters[i] & 0xff] = last - i;
+    }
+}
+
+template<typename CharType>
+inline size_t LiteralPrefix::findImpl(const CharType* input, unsigned length, unsigned start) const
+{
+    unsigned prefixLength = m_characters.size();
+    if (start > length || length - start < prefixLength)
+        return notFound;
+
+    unsigned last = prefixLength - 1;
+    UChar lastCharacter = m_characters[last];
+    for (unsigned offset = start; offset <= length - prefixLength;) {
+        CharType candidate = input[offset + last];
+        if (candidate == lastCharacter) {
+            unsigned i = 0;
+            while (i < last && input[offset + i] == m_characters[i])
+                ++i;
+            if (i == last)
+                return offset;
+        }
+        offset += m_skipTable[candidate & 0xff];
+    }
+    return notFound;
+}
+
+size_t LiteralPrefix::find(const LChar* input, unsigned length, unsigned start) const
+{
+    if (!m_is8Bit)
+        return notFound;
+    if (m_characters.size() == 1) {
+        if (start >= length)
+            return notFound;
+        const void* found = memchr(input + start, m_characters[0], length - start);
+        return found ? static_cast<const LChar*>(found) - input : notFound;
+    }
+    return findImpl(input, length, start);
+}
+
+size_t LiteralPrefix::find(const UChar* input, unsigned length, unsigned start) const
+{
+    return findImpl(input, length, start);
+}
+
+} } // namespace JSC::Yarr
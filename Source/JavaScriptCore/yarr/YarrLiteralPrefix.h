@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef YarrLiteralPrefix_h
+#define YarrLiteralPrefix_h
+
+#include <unicode/utypes.h>
+#include <wtf/FastMalloc.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/PassOwnPtr.h>
+#include <wtf/Vector.h>
+#include <wtf/text/LChar.h>
+
+namespace JSC { namespace Yarr {
+
+struct YarrPattern;
+
+// The literal characters that every match of a pattern must begin with, e.g. "ERROR: "
+// for /ERROR: (\w+)/. Searching for them with a Boyer-Moore-Horspool skip table lets
+// RegExp start the matcher at the first position that can possibly match, and reject
+// subjects that contain no such position without running the matcher at all.
+class LiteralPrefix {
+    WTF_MAKE_NONCOPYABLE(LiteralPrefix);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    // Returns null if the pattern has no usable prefix.
+    static PassOwnPtr<LiteralPrefix> create(const YarrPattern&);
+
+    // Returns the first offset at or after start where the prefix occurs, or notFound.
+    size_t find(const LChar* input, unsigned length, unsigned start) const;
+    size_t find(const UChar* input, unsigned length, unsigned start) const;
+
+private:
+    static const unsigned maxLength = 255;
+
+    explicit LiteralPrefix(const Vector<UChar>&);
+
+    template<typename CharType> size_t findImpl(const CharType* input, unsigned length, unsigned start) const;
+
+    Vector<UChar> m_characters;
+    bool m_is8Bit;
+    // Indexed by the low byte of the input character aligned with the last prefix
+    // character. Entries are conservative when several characters share a low byte.
+    unsigned char m_skipTable[256];
+};
+
+} } // namespace JSC::Yarr
+
+#endif // YarrLiteralPrefix_h
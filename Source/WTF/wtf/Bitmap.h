@@ -43,6 +43,7 @@ public:
     Bitmap();
 
     bool get(size_t) const;
+    uint64_t get64(size_t) const;
     void set(size_t);
     bool testAndSet(size_t);
     bool testAndClear(size_t);
@@ -82,6 +83,21 @@ inline bool Bitmap<size, atomicMode, WordType>::get(size_t n) const
     return !!(bits[n / wordSize] & (one << (n % wordSize)));
 }
 
+// Returns bits [n, n + 64), for clients that scan 64 bits at a time. n must be a multiple of 64.
+template<size_t size, BitmapAtomicMode atomicMode, typename WordType>
+inline uint64_t Bitmap<size, atomicMode, WordType>::get64(size_t n) const
+{
+    static_assert(!(64 % wordSize), "word size must divide 64");
+    ASSERT(!(n % 64));
+    ASSERT(n + 64 <= words * wordSize);
+
+    uint64_t result = 0;
+    size_t index = n / wordSize;
+    for (size_t i = 0; i < 64 / wordSize; ++i)
+        result |= static_cast<uint64_t>(bits[index + i]) << (i * wordSize);
+    return result;
+}
+
 template<size_t size, BitmapAtomicMode atomicMode, typename WordType>
 inline void Bitmap<size, atomicMode, WordType>::set(size_t n)
 {
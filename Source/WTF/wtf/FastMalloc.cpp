@@ -394,6 +394,9 @@ void* fastRealloc(void* p, size_t n)
 }
 
 void releaseFastMallocFreeMemory() { }
+
+void setFastMallocScavengerTarget(size_t) { }
+void clearFastMallocScavengerTarget() { }
     
 FastMallocStatistics fastMallocStatistics()
 {
@@ -477,6 +480,16 @@ TryMallocReturnValue tryFastCalloc(size_t numElements, size_t elementSize)
     
 void releaseFastMallocFreeMemory() { }
 
+void setFastMallocScavengerTarget(size_t bytes)
+{
+    bmalloc::api::setScavengerTarget(bytes);
+}
+
+void clearFastMallocScavengerTarget()
+{
+    bmalloc::api::clearScavengerTarget();
+}
+
 FastMallocStatistics fastMallocStatistics()
 {
     FastMallocStatistics statistics = { 0, 0, 0 };
@@ -4763,6 +4776,9 @@ void releaseFastMallocFreeMemory()
     pageheap->ReleaseFreePages();
 }
 
+void setFastMallocScavengerTarget(size_t) { }
+void clearFastMallocScavengerTarget() { }
+
 FastMallocStatistics fastMallocStatistics()
 {
     ASSERT(kPageShift && kNumClasses && kPageSize);
@@ -82,6 +82,12 @@ namespace WTF {
 #endif
 
     WTF_EXPORT_PRIVATE void releaseFastMallocFreeMemory();
+
+    // Asks the allocator to keep returning free memory to the system until the
+    // process is no larger than the given number of bytes. Allocators that
+    // can't measure that ignore it.
+    WTF_EXPORT_PRIVATE void setFastMallocScavengerTarget(size_t);
+    WTF_EXPORT_PRIVATE void clearFastMallocScavengerTarget();
     
     struct FastMallocStatistics {
         size_t reservedVMBytes;
@@ -199,6 +199,8 @@ MetaAllocator::Statistics MetaAllocator::currentStatistics()
     result.bytesAllocated = m_bytesAllocated;
     result.bytesReserved = m_bytesReserved;
     result.bytesCommitted = m_bytesCommitted;
+    FreeSpaceNode* largestFreeSpace = m_freeSpaceSizeMap.last();
+    result.largestFreeChunk = largestFreeSpace ? largestFreeSpace->m_sizeInBytes : 0;
     return result;
 }
 
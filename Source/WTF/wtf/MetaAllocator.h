@@ -85,6 +85,7 @@ public:
         size_t bytesAllocated;
         size_t bytesReserved;
         size_t bytesCommitted;
+        size_t largestFreeChunk;
     };
     Statistics currentStatistics();
 
@@ -36,22 +36,30 @@ namespace WTF {
 
 Vector< RefPtr<ParallelEnvironment::ThreadPrivate> >* ParallelEnvironment::s_threadPool = 0;
 
+// Jobs are handed out to the threads one at a time, so splitting the work
+// into more jobs than there are threads lets faster threads pick up the
+// slack left by slower ones.
+static const int maximumJobsPerCore = 4;
+
 ParallelEnvironment::ParallelEnvironment(ThreadFunction threadFunction, size_t sizeOfParameter, int requestedJobNumber) :
     m_threadFunction(threadFunction),
-    m_sizeOfParameter(sizeOfParameter)
+    m_sizeOfParameter(sizeOfParameter),
+    m_parameters(0),
+    m_nextJob(0)
 {
     ASSERT_ARG(requestedJobNumber, requestedJobNumber >= 1);
 
     int maxNumberOfCores = numberOfProcessorCores();
+    int maxNumberOfJobs = maxNumberOfCores * maximumJobsPerCore;
 
-    if (!requestedJobNumber || requestedJobNumber > maxNumberOfCores)
-        requestedJobNumber = static_cast<unsigned>(maxNumberOfCores);
+    if (!requestedJobNumber || requestedJobNumber > maxNumberOfJobs)
+        requestedJobNumber = maxNumberOfJobs;
 
     if (!s_threadPool)
         s_threadPool = new Vector< RefPtr<ThreadPrivate> >();
 
     // The main thread should be also a worker.
-    int maxNumberOfNewThreads = requestedJobNumber - 1;
+    int maxNumberOfNewThreads = std::min(requestedJobNumber, maxNumberOfCores) - 1;
 
     for (int i = 0; i < maxNumberOfCores && m_threads.size() < static_cast<unsigned>(maxNumberOfNewThreads); ++i) {
         if (s_threadPool->size() < static_cast<unsigned>(i) + 1U)
@@ -61,26 +69,38 @@ ParallelEnvironment::ParallelEnvironment(ThreadFunction threadFunction, size_t s
             m_threads.append((*s_threadPool)[i]);
     }
 
-    m_numberOfJobs = m_threads.size() + 1;
+    // Without helper threads there is nothing to balance, so keep the work in one piece.
+    m_numberOfJobs = m_threads.isEmpty() ? 1 : requestedJobNumber;
 }
 
 void ParallelEnvironment::execute(void* parameters)
 {
-    unsigned char* currentParameter = static_cast<unsigned char*>(parameters);
+    m_parameters = static_cast<unsigned char*>(parameters);
+    m_nextJob = 0;
+
     size_t i;
-    for (i = 0; i < m_threads.size(); ++i) {
-        m_threads[i]->execute(m_threadFunction, currentParameter);
-        currentParameter += m_sizeOfParameter;
-    }
+    for (i = 0; i < m_threads.size(); ++i)
+        m_threads[i]->execute(&ParallelEnvironment::runJobs, this);
 
-    // The work for the main thread.
-    (*m_threadFunction)(currentParameter);
+    // The main thread takes jobs as well.
+    runJobs(this);
 
     // Wait until all jobs are done.
     for (i = 0; i < m_threads.size(); ++i)
         m_threads[i]->waitForFinish();
 }
 
+void ParallelEnvironment::runJobs(void* environment)
+{
+    ParallelEnvironment* parent = static_cast<ParallelEnvironment*>(environment);
+    while (true) {
+        int job = parent->m_nextJob++;
+        if (job >= parent->m_numberOfJobs)
+            return;
+        (*parent->m_threadFunction)(parent->m_parameters + job * parent->m_sizeOfParameter);
+    }
+}
+
 bool ParallelEnvironment::ThreadPrivate::tryLockFor(ParallelEnvironment* parent)
 {
     bool locked = m_mutex.tryLock();
@@ -30,6 +30,7 @@
 
 #if ENABLE(THREADING_GENERIC)
 
+#include <atomic>
 #include <wtf/RefCounted.h>
 #include <wtf/Threading.h>
 
@@ -84,10 +85,15 @@ public:
     };
 
 private:
+    static void runJobs(void* environment);
+
     ThreadFunction m_threadFunction;
     size_t m_sizeOfParameter;
     int m_numberOfJobs;
 
+    unsigned char* m_parameters;
+    std::atomic<int> m_nextJob;
+
     Vector< RefPtr<ThreadPrivate> > m_threads;
     static Vector< RefPtr<ThreadPrivate> >* s_threadPool;
 };
@@ -192,6 +192,30 @@ inline void copyLCharsFromUCharSource(LChar* destination, const UChar* source, s
 #endif
 }
 
+inline void copyUCharsFromLCharSource(UChar* destination, const LChar* source, size_t length)
+{
+#if OS(DARWIN) && (CPU(X86) || CPU(X86_64))
+    const size_t lcharsPerLoop = 16; // Process 16 bytes (16 LChars) each iteration
+
+    size_t i = 0;
+    if (length >= lcharsPerLoop) {
+        const __m128i zeros = _mm_setzero_si128();
+        const size_t endLength = length - lcharsPerLoop + 1;
+        for (; i < endLength; i += lcharsPerLoop) {
+            __m128i packedChars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&source[i]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&destination[i]), _mm_unpacklo_epi8(packedChars, zeros));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&destination[i + 8]), _mm_unpackhi_epi8(packedChars, zeros));
+        }
+    }
+
+    for (; i < length; ++i)
+        destination[i] = source[i];
+#else
+    for (size_t i = 0; i < length; ++i)
+        destination[i] = source[i];
+#endif
+}
+
 } // namespace WTF
 
 #endif // ASCIIFastPath_h
@@ -24,6 +24,7 @@
 #define StringImpl_h
 
 #include <limits.h>
+#include <string.h>
 #include <unicode/uchar.h>
 #include <unicode/ustring.h>
 #include <wtf/ASCIICType.h>
@@ -32,6 +33,7 @@
 #include <wtf/StdLibExtras.h>
 #include <wtf/StringHasher.h>
 #include <wtf/Vector.h>
+#include <wtf/text/ASCIIFastPath.h>
 #include <wtf/text/ConversionMode.h>
 
 #if USE(CF)
@@ -587,8 +589,11 @@ public:
 
     ALWAYS_INLINE static void copyChars(UChar* destination, const LChar* source, unsigned numCharacters)
     {
-        for (unsigned i = 0; i < numCharacters; ++i)
-            destination[i] = source[i];
+        if (numCharacters <= s_copyCharsInlineCutOff) {
+            for (unsigned i = 0; i < numCharacters; ++i)
+                destination[i] = source[i];
+        } else
+            copyUCharsFromLCharSource(destination, source, numCharacters);
     }
 
     // Some string features, like refcounting and the atomicity flag, are not
@@ -1119,6 +1124,17 @@ inline size_t find(const CharacterType* characters, unsigned length, CharacterTy
     return notFound;
 }
 
+inline size_t find(const LChar* characters, unsigned length, LChar matchCharacter, unsigned index = 0)
+{
+    // memchr is vectorized by the C library on every platform we care about.
+    if (index >= length)
+        return notFound;
+    const LChar* match = static_cast<const LChar*>(memchr(characters + index, matchCharacter, length - index));
+    if (!match)
+        return notFound;
+    return match - characters;
+}
+
 ALWAYS_INLINE size_t find(const UChar* characters, unsigned length, LChar matchCharacter, unsigned index = 0)
 {
     return find(characters, length, static_cast<UChar>(matchCharacter), index);
@@ -0,0 +1,4 @@
+#ifndef WebCore_FWD_BackgroundProgramCompiler_h
+#define WebCore_FWD_BackgroundProgramCompiler_h
+#include <JavaScriptCore/BackgroundProgramCompiler.h>
+#endif
@@ -959,10 +959,12 @@ bool IDBBackingStoreLevelDB::putRecord(IDBBackingStoreTransactionLevelDB& transa
     ASSERT(version >= 0);
     const Vector<char> objectStoredataKey = ObjectStoreDataKey::encode(databaseId, objectStoreId, key);
 
-    Vector<char> v;
-    v.appendVector(encodeVarInt(version));
     RefPtr<SharedBuffer> value = prpValue;
     ASSERT(value);
+    Vector<char> encodedVersion = encodeVarInt(version);
+    Vector<char> v;
+    v.reserveInitialCapacity(encodedVersion.size() + value->size());
+    v.appendVector(encodedVersion);
     v.append(value->data(), value->size());
 
     levelDBTransaction->put(objectStoredataKey, v);
@@ -1494,8 +1496,7 @@ bool ObjectStoreKeyCursorImpl::loadCurrentRow()
         return false;
     }
 
-    // FIXME: This re-encodes what was just decoded; try and optimize.
-    m_recordIdentifier->reset(encodeIDBKey(*m_currentKey), version);
+    m_recordIdentifier->reset(objectStoreDataKey.encodedUserKey(), version);
 
     return true;
 }
@@ -1558,8 +1559,7 @@ bool ObjectStoreCursorImpl::loadCurrentRow()
         return false;
     }
 
-    // FIXME: This re-encodes what was just decoded; try and optimize.
-    m_recordIdentifier->reset(encodeIDBKey(*m_currentKey), version);
+    m_recordIdentifier->reset(objectStoreDataKey.encodedUserKey(), version);
 
     Vector<char> value;
     value.append(valuePosition, m_iterator->value().end() - valuePosition);
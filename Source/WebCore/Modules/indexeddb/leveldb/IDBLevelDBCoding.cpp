@@ -1615,7 +1615,7 @@ const char* ObjectStoreDataKey::decode(const char* start, const char* end, Objec
     return extractEncodedIDBKey(p, end, &result->m_encodedUserKey);
 }
 
-Vector<char> ObjectStoreDataKey::encode(int64_t databaseId, int64_t objectStoreId, const Vector<char> encodedUserKey)
+Vector<char> ObjectStoreDataKey::encode(int64_t databaseId, int64_t objectStoreId, const Vector<char>& encodedUserKey)
 {
     KeyPrefix prefix(KeyPrefix::createWithSpecialIndex(databaseId, objectStoreId, SpecialIndexNumber));
     Vector<char> ret = prefix.encode();
@@ -310,10 +310,11 @@ private:
 class ObjectStoreDataKey {
 public:
     static const char* decode(const char* start, const char* end, ObjectStoreDataKey* result);
-    static Vector<char> encode(int64_t databaseId, int64_t objectStoreId, const Vector<char> encodedUserKey);
+    static Vector<char> encode(int64_t databaseId, int64_t objectStoreId, const Vector<char>& encodedUserKey);
     static Vector<char> encode(int64_t databaseId, int64_t objectStoreId, const IDBKey& userKey);
     int compare(const ObjectStoreDataKey& other, bool& ok);
     PassRefPtr<IDBKey> userKey() const;
+    const Vector<char>& encodedUserKey() const { return m_encodedUserKey; }
     static const int64_t SpecialIndexNumber;
 
 private:
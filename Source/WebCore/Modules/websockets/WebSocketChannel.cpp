@@ -69,6 +69,7 @@ const double TCPMaximumSegmentLifetime = 2 * 60.0;
 WebSocketChannel::WebSocketChannel(Document* document, WebSocketChannelClient* client)
     : m_document(document)
     , m_client(client)
+    , m_bufferOffset(0)
     , m_resumeTimer(this, &WebSocketChannel::resumeTimerFired)
     , m_suspended(false)
     , m_closing(false)
@@ -202,7 +203,7 @@ void WebSocketChannel::fail(const String& reason)
     Ref<WebSocketChannel> protect(*this); // The client can close the channel, potentially removing the last reference.
     m_shouldDiscardReceivedData = true;
     if (!m_buffer.isEmpty())
-        skipBuffer(m_buffer.size()); // Save memory.
+        skipBuffer(bufferSize()); // Save memory.
     m_deflateFramer.didFail();
     m_hasContinuousFrame = false;
     m_continuousFrameData.clear();
@@ -381,6 +382,14 @@ void WebSocketChannel::didFail(int errorCode)
 
 bool WebSocketChannel::appendToBuffer(const char* data, size_t len)
 {
+    // Compact what is left of the previous read once per read rather than once per frame.
+    if (m_bufferOffset) {
+        size_t remainingLength = bufferSize();
+        memmove(m_buffer.data(), bufferData(), remainingLength);
+        m_buffer.resize(remainingLength);
+        m_bufferOffset = 0;
+    }
+
     size_t newBufferSize = m_buffer.size() + len;
     if (newBufferSize < m_buffer.size()) {
         LOG(Network, "WebSocketChannel %p appendToBuffer() Buffer overflow (%lu bytes already in receive buffer and appending %lu bytes)", this, static_cast<unsigned long>(m_buffer.size()), static_cast<unsigned long>(len));
@@ -392,9 +401,12 @@ bool WebSocketChannel::appendToBuffer(const char* data, size_t len)
 
 void WebSocketChannel::skipBuffer(size_t len)
 {
-    ASSERT_WITH_SECURITY_IMPLICATION(len <= m_buffer.size());
-    memmove(m_buffer.data(), m_buffer.data() + len, m_buffer.size() - len);
-    m_buffer.resize(m_buffer.size() - len);
+    ASSERT_WITH_SECURITY_IMPLICATION(len <= bufferSize());
+    m_bufferOffset += len;
+    if (m_bufferOffset == m_buffer.size()) {
+        m_buffer.resize(0);
+        m_bufferOffset = 0;
+    }
 }
 
 bool WebSocketChannel::processBuffer()
@@ -402,20 +414,20 @@ bool WebSocketChannel::processBuffer()
     ASSERT(!m_suspended);
     ASSERT(m_client);
     ASSERT(!m_buffer.isEmpty());
-    LOG(Network, "WebSocketChannel %p processBuffer() Receive buffer has %lu bytes", this, static_cast<unsigned long>(m_buffer.size()));
+    LOG(Network, "WebSocketChannel %p processBuffer() Receive buffer has %lu bytes", this, static_cast<unsigned long>(bufferSize()));
 
     if (m_shouldDiscardReceivedData)
         return false;
 
     if (m_receivedClosingHandshake) {
-        skipBuffer(m_buffer.size());
+        skipBuffer(bufferSize());
         return false;
     }
 
     Ref<WebSocketChannel> protect(*this); // The client can close the channel, potentially removing the last reference.
 
     if (m_handshake->mode() == WebSocketHandshake::Incomplete) {
-        int headerLength = m_handshake->readServerHandshake(m_buffer.data(), m_buffer.size());
+        int headerLength = m_handshake->readServerHandshake(bufferData(), bufferSize());
         if (headerLength <= 0)
             return false;
         if (m_handshake->mode() == WebSocketHandshake::Connected) {
@@ -431,7 +443,7 @@ bool WebSocketChannel::processBuffer()
             LOG(Network, "WebSocketChannel %p Connected", this);
             skipBuffer(headerLength);
             m_client->didConnect();
-            LOG(Network, "WebSocketChannel %p %lu bytes remaining in m_buffer", this, static_cast<unsigned long>(m_buffer.size()));
+            LOG(Network, "WebSocketChannel %p %lu bytes remaining in m_buffer", this, static_cast<unsigned long>(bufferSize()));
             return !m_buffer.isEmpty();
         }
         ASSERT(m_handshake->mode() == WebSocketHandshake::Failed);
@@ -498,7 +510,7 @@ bool WebSocketChannel::processFrame()
     WebSocketFrame frame;
     const char* frameEnd;
     String errorString;
-    WebSocketFrame::ParseFrameResult result = WebSocketFrame::parseFrame(m_buffer.data(), m_buffer.size(), frame, frameEnd, errorString);
+    WebSocketFrame::ParseFrameResult result = WebSocketFrame::parseFrame(bufferData(), bufferSize(), frame, frameEnd, errorString);
     if (result == WebSocketFrame::FrameIncomplete)
         return false;
     if (result == WebSocketFrame::FrameError) {
@@ -506,8 +518,8 @@ bool WebSocketChannel::processFrame()
         return false;
     }
 
-    ASSERT(m_buffer.data() < frameEnd);
-    ASSERT(frameEnd <= m_buffer.data() + m_buffer.size());
+    ASSERT(bufferData() < frameEnd);
+    ASSERT(frameEnd <= bufferData() + bufferSize());
 
     OwnPtr<InflateResultHolder> inflateResult = m_deflateFramer.inflate(frame);
     if (!inflateResult->succeeded()) {
@@ -561,7 +573,7 @@ bool WebSocketChannel::processFrame()
             return false;
         }
         m_continuousFrameData.append(frame.payload, frame.payloadLength);
-        skipBuffer(frameEnd - m_buffer.data());
+        skipBuffer(frameEnd - bufferData());
         if (frame.final) {
             // onmessage handler may eventually call the other methods of this channel,
             // so we should pretend that we have finished to read this frame and
@@ -593,7 +605,7 @@ bool WebSocketChannel::processFrame()
                 message = String::fromUTF8(frame.payload, frame.payloadLength);
             else
                 message = "";
-            skipBuffer(frameEnd - m_buffer.data());
+            skipBuffer(frameEnd - bufferData());
             if (message.isNull())
                 fail("Could not decode a text frame as UTF-8.");
             else
@@ -603,7 +615,7 @@ bool WebSocketChannel::processFrame()
             m_continuousFrameOpCode = WebSocketFrame::OpCodeText;
             ASSERT(m_continuousFrameData.isEmpty());
             m_continuousFrameData.append(frame.payload, frame.payloadLength);
-            skipBuffer(frameEnd - m_buffer.data());
+            skipBuffer(frameEnd - bufferData());
         }
         break;
 
@@ -611,14 +623,14 @@ bool WebSocketChannel::processFrame()
         if (frame.final) {
             OwnPtr<Vector<char>> binaryData = adoptPtr(new Vector<char>(frame.payloadLength));
             memcpy(binaryData->data(), frame.payload, frame.payloadLength);
-            skipBuffer(frameEnd - m_buffer.data());
+            skipBuffer(frameEnd - bufferData());
             m_client->didReceiveBinaryData(binaryData.release());
         } else {
             m_hasContinuousFrame = true;
             m_continuousFrameOpCode = WebSocketFrame::OpCodeBinary;
             ASSERT(m_continuousFrameData.isEmpty());
             m_continuousFrameData.append(frame.payload, frame.payloadLength);
-            skipBuffer(frameEnd - m_buffer.data());
+            skipBuffer(frameEnd - bufferData());
         }
         break;
 
@@ -643,7 +655,7 @@ bool WebSocketChannel::processFrame()
             m_closeEventReason = String::fromUTF8(&frame.payload[2], frame.payloadLength - 2);
         else
             m_closeEventReason = "";
-        skipBuffer(frameEnd - m_buffer.data());
+        skipBuffer(frameEnd - bufferData());
         m_receivedClosingHandshake = true;
         startClosingHandshake(m_closeEventCode, m_closeEventReason);
         if (m_closing) {
@@ -654,19 +666,19 @@ bool WebSocketChannel::processFrame()
 
     case WebSocketFrame::OpCodePing:
         enqueueRawFrame(WebSocketFrame::OpCodePong, frame.payload, frame.payloadLength);
-        skipBuffer(frameEnd - m_buffer.data());
+        skipBuffer(frameEnd - bufferData());
         processOutgoingFrameQueue();
         break;
 
     case WebSocketFrame::OpCodePong:
         // A server may send a pong in response to our ping, or an unsolicited pong which is not associated with
         // any specific ping. Either way, there's nothing to do on receipt of pong.
-        skipBuffer(frameEnd - m_buffer.data());
+        skipBuffer(frameEnd - bufferData());
         break;
 
     default:
         ASSERT_NOT_REACHED();
-        skipBuffer(frameEnd - m_buffer.data());
+        skipBuffer(frameEnd - bufferData());
         break;
     }
 
@@ -131,6 +131,8 @@ private:
 
     bool appendToBuffer(const char* data, size_t len);
     void skipBuffer(size_t len);
+    char* bufferData() { return m_buffer.data() + m_bufferOffset; }
+    size_t bufferSize() const { return m_buffer.size() - m_bufferOffset; }
     bool processBuffer();
     void resumeTimerFired(Timer<WebSocketChannel>*);
     void startClosingHandshake(int code, const String& reason);
@@ -195,7 +197,9 @@ private:
     WebSocketChannelClient* m_client;
     OwnPtr<WebSocketHandshake> m_handshake;
     RefPtr<SocketStreamHandle> m_handle;
+    // Received data starts at m_bufferOffset; consumed frames are only moved out of the way on the next append.
     Vector<char> m_buffer;
+    size_t m_bufferOffset;
 
     Timer<WebSocketChannel> m_resumeTimer;
     bool m_suspended;
@@ -136,8 +136,22 @@ static void appendFramePayload(const WebSocketFrame& frame, Vector<char>& frameD
 
     if (frame.masked) {
         cryptographicallyRandomValues(frameData.data() + maskingKeyStart, maskingKeyWidthInBytes);
-        for (size_t i = 0; i < frame.payloadLength; ++i)
-            frameData[payloadStart + i] ^= frameData[maskingKeyStart + i % maskingKeyWidthInBytes];
+        const char* maskingKey = frameData.data() + maskingKeyStart;
+        char* payload = frameData.data() + payloadStart;
+
+        // The key repeats every four bytes, so it can be applied eight bytes at a time.
+        uint64_t wideMaskingKey;
+        memcpy(&wideMaskingKey, maskingKey, maskingKeyWidthInBytes);
+        memcpy(reinterpret_cast<char*>(&wideMaskingKey) + maskingKeyWidthInBytes, maskingKey, maskingKeyWidthInBytes);
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= frame.payloadLength; i += sizeof(uint64_t)) {
+            uint64_t word;
+            memcpy(&word, payload + i, sizeof(uint64_t));
+            word ^= wideMaskingKey;
+            memcpy(payload + i, &word, sizeof(uint64_t));
+        }
+        for (; i < frame.payloadLength; ++i)
+            payload[i] ^= maskingKey[i % maskingKeyWidthInBytes];
     }
 }
 
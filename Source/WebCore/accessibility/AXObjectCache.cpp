@@ -693,6 +693,7 @@ void AXObjectCache::notificationPostTimerFired(Timer<AXObjectCache>&)
     // when the notification list is cleared at the end. Instead copy this list at the start.
     auto notifications = m_notificationsToPost;
     m_notificationsToPost.clear();
+    m_pendingNotifications.clear();
     
     for (const auto& note : notifications) {
         AccessibilityObject* obj = note.first.get();
@@ -786,6 +787,10 @@ void AXObjectCache::postNotification(AccessibilityObject* object, Document* docu
         return;
 
     if (postType == PostAsynchronously) {
+        // A notification carries nothing but its object and type, so posting the same one again
+        // before the timer fires would only make the platform deliver it twice.
+        if (!m_pendingNotifications.add(std::make_pair(object, static_cast<int>(notification))).isNewEntry)
+            return;
         m_notificationsToPost.append(std::make_pair(object, notification));
         if (!m_notificationPostTimer.isActive())
             m_notificationPostTimer.startOneShot(0);
@@ -242,6 +242,7 @@ private:
     
     Timer<AXObjectCache> m_notificationPostTimer;
     Vector<std::pair<RefPtr<AccessibilityObject>, AXNotification>> m_notificationsToPost;
+    HashSet<std::pair<AccessibilityObject*, int>> m_pendingNotifications;
     void notificationPostTimerFired(Timer<AXObjectCache>&);
     void handleMenuOpened(Node*);
     void handleLiveRegionCreated(Node*);
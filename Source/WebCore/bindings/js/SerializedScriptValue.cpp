@@ -72,6 +72,7 @@
 #include <runtime/TypedArrays.h>
 #include <wtf/HashTraits.h>
 #include <wtf/Vector.h>
+#include <wtf/text/StringHash.h>
 
 using namespace JSC;
 
@@ -521,7 +522,6 @@ private:
         : CloneBase(exec)
         , m_buffer(out)
         , m_blobURLs(blobURLs)
-        , m_emptyIdentifier(exec, emptyString())
     {
         write(CurrentVersion);
         fillTransferMap(messagePorts, m_transferredMessagePorts);
@@ -976,8 +976,14 @@ private:
 
     void write(const Identifier& ident)
     {
-        const String& str = ident.string();
-        StringConstantPool::AddResult addResult = m_constantPool.add(str.impl(), m_constantPool.size());
+        write(ident.string());
+    }
+
+    void write(const String& string)
+    {
+        // Pool strings by content rather than atomizing every string value into an Identifier.
+        const String& str = string.isNull() ? emptyString() : string;
+        StringConstantPool::AddResult addResult = m_constantPool.add(str, m_constantPool.size());
         if (!addResult.isNewEntry) {
             write(StringPoolTag);
             writeStringIndex(addResult.iterator->value);
@@ -1009,14 +1015,6 @@ private:
             fail();
     }
 
-    void write(const String& str)
-    {
-        if (str.isNull())
-            write(m_emptyIdentifier);
-        else
-            write(Identifier(m_exec, str));
-    }
-
     void write(const Vector<uint8_t>& vector)
     {
         uint32_t size = vector.size();
@@ -1204,9 +1202,8 @@ private:
     ObjectPool m_objectPool;
     ObjectPool m_transferredMessagePorts;
     ObjectPool m_transferredArrayBuffers;
-    typedef HashMap<RefPtr<StringImpl>, uint32_t, IdentifierRepHash> StringConstantPool;
+    typedef HashMap<String, uint32_t> StringConstantPool;
     StringConstantPool m_constantPool;
-    Identifier m_emptyIdentifier;
 };
 
 SerializationReturnCode CloneSerializer::serialize(JSValue in)
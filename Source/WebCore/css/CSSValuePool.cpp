@@ -93,11 +93,11 @@ PassRef<CSSPrimitiveValue> CSSValuePool::createValue(double value, CSSPrimitiveV
         return createIdentifierValue(CSSValueID::CSSValueInvalid);
 
     if (value < 0 || value > maximumCacheableIntegerValue)
-        return CSSPrimitiveValue::create(value, type);
+        return createNumericValue(value, type);
 
     int intValue = static_cast<int>(value);
     if (value != intValue)
-        return CSSPrimitiveValue::create(value, type);
+        return createNumericValue(value, type);
 
     RefPtr<CSSPrimitiveValue>* cache;
     switch (type) {
@@ -111,7 +111,7 @@ PassRef<CSSPrimitiveValue> CSSValuePool::createValue(double value, CSSPrimitiveV
         cache = m_numberValueCache;
         break;
     default:
-        return CSSPrimitiveValue::create(value, type);
+        return createNumericValue(value, type);
     }
 
     if (!cache[intValue])
@@ -119,6 +119,23 @@ PassRef<CSSPrimitiveValue> CSSValuePool::createValue(double value, CSSPrimitiveV
     return *cache[intValue];
 }
 
+PassRef<CSSPrimitiveValue> CSSValuePool::createNumericValue(double value, CSSPrimitiveValue::UnitTypes type)
+{
+    // These would collide with the empty and deleted values of the hash table.
+    if (std::isnan(value) || type == CSSPrimitiveValue::CSS_UNKNOWN)
+        return CSSPrimitiveValue::create(value, type);
+
+    // Remove one entry at random if the cache grows too large.
+    const int maximumNumericValueCacheSize = 1024;
+    if (m_numericValueCache.size() >= maximumNumericValueCacheSize)
+        m_numericValueCache.remove(m_numericValueCache.begin());
+
+    NumericValueCache::AddResult entry = m_numericValueCache.add(std::make_pair(bitwise_cast<uint64_t>(value), static_cast<unsigned>(type)), nullptr);
+    if (entry.isNewEntry)
+        entry.iterator->value = CSSPrimitiveValue::create(value, type);
+    return *entry.iterator->value;
+}
+
 PassRef<CSSPrimitiveValue> CSSValuePool::createFontFamilyValue(const String& familyName)
 {
     RefPtr<CSSPrimitiveValue>& value = m_fontFamilyValueCache.add(familyName, nullptr).iterator->value;
@@ -143,6 +160,7 @@ PassRefPtr<CSSValueList> CSSValuePool::createFontFaceValue(const AtomicString& s
 void CSSValuePool::drain()
 {
     m_colorValueCache.clear();
+    m_numericValueCache.clear();
     m_fontFaceValueCache.clear();
     m_fontFamilyValueCache.clear();
 
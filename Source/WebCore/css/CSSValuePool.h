@@ -62,6 +62,8 @@ public:
 private:
     CSSValuePool();
 
+    PassRef<CSSPrimitiveValue> createNumericValue(double value, CSSPrimitiveValue::UnitTypes);
+
     Ref<CSSInheritedValue> m_inheritedValue;
     Ref<CSSInitialValue> m_implicitInitialValue;
     Ref<CSSInitialValue> m_explicitInitialValue;
@@ -80,6 +82,10 @@ private:
     RefPtr<CSSPrimitiveValue> m_percentValueCache[maximumCacheableIntegerValue + 1];
     RefPtr<CSSPrimitiveValue> m_numberValueCache[maximumCacheableIntegerValue + 1];
 
+    // Values that do not fit the arrays above, such as fractional lengths or ems, keyed by their bits and unit.
+    typedef HashMap<std::pair<uint64_t, unsigned>, RefPtr<CSSPrimitiveValue>> NumericValueCache;
+    NumericValueCache m_numericValueCache;
+
     typedef HashMap<AtomicString, RefPtr<CSSValueList>> FontFaceValueCache;
     FontFaceValueCache m_fontFaceValueCache;
 
@@ -64,6 +64,9 @@ void RuleFeatureSet::add(const RuleFeatureSet& other)
     end = other.classesInRules.end();
     for (HashSet<AtomicStringImpl*>::const_iterator it = other.classesInRules.begin(); it != end; ++it)
         classesInRules.add(*it);
+    end = other.classesAffectingOtherElements.end();
+    for (HashSet<AtomicStringImpl*>::const_iterator it = other.classesAffectingOtherElements.begin(); it != end; ++it)
+        classesAffectingOtherElements.add(*it);
     end = other.attrsInRules.end();
     for (HashSet<AtomicStringImpl*>::const_iterator it = other.attrsInRules.begin(); it != end; ++it)
         attrsInRules.add(*it);
@@ -77,6 +80,7 @@ void RuleFeatureSet::clear()
 {
     idsInRules.clear();
     classesInRules.clear();
+    classesAffectingOtherElements.clear();
     attrsInRules.clear();
     siblingRules.clear();
     uncommonAttributeRules.clear();
@@ -57,6 +57,9 @@ struct RuleFeatureSet {
 
     HashSet<AtomicStringImpl*> idsInRules;
     HashSet<AtomicStringImpl*> classesInRules;
+    // Classes used outside the rightmost compound selector of a rule, or next to a pseudo element.
+    // Changing any other class in classesInRules can only affect the style of the element itself.
+    HashSet<AtomicStringImpl*> classesAffectingOtherElements;
     HashSet<AtomicStringImpl*> attrsInRules;
     Vector<RuleFeature> siblingRules;
     Vector<RuleFeature> uncommonAttributeRules;
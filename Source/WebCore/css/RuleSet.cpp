@@ -146,20 +146,43 @@ RuleData::RuleData(StyleRule* rule, unsigned selectorIndex, unsigned position, A
     SelectorFilter::collectIdentifierHashes(selector(), m_descendantSelectorIdentifierHashes, maximumIdentifierCount);
 }
 
+static bool rightmostCompoundSelectorHasPseudoElement(const CSSSelector* selector)
+{
+    for (; selector; selector = selector->tagHistory()) {
+        if (selector->m_match == CSSSelector::PseudoElement)
+            return true;
+        if (selector->relation() != CSSSelector::SubSelector)
+            break;
+    }
+    return false;
+}
+
+static inline void collectClassAffectingOtherElements(RuleFeatureSet& features, const CSSSelector* selector, bool affectsOnlySubject)
+{
+    if (!affectsOnlySubject && selector->m_match == CSSSelector::Class)
+        features.classesAffectingOtherElements.add(selector->value().impl());
+}
+
 static void collectFeaturesFromRuleData(RuleFeatureSet& features, const RuleData& ruleData)
 {
     bool foundSiblingSelector = false;
+    bool affectsOnlySubject = !rightmostCompoundSelectorHasPseudoElement(ruleData.selector());
     for (const CSSSelector* selector = ruleData.selector(); selector; selector = selector->tagHistory()) {
         features.collectFeaturesFromSelector(selector);
+        collectClassAffectingOtherElements(features, selector, affectsOnlySubject);
         
         if (const CSSSelectorList* selectorList = selector->selectorList()) {
             for (const CSSSelector* subSelector = selectorList->first(); subSelector; subSelector = CSSSelectorList::next(subSelector)) {
                 if (!foundSiblingSelector && selector->isSiblingSelector())
                     foundSiblingSelector = true;
                 features.collectFeaturesFromSelector(subSelector);
+                collectClassAffectingOtherElements(features, subSelector, affectsOnlySubject);
             }
         } else if (!foundSiblingSelector && selector->isSiblingSelector())
             foundSiblingSelector = true;
+
+        if (selector->relation() != CSSSelector::SubSelector)
+            affectsOnlySubject = false;
     }
     if (foundSiblingSelector)
         features.siblingRules.append(RuleFeature(ruleData.rule(), ruleData.selectorIndex(), ruleData.hasDocumentSecurityOrigin()));
@@ -642,7 +642,7 @@ bool SelectorChecker::checkOne(const SelectorCheckingContext& context) const
         case CSSSelector::PseudoClassEnabled:
             return isEnabled(element);
         case CSSSelector::PseudoClassFullPageMedia:
-            return element->document().isMediaDocument();
+            return isInMediaDocument(element);
         case CSSSelector::PseudoClassDefault:
             return isDefaultButtonForForm(element);
         case CSSSelector::PseudoClassDisabled:
@@ -687,24 +687,16 @@ bool SelectorChecker::checkOne(const SelectorCheckingContext& context) const
         case CSSSelector::PseudoClassFullScreen:
             return matchesFullScreenPseudoClass(element);
         case CSSSelector::PseudoClassAnimatingFullScreenTransition:
-            if (element != element->document().webkitCurrentFullScreenElement())
-                return false;
-            return element->document().isAnimatingFullScreen();
+            return matchesFullScreenAnimatingFullScreenTransitionPseudoClass(element);
         case CSSSelector::PseudoClassFullScreenAncestor:
-            return element->containsFullScreenElement();
+            return matchesFullScreenAncestorPseudoClass(element);
         case CSSSelector::PseudoClassFullScreenDocument:
-            // While a Document is in the fullscreen state, the 'full-screen-document' pseudoclass applies
-            // to all elements of that Document.
-            if (!element->document().webkitIsFullScreen())
-                return false;
-            return true;
+            return matchesFullScreenDocumentPseudoClass(element);
 #endif
         case CSSSelector::PseudoClassInRange:
-            element->document().setContainsValidityStyleRules();
-            return element->isInRange();
+            return isInRange(element);
         case CSSSelector::PseudoClassOutOfRange:
-            element->document().setContainsValidityStyleRules();
-            return element->isOutOfRange();
+            return isOutOfRange(element);
 #if ENABLE(VIDEO_TRACK)
         case CSSSelector::PseudoClassFuture:
             return matchesFutureCuePseudoClass(element);
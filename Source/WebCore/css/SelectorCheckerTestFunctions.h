@@ -114,6 +114,23 @@ ALWAYS_INLINE bool shouldAppearIndeterminate(const Element* element)
     return element->shouldAppearIndeterminate();
 }
 
+ALWAYS_INLINE bool isInRange(Element* element)
+{
+    element->document().setContainsValidityStyleRules();
+    return element->isInRange();
+}
+
+ALWAYS_INLINE bool isOutOfRange(Element* element)
+{
+    element->document().setContainsValidityStyleRules();
+    return element->isOutOfRange();
+}
+
+ALWAYS_INLINE bool isInMediaDocument(const Element* element)
+{
+    return element->document().isMediaDocument();
+}
+
 #if ENABLE(FULLSCREEN_API)
 ALWAYS_INLINE bool matchesFullScreenPseudoClass(const Element* element)
 {
@@ -127,6 +144,27 @@ ALWAYS_INLINE bool matchesFullScreenPseudoClass(const Element* element)
         return false;
     return element == element->document().webkitCurrentFullScreenElement();
 }
+
+ALWAYS_INLINE bool matchesFullScreenAnimatingFullScreenTransitionPseudoClass(const Element* element)
+{
+    if (element != element->document().webkitCurrentFullScreenElement())
+        return false;
+    return element->document().isAnimatingFullScreen();
+}
+
+ALWAYS_INLINE bool matchesFullScreenAncestorPseudoClass(const Element* element)
+{
+    return element->containsFullScreenElement();
+}
+
+ALWAYS_INLINE bool matchesFullScreenDocumentPseudoClass(const Element* element)
+{
+    // While a Document is in the fullscreen state, the 'full-screen-document' pseudoclass applies
+    // to all elements of that Document.
+    if (!element->document().webkitIsFullScreen())
+        return false;
+    return true;
+}
 #endif
 
 #if ENABLE(VIDEO_TRACK)
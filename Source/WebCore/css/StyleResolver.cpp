@@ -682,6 +682,52 @@ inline StyledElement* StyleResolver::findSiblingForStyleSharing(Node* node, unsi
     return toStyledElement(node);
 }
 
+static inline bool parentElementPreventsCousinSharing(const StyleResolver& resolver, const Element* parentElement)
+{
+    if (!parentElement || !parentElement->isStyledElement())
+        return true;
+    const StyledElement* parent = toStyledElement(parentElement);
+    if (parent->inlineStyle())
+        return true;
+    if (parent->isSVGElement() && toSVGElement(parent)->animatedSMILStyleProperties())
+        return true;
+    if (parent->hasID() && resolver.ruleSets().features().idsInRules.contains(parent->idForStyleResolution().impl()))
+        return true;
+    return !parent->renderStyle();
+}
+
+static inline unsigned styleSharingCacheIndex(const Element* element, unsigned cacheSize)
+{
+    unsigned hash = PtrHash<RenderStyle*>::hash(element->parentElement()->renderStyle());
+    hash = pairIntHash(hash, element->localName().impl()->existingHash());
+    if (element->hasClass())
+        hash = pairIntHash(hash, element->classNames()[0].impl()->existingHash());
+    return hash % cacheSize;
+}
+
+void StyleResolver::clearStyleSharingCache()
+{
+    for (unsigned i = 0; i < styleSharingCacheSize; ++i)
+        m_styleSharingCache[i] = nullptr;
+}
+
+StyledElement* StyleResolver::findCachedElementForStyleSharing(unsigned cacheIndex) const
+{
+    StyledElement* candidate = m_styleSharingCache[cacheIndex].get();
+    if (!candidate || candidate == m_state.element())
+        return 0;
+
+    // Like the cousins found by locateCousinList(), a candidate must have a parent that shares our parent's style.
+    Element* candidateParent = candidate->parentElement();
+    if (!candidateParent || candidateParent->renderStyle() != m_state.element()->parentElement()->renderStyle())
+        return 0;
+    if (parentElementPreventsSharing(candidateParent))
+        return 0;
+    if (!canShareStyleWithElement(candidate))
+        return 0;
+    return candidate;
+}
+
 RenderStyle* StyleResolver::locateSharedStyle()
 {
     State& state = m_state;
@@ -719,6 +765,14 @@ RenderStyle* StyleResolver::locateSharedStyle()
         cousinList = locateCousinList(cousinList->parentElement(), visitedNodeCount);
     }
 
+    bool canUseStyleSharingCache = state.document().inStyleRecalc() && !parentElementPreventsCousinSharing(*this, state.element()->parentElement());
+    unsigned cacheIndex = canUseStyleSharingCache ? styleSharingCacheIndex(state.element(), styleSharingCacheSize) : 0;
+    if (!shareElement && canUseStyleSharingCache) {
+        shareElement = findCachedElementForStyleSharing(cacheIndex);
+        if (!shareElement)
+            m_styleSharingCache[cacheIndex] = state.styledElement();
+    }
+
     // If we have exhausted all our budget or our cousins.
     if (!shareElement)
         return 0;
@@ -806,6 +860,10 @@ PassRef<RenderStyle> StyleResolver::styleForElement(Element* element, RenderStyl
     // Clean up our style object's display and text decorations (among other fixups).
     adjustRenderStyle(*state.style(), *state.parentStyle(), element);
 
+    // Elements that are styled alike but could not share a whole style usually still end up with
+    // equal box data after their own copy-on-write; fold those copies into one.
+    state.style()->shareBoxDataWithCacheEntry(m_sharedBoxDataCache[state.style()->boxDataHash() % sharedBoxDataCacheSize]);
+
     state.clear(); // Clear out for the next resolve.
 
     // Now return the style.
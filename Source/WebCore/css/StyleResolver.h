@@ -175,6 +175,7 @@ private:
     bool styleSharingCandidateMatchesRuleSet(RuleSet*);
     Node* locateCousinList(Element* parent, unsigned& visitedNodeCount) const;
     StyledElement* findSiblingForStyleSharing(Node*, unsigned& count) const;
+    StyledElement* findCachedElementForStyleSharing(unsigned cacheIndex) const;
     bool canShareStyleWithElement(StyledElement*) const;
 
     PassRef<RenderStyle> styleForKeyframe(const RenderStyle*, const StyleKeyframe*, KeyframeValue&);
@@ -210,6 +211,7 @@ public:
 
     bool hasSelectorForId(const AtomicString&) const;
     bool hasSelectorForClass(const AtomicString&) const;
+    bool hasSelectorForClassAffectingOtherElements(const AtomicString&) const;
     bool hasSelectorForAttribute(const AtomicString&) const;
 
     CSSFontSelector* fontSelector() const { return m_fontSelector.get(); }
@@ -231,6 +233,10 @@ public:
     
     void invalidateMatchedPropertiesCache();
 
+    // Elements resolved during the current style recalc, indexed by parent style, tag and first class,
+    // so that locateSharedStyle() can find candidates beyond the nearby siblings and cousins.
+    void clearStyleSharingCache();
+
 #if ENABLE(CSS_FILTERS)
     bool createFilterOperations(CSSValue* inValue, FilterOperations& outOperations);
     void loadPendingSVGDocuments();
@@ -511,6 +517,12 @@ private:
     bool m_matchAuthorAndUserStyles;
 
     RefPtr<CSSFontSelector> m_fontSelector;
+
+    static const unsigned styleSharingCacheSize = 64;
+    RefPtr<StyledElement> m_styleSharingCache[styleSharingCacheSize];
+
+    static const unsigned sharedBoxDataCacheSize = 64;
+    RefPtr<StyleBoxData> m_sharedBoxDataCache[sharedBoxDataCacheSize];
     Vector<std::unique_ptr<MediaQueryResult>> m_viewportDependentMediaQueryResults;
 
 #if ENABLE(CSS_DEVICE_ADAPTATION)
@@ -543,6 +555,12 @@ inline bool StyleResolver::hasSelectorForClass(const AtomicString& classValue) c
     return m_ruleSets.features().classesInRules.contains(classValue.impl());
 }
 
+inline bool StyleResolver::hasSelectorForClassAffectingOtherElements(const AtomicString& classValue) const
+{
+    ASSERT(!classValue.isEmpty());
+    return m_ruleSets.features().classesAffectingOtherElements.contains(classValue.impl());
+}
+
 inline bool StyleResolver::hasSelectorForId(const AtomicString& idValue) const
 {
     ASSERT(!idValue.isEmpty());
@@ -279,6 +279,12 @@ static inline FunctionType addPseudoClassType(const CSSSelector& selector, Selec
     case CSSSelector::PseudoClassFocus:
         fragment.unoptimizedPseudoClasses.append(JSC::FunctionPtr(SelectorChecker::matchesFocusPseudoClass));
         return FunctionType::SimpleSelectorChecker;
+    case CSSSelector::PseudoClassFullPageMedia:
+        fragment.unoptimizedPseudoClasses.append(JSC::FunctionPtr(isInMediaDocument));
+        return FunctionType::SimpleSelectorChecker;
+    case CSSSelector::PseudoClassInRange:
+        fragment.unoptimizedPseudoClasses.append(JSC::FunctionPtr(isInRange));
+        return FunctionType::SimpleSelectorChecker;
     case CSSSelector::PseudoClassIndeterminate:
         fragment.unoptimizedPseudoClasses.append(JSC::FunctionPtr(shouldAppearIndeterminate));
         return FunctionType::SimpleSelectorChecker;
@@ -288,6 +294,9 @@ static inline FunctionType addPseudoClassType(const CSSSelector& selector, Selec
     case CSSSelector::PseudoClassOptional:
         fragment.unoptimizedPseudoClasses.append(JSC::FunctionPtr(isOptionalFormControl));
         return FunctionType::SimpleSelectorChecker;
+    case CSSSelector::PseudoClassOutOfRange:
+        fragment.unoptimizedPseudoClasses.append(JSC::FunctionPtr(isOutOfRange));
+        return FunctionType::SimpleSelectorChecker;
     case CSSSelector::PseudoClassReadOnly:
         fragment.unoptimizedPseudoClasses.append(JSC::FunctionPtr(matchesReadOnlyPseudoClass));
         return FunctionType::SimpleSelectorChecker;
@@ -304,6 +313,15 @@ static inline FunctionType addPseudoClassType(const CSSSelector& selector, Selec
     case CSSSelector::PseudoClassFullScreen:
         fragment.unoptimizedPseudoClasses.append(JSC::FunctionPtr(matchesFullScreenPseudoClass));
         return FunctionType::SimpleSelectorChecker;
+    case CSSSelector::PseudoClassAnimatingFullScreenTransition:
+        fragment.unoptimizedPseudoClasses.append(JSC::FunctionPtr(matchesFullScreenAnimatingFullScreenTransitionPseudoClass));
+        return FunctionType::SimpleSelectorChecker;
+    case CSSSelector::PseudoClassFullScreenAncestor:
+        fragment.unoptimizedPseudoClasses.append(JSC::FunctionPtr(matchesFullScreenAncestorPseudoClass));
+        return FunctionType::SimpleSelectorChecker;
+    case CSSSelector::PseudoClassFullScreenDocument:
+        fragment.unoptimizedPseudoClasses.append(JSC::FunctionPtr(matchesFullScreenDocumentPseudoClass));
+        return FunctionType::SimpleSelectorChecker;
 #endif
 #if ENABLE(VIDEO_TRACK)
     case CSSSelector::PseudoClassFuture:
@@ -393,6 +411,10 @@ inline SelectorCodeGenerator::SelectorCodeGenerator(const CSSSelector* rootSelec
             break;
         case CSSSelector::PseudoClass:
             m_functionType = mostRestrictiveFunctionType(m_functionType, addPseudoClassType(*selector, fragment, m_selectorContext));
+#if CSS_SELECTOR_JIT_DEBUGGING
+            if (m_functionType == FunctionType::CannotCompile)
+                dataLogF("    Falling back to SelectorChecker: unsupported pseudo class \"%s\"\n", selector->selectorText().utf8().data());
+#endif
             if (m_functionType == FunctionType::CannotCompile || m_functionType == FunctionType::CannotMatchAnything)
                 return;
             break;
@@ -425,6 +447,9 @@ inline SelectorCodeGenerator::SelectorCodeGenerator(const CSSSelector* rootSelec
             m_functionType = FunctionType::CannotMatchAnything;
             return;
         case CSSSelector::PseudoElement:
+#if CSS_SELECTOR_JIT_DEBUGGING
+            dataLogF("    Falling back to SelectorChecker: pseudo element\n");
+#endif
             goto CannotHandleSelector;
         }
 
@@ -432,8 +457,12 @@ inline SelectorCodeGenerator::SelectorCodeGenerator(const CSSSelector* rootSelec
         if (relation == CSSSelector::SubSelector)
             continue;
 
-        if (relation == CSSSelector::ShadowDescendant && !selector->isLastInTagHistory())
+        if (relation == CSSSelector::ShadowDescendant && !selector->isLastInTagHistory()) {
+#if CSS_SELECTOR_JIT_DEBUGGING
+            dataLogF("    Falling back to SelectorChecker: shadow descendant relation\n");
+#endif
             goto CannotHandleSelector;
+        }
 
         if (relation == CSSSelector::DirectAdjacent || relation == CSSSelector::IndirectAdjacent) {
             FunctionType relationFunctionType = FunctionType::SelectorCheckerWithCheckingContext;
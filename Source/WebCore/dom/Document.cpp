@@ -435,6 +435,8 @@ Document::Document(Frame* frame, const URL& url, unsigned documentClasses, unsig
     , m_pendingStyleRecalcShouldForce(false)
     , m_inStyleRecalc(false)
     , m_closeAfterStyleRecalc(false)
+    , m_styleRecalcCount(0)
+    , m_forcedLayoutCount(0)
     , m_gotoAnchorNeededAfterStylesheetsLoad(false)
     , m_frameElementsShouldIgnoreScrolling(false)
     , m_containsValidityStyleRules(false)
@@ -682,7 +684,10 @@ void Document::removedLastRef()
         m_markers->detach();
         
         m_cssCanvasElements.clear();
-        
+
+        // Cached querySelectorAll() results retain elements of this document.
+        m_selectorQueryCache = nullptr;
+
         commonTeardown();
 
 #ifndef NDEBUG
@@ -1755,6 +1760,7 @@ void Document::recalcStyle(Style::Change change)
         m_styleSheetCollection.setUsesRemUnit(true);
 
     m_inStyleRecalc = true;
+    ++m_styleRecalcCount;
     {
         Style::PostResolutionCallbackDisabler disabler(*this);
         WidgetHierarchyUpdatesSuspensionScope suspendWidgetHierarchyUpdates;
@@ -1775,6 +1781,8 @@ void Document::recalcStyle(Style::Change change)
         clearChildNeedsStyleRecalc();
         unscheduleStyleRecalc();
 
+        if (m_styleResolver)
+            m_styleResolver->clearStyleSharingCache();
         m_inStyleRecalc = false;
 
         // Pseudo element removal and similar may only work with these flags still set. Reset them after the style recalc.
@@ -1875,7 +1883,10 @@ void Document::updateLayoutIgnorePendingStylesheets()
             recalcStyle(Style::Force);
     }
 
+    int layoutCountBefore = view() ? view()->layoutCount() : 0;
     updateLayout();
+    if (view() && view()->layoutCount() != layoutCountBefore)
+        ++m_forcedLayoutCount;
 
     m_ignorePendingStylesheets = oldIgnore;
 }
@@ -2097,6 +2108,10 @@ void Document::prepareForDestruction()
     m_fullScreenErrorEventTargetQueue.clear();
 #endif
 
+    // Cached querySelectorAll() results would otherwise retain this document's elements until the next query.
+    if (m_selectorQueryCache)
+        m_selectorQueryCache->clearCachedResults();
+
     commonTeardown();
 
 #if ENABLE(SHARED_WORKERS)
@@ -1248,6 +1248,10 @@ public:
 
     bool inStyleRecalc() { return m_inStyleRecalc; }
 
+    // Counters for finding out what drives style and layout work on a page.
+    unsigned styleRecalcCount() const { return m_styleRecalcCount; }
+    unsigned forcedLayoutCount() const { return m_forcedLayoutCount; }
+
     // Return a Locale for the default locale if the argument is null or empty.
     Locale& getCachedLocale(const AtomicString& locale = nullAtom);
 
@@ -1456,6 +1460,9 @@ private:
     bool m_inStyleRecalc;
     bool m_closeAfterStyleRecalc;
 
+    unsigned m_styleRecalcCount;
+    unsigned m_forcedLayoutCount; // Layouts run synchronously by updateLayoutIgnorePendingStylesheets(), typically for script.
+
     bool m_gotoAnchorNeededAfterStylesheetsLoad;
     bool m_isDNSPrefetchEnabled;
     bool m_haveExplicitlyDisabledDNSPrefetch;
@@ -1093,21 +1093,35 @@ static inline bool classStringHasClassName(const AtomicString& newClassString)
     return classStringHasClassName(newClassString.characters16(), length);
 }
 
-static bool checkSelectorForClassChange(const SpaceSplitString& changedClasses, const StyleResolver& styleResolver)
+// A class that only appears in the rightmost compound selectors of rules can only change the style
+// of the element itself, so the descendants are left to the usual inherited style propagation.
+static inline StyleChangeType styleChangeTypeForClass(const AtomicString& className, const StyleResolver& styleResolver)
 {
+    if (!styleResolver.hasSelectorForClass(className))
+        return NoStyleChange;
+    if (styleResolver.hasSelectorForClassAffectingOtherElements(className))
+        return FullStyleChange;
+    return InlineStyleChange;
+}
+
+static StyleChangeType checkSelectorForClassChange(const SpaceSplitString& changedClasses, const StyleResolver& styleResolver)
+{
+    StyleChangeType changeType = NoStyleChange;
     unsigned changedSize = changedClasses.size();
     for (unsigned i = 0; i < changedSize; ++i) {
-        if (styleResolver.hasSelectorForClass(changedClasses[i]))
-            return true;
+        changeType = std::max(changeType, styleChangeTypeForClass(changedClasses[i], styleResolver));
+        if (changeType == FullStyleChange)
+            break;
     }
-    return false;
+    return changeType;
 }
 
-static bool checkSelectorForClassChange(const SpaceSplitString& oldClasses, const SpaceSplitString& newClasses, const StyleResolver& styleResolver)
+static StyleChangeType checkSelectorForClassChange(const SpaceSplitString& oldClasses, const SpaceSplitString& newClasses, const StyleResolver& styleResolver)
 {
     unsigned oldSize = oldClasses.size();
     if (!oldSize)
         return checkSelectorForClassChange(newClasses, styleResolver);
+    StyleChangeType changeType = NoStyleChange;
     BitVector remainingClassBits;
     remainingClassBits.ensureSize(oldSize);
     // Class vectors tend to be very short. This is faster than using a hash table.
@@ -1122,24 +1136,26 @@ static bool checkSelectorForClassChange(const SpaceSplitString& oldClasses, cons
         }
         if (foundFromBoth)
             continue;
-        if (styleResolver.hasSelectorForClass(newClasses[i]))
-            return true;
+        changeType = std::max(changeType, styleChangeTypeForClass(newClasses[i], styleResolver));
+        if (changeType == FullStyleChange)
+            return changeType;
     }
     for (unsigned i = 0; i < oldSize; ++i) {
         // If the bit is not set the the corresponding class has been removed.
         if (remainingClassBits.quickGet(i))
             continue;
-        if (styleResolver.hasSelectorForClass(oldClasses[i]))
-            return true;
+        changeType = std::max(changeType, styleChangeTypeForClass(oldClasses[i], styleResolver));
+        if (changeType == FullStyleChange)
+            return changeType;
     }
-    return false;
+    return changeType;
 }
 
 void Element::classAttributeChanged(const AtomicString& newClassString)
 {
     StyleResolver* styleResolver = document().styleResolverIfExists();
     bool testShouldInvalidateStyle = inRenderedDocument() && styleResolver && styleChangeType() < FullStyleChange;
-    bool shouldInvalidateStyle = false;
+    StyleChangeType changeType = NoStyleChange;
 
     if (classStringHasClassName(newClassString)) {
         const bool shouldFoldCase = document().inQuirksMode();
@@ -1149,18 +1165,20 @@ void Element::classAttributeChanged(const AtomicString& newClassString)
         const SpaceSplitString oldClasses = elementData()->classNames();
         elementData()->setClass(newClassString, shouldFoldCase);
         const SpaceSplitString& newClasses = elementData()->classNames();
-        shouldInvalidateStyle = testShouldInvalidateStyle && checkSelectorForClassChange(oldClasses, newClasses, *styleResolver);
+        if (testShouldInvalidateStyle)
+            changeType = checkSelectorForClassChange(oldClasses, newClasses, *styleResolver);
     } else if (elementData()) {
         const SpaceSplitString& oldClasses = elementData()->classNames();
-        shouldInvalidateStyle = testShouldInvalidateStyle && checkSelectorForClassChange(oldClasses, *styleResolver);
+        if (testShouldInvalidateStyle)
+            changeType = checkSelectorForClassChange(oldClasses, *styleResolver);
         elementData()->clearClass();
     }
 
     if (hasRareData())
         elementRareData()->clearClassListValueForQuirksMode();
 
-    if (shouldInvalidateStyle)
-        setNeedsStyleRecalc();
+    if (changeType != NoStyleChange)
+        setNeedsStyleRecalc(changeType);
 }
 
 // Returns true is the given attribute is an event handler.
@@ -63,7 +63,7 @@ public:
     bool isInCanvasSubtree() const { return m_isInCanvasSubtree; }
     void setIsInCanvasSubtree(bool value) { m_isInCanvasSubtree = value; }
 
-    RegionOversetState regionOversetState() const { return m_regionOversetState; }
+    RegionOversetState regionOversetState() const { return static_cast<RegionOversetState>(m_regionOversetState); }
     void setRegionOversetState(RegionOversetState state) { m_regionOversetState = state; }
 
 #if ENABLE(FULLSCREEN_API)
@@ -138,8 +138,7 @@ private:
     unsigned m_childrenAffectedByLastChildRules : 1;
     unsigned m_childrenAffectedByForwardPositionalRules : 1;
     unsigned m_childrenAffectedByBackwardPositionalRules : 1;
-
-    RegionOversetState m_regionOversetState;
+    unsigned m_regionOversetState : 2; // RegionOversetState
 
     LayoutSize m_minimumSizeForResizing;
     IntSize m_savedLayerScrollOffset;
@@ -28,6 +28,8 @@
 
 #include "CachedScript.h"
 #include "Element.h"
+#include "JSDOMWindowBase.h"
+#include <runtime/JSLock.h>
 
 namespace WebCore {
 
@@ -42,6 +44,7 @@ PassRefPtr<Element> PendingScript::releaseElementAndClear()
     setCachedScript(0);
     m_watchingForLoad = false;
     m_startingPosition = TextPosition::belowRangePosition();
+    m_backgroundCompilation = nullptr;
     return m_element.release();
 }
 
@@ -61,6 +64,30 @@ CachedScript* PendingScript::cachedScript() const
     return m_cachedScript.get();
 }
 
+void PendingScript::startBackgroundCompilation(std::function<void ()> completionHandler)
+{
+    ASSERT(m_cachedScript && m_cachedScript->isLoaded());
+    ASSERT(!m_backgroundCompilation);
+    m_backgroundCompilation = JSC::BackgroundProgramCompilation::start(m_cachedScript->script(), completionHandler);
+}
+
+bool PendingScript::isCompilingInBackground() const
+{
+    return m_backgroundCompilation && !m_backgroundCompilation->isFinished();
+}
+
+void PendingScript::installBackgroundCompilation()
+{
+    if (!m_backgroundCompilation)
+        return;
+
+    ASSERT(m_backgroundCompilation->isFinished());
+    JSC::VM& vm = JSDOMWindowBase::commonVM();
+    JSC::JSLockHolder lock(vm);
+    m_backgroundCompilation->install(vm);
+    m_backgroundCompilation = nullptr;
+}
+
 void PendingScript::notifyFinished(CachedResource*)
 {
 }
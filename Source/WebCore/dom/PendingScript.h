@@ -28,6 +28,8 @@
 
 #include "CachedResourceClient.h"
 #include "CachedResourceHandle.h"
+#include <functional>
+#include <runtime/BackgroundProgramCompiler.h>
 #include <wtf/text/TextPosition.h>
 #include <wtf/PassRefPtr.h>
 #include <wtf/RefPtr.h>
@@ -62,6 +64,7 @@ public:
         , m_watchingForLoad(other.m_watchingForLoad)
         , m_element(other.m_element)
         , m_startingPosition(other.m_startingPosition)
+        , m_backgroundCompilation(other.m_backgroundCompilation)
     {
         setCachedScript(other.cachedScript());
     }
@@ -76,6 +79,7 @@ public:
         m_watchingForLoad = other.m_watchingForLoad;
         m_element = other.m_element;
         m_startingPosition = other.m_startingPosition;
+        m_backgroundCompilation = other.m_backgroundCompilation;
         setCachedScript(other.cachedScript());
 
         return *this;
@@ -94,6 +98,12 @@ public:
     CachedScript* cachedScript() const;
     void setCachedScript(CachedScript*);
 
+    // Compiles the loaded script on a background thread. The completion handler
+    // is called on that thread; execution should wait until it has been called.
+    void startBackgroundCompilation(std::function<void ()> completionHandler);
+    bool isCompilingInBackground() const;
+    void installBackgroundCompilation();
+
     virtual void notifyFinished(CachedResource*) override;
 
 private:
@@ -101,6 +111,7 @@ private:
     RefPtr<Element> m_element;
     TextPosition m_startingPosition; // Only used for inline script tags.
     CachedResourceHandle<CachedScript> m_cachedScript; 
+    RefPtr<JSC::BackgroundProgramCompilation> m_backgroundCompilation;
 };
 
 }
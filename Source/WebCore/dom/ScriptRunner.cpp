@@ -30,12 +30,18 @@
 #include "Element.h"
 #include "PendingScript.h"
 #include "ScriptElement.h"
+#include "Settings.h"
+#include <wtf/MainThread.h>
 
 namespace WebCore {
 
+// Below this size, handing a script to another thread costs more than parsing it.
+static const unsigned minimumScriptLengthForBackgroundCompilation = 100 * 1024;
+
 ScriptRunner::ScriptRunner(Document& document)
     : m_document(document)
     , m_timer(this, &ScriptRunner::timerFired)
+    , m_weakPtrFactory(this)
 {
 }
 
@@ -82,18 +88,57 @@ void ScriptRunner::resume()
         m_timer.startOneShot(0);
 }
 
+PendingScript* ScriptRunner::pendingInOrderScript(ScriptElement* scriptElement)
+{
+    for (size_t i = 0; i < m_scriptsToExecuteInOrder.size(); ++i) {
+        if (m_scriptsToExecuteInOrder[i].element() == scriptElement->element())
+            return &m_scriptsToExecuteInOrder[i];
+    }
+    return 0;
+}
+
+bool ScriptRunner::shouldCompileInBackground(PendingScript& pendingScript) const
+{
+    Settings* settings = m_document.settings();
+    if (!settings || !settings->offThreadScriptCompilationEnabled())
+        return false;
+
+    CachedScript* cachedScript = pendingScript.cachedScript();
+    return cachedScript && !cachedScript->errorOccurred() && cachedScript->script().length() >= minimumScriptLengthForBackgroundCompilation;
+}
+
+void ScriptRunner::startBackgroundCompilation(PendingScript& pendingScript)
+{
+    WeakPtr<ScriptRunner> weakThis = m_weakPtrFactory.createWeakPtr();
+    pendingScript.startBackgroundCompilation([weakThis] {
+        callOnMainThread([weakThis] {
+            if (weakThis)
+                weakThis->m_timer.startOneShot(0);
+        });
+    });
+}
+
 void ScriptRunner::notifyScriptReady(ScriptElement* scriptElement, ExecutionType executionType)
 {
+    PendingScript* pendingScript = 0;
     switch (executionType) {
     case ASYNC_EXECUTION:
         ASSERT(m_pendingAsyncScripts.contains(scriptElement));
         m_scriptsToExecuteSoon.append(m_pendingAsyncScripts.take(scriptElement));
+        pendingScript = &m_scriptsToExecuteSoon.last();
         break;
 
     case IN_ORDER_EXECUTION:
         ASSERT(!m_scriptsToExecuteInOrder.isEmpty());
+        pendingScript = pendingInOrderScript(scriptElement);
         break;
     }
+
+    // The timer is started once the background thread is done with the script.
+    if (pendingScript && shouldCompileInBackground(*pendingScript)) {
+        startBackgroundCompilation(*pendingScript);
+        return;
+    }
     m_timer.startOneShot(0);
 }
 
@@ -104,10 +149,17 @@ void ScriptRunner::timerFired(Timer<ScriptRunner>& timer)
     Ref<Document> protect(m_document);
 
     Vector<PendingScript> scripts;
-    scripts.swap(m_scriptsToExecuteSoon);
+    Vector<PendingScript> scriptsCompilingInBackground;
+    for (size_t i = 0; i < m_scriptsToExecuteSoon.size(); ++i) {
+        if (m_scriptsToExecuteSoon[i].isCompilingInBackground())
+            scriptsCompilingInBackground.append(m_scriptsToExecuteSoon[i]);
+        else
+            scripts.append(m_scriptsToExecuteSoon[i]);
+    }
+    m_scriptsToExecuteSoon.swap(scriptsCompilingInBackground);
 
     size_t numInOrderScriptsToExecute = 0;
-    for (; numInOrderScriptsToExecute < m_scriptsToExecuteInOrder.size() && m_scriptsToExecuteInOrder[numInOrderScriptsToExecute].cachedScript()->isLoaded(); ++numInOrderScriptsToExecute)
+    for (; numInOrderScriptsToExecute < m_scriptsToExecuteInOrder.size() && m_scriptsToExecuteInOrder[numInOrderScriptsToExecute].cachedScript()->isLoaded() && !m_scriptsToExecuteInOrder[numInOrderScriptsToExecute].isCompilingInBackground(); ++numInOrderScriptsToExecute)
         scripts.append(m_scriptsToExecuteInOrder[numInOrderScriptsToExecute]);
     if (numInOrderScriptsToExecute)
         m_scriptsToExecuteInOrder.remove(0, numInOrderScriptsToExecute);
@@ -115,6 +167,7 @@ void ScriptRunner::timerFired(Timer<ScriptRunner>& timer)
     size_t size = scripts.size();
     for (size_t i = 0; i < size; ++i) {
         CachedScript* cachedScript = scripts[i].cachedScript();
+        scripts[i].installBackgroundCompilation();
         RefPtr<Element> element = scripts[i].releaseElementAndClear();
         toScriptElementIfPossible(element.get())->execute(cachedScript);
         m_document.decrementLoadEventDelayCount();
@@ -32,6 +32,7 @@
 #include <wtf/Noncopyable.h>
 #include <wtf/PassRefPtr.h>
 #include <wtf/Vector.h>
+#include <wtf/WeakPtr.h>
 
 namespace WebCore {
 
@@ -56,11 +57,16 @@ public:
 private:
     void timerFired(Timer<ScriptRunner>&);
 
+    PendingScript* pendingInOrderScript(ScriptElement*);
+    bool shouldCompileInBackground(PendingScript&) const;
+    void startBackgroundCompilation(PendingScript&);
+
     Document& m_document;
     Vector<PendingScript> m_scriptsToExecuteInOrder;
     Vector<PendingScript> m_scriptsToExecuteSoon; // http://www.whatwg.org/specs/web-apps/current-work/#set-of-scripts-that-will-execute-as-soon-as-possible
     HashMap<ScriptElement*, PendingScript> m_pendingAsyncScripts;
     Timer<ScriptRunner> m_timer;
+    WeakPtrFactory<ScriptRunner> m_weakPtrFactory;
 };
 
 }
@@ -27,6 +27,7 @@
 #include "SelectorQuery.h"
 
 #include "CSSParser.h"
+#include "Document.h"
 #include "ElementDescendantIterator.h"
 #include "SelectorChecker.h"
 #include "SelectorCheckerFastPath.h"
@@ -151,6 +152,11 @@ RefPtr<NodeList> SelectorDataList::queryAll(ContainerNode& rootNode) const
     return StaticElementList::adopt(result);
 }
 
+void SelectorDataList::queryAll(ContainerNode& rootNode, Vector<Ref<Element>>& result) const
+{
+    execute<AllElementExtractorSelectorQueryTrait>(rootNode, result);
+}
+
 struct SingleElementExtractorSelectorQueryTrait {
     typedef Element* OutputType;
     static const bool shouldOnlyMatchFirstElement = true;
@@ -460,10 +466,57 @@ ALWAYS_INLINE void SelectorDataList::execute(ContainerNode& rootNode, typename S
     }
 }
 
+static bool selectorListDependsOnlyOnDOMTree(const CSSSelectorList& selectorList)
+{
+    // Tag, id and class matches only change through mutations that bump the DOM tree version.
+    // Attribute selectors can see lazily synchronized attributes like style, and pseudo-classes
+    // depend on state such as focus, hover or form control values.
+    for (const CSSSelector* selector = selectorList.first(); selector; selector = CSSSelectorList::next(selector)) {
+        for (const CSSSelector* simpleSelector = selector; simpleSelector; simpleSelector = simpleSelector->tagHistory()) {
+            if (simpleSelector->m_match != CSSSelector::Tag && simpleSelector->m_match != CSSSelector::Id && simpleSelector->m_match != CSSSelector::Class)
+                return false;
+        }
+    }
+    return true;
+}
+
 SelectorQuery::SelectorQuery(CSSSelectorList&& selectorList)
     : m_selectorList(selectorList)
     , m_selectors(m_selectorList)
+    , m_canCacheQueryAllResult(selectorListDependsOnlyOnDOMTree(m_selectorList))
+    , m_cachedQueryAllRootNode(nullptr)
+    , m_cachedQueryAllDOMTreeVersion(0)
+{
+}
+
+RefPtr<NodeList> SelectorQuery::queryAll(ContainerNode& rootNode) const
 {
+    // Removing a node from the document bumps the DOM tree version, so an in-document root
+    // cannot be destroyed and replaced at the same address without invalidating the cache.
+    if (!m_canCacheQueryAllResult || !rootNode.inDocument())
+        return m_selectors.queryAll(rootNode);
+
+    // Scripts often repeat the same query without changing the document in between.
+    uint64_t domTreeVersion = rootNode.document().domTreeVersion();
+    if (m_cachedQueryAllRootNode != &rootNode || m_cachedQueryAllDOMTreeVersion != domTreeVersion) {
+        m_cachedQueryAllResult.clear();
+        m_selectors.queryAll(rootNode, m_cachedQueryAllResult);
+        m_cachedQueryAllRootNode = &rootNode;
+        m_cachedQueryAllDOMTreeVersion = domTreeVersion;
+    }
+
+    Vector<Ref<Element>> result;
+    result.reserveInitialCapacity(m_cachedQueryAllResult.size());
+    for (auto& element : m_cachedQueryAllResult)
+        result.uncheckedAppend(element.get());
+    return StaticElementList::adopt(result);
+}
+
+void SelectorQuery::clearCachedQueryAllResult()
+{
+    m_cachedQueryAllRootNode = nullptr;
+    m_cachedQueryAllDOMTreeVersion = 0;
+    m_cachedQueryAllResult.clear();
 }
 
 SelectorQuery* SelectorQueryCache::add(const String& selectors, Document& document, ExceptionCode& ec)
@@ -499,4 +552,10 @@ void SelectorQueryCache::invalidate()
     m_entries.clear();
 }
 
+void SelectorQueryCache::clearCachedResults()
+{
+    for (auto& query : m_entries.values())
+        query->clearCachedQueryAllResult();
+}
+
 }
@@ -30,6 +30,7 @@
 #include "NodeList.h"
 #include "SelectorCompiler.h"
 #include <wtf/HashMap.h>
+#include <wtf/Ref.h>
 #include <wtf/Vector.h>
 #include <wtf/text/AtomicStringHash.h>
 
@@ -49,6 +50,7 @@ public:
     explicit SelectorDataList(const CSSSelectorList&);
     bool matches(Element&) const;
     RefPtr<NodeList> queryAll(ContainerNode& rootNode) const;
+    void queryAll(ContainerNode& rootNode, Vector<Ref<Element>>&) const;
     Element* queryFirst(ContainerNode& rootNode) const;
 
 private:
@@ -102,10 +104,19 @@ public:
     bool matches(Element&) const;
     RefPtr<NodeList> queryAll(ContainerNode& rootNode) const;
     Element* queryFirst(ContainerNode& rootNode) const;
+    void clearCachedQueryAllResult();
 
 private:
     CSSSelectorList m_selectorList;
     SelectorDataList m_selectors;
+
+    // The last queryAll() result, reused while the DOM tree version is unchanged.
+    bool m_canCacheQueryAllResult;
+    // The root is only used as a key. It is not retained so that a cached document.querySelectorAll()
+    // result does not keep the Document that owns this cache alive.
+    mutable ContainerNode* m_cachedQueryAllRootNode;
+    mutable uint64_t m_cachedQueryAllDOMTreeVersion;
+    mutable Vector<Ref<Element>> m_cachedQueryAllResult;
 };
 
 class SelectorQueryCache {
@@ -114,6 +125,7 @@ class SelectorQueryCache {
 public:
     SelectorQuery* add(const String&, Document&, ExceptionCode&);
     void invalidate();
+    void clearCachedResults();
 
 private:
     HashMap<String, std::unique_ptr<SelectorQuery>> m_entries;
@@ -124,11 +136,6 @@ inline bool SelectorQuery::matches(Element& element) const
     return m_selectors.matches(element);
 }
 
-inline RefPtr<NodeList> SelectorQuery::queryAll(ContainerNode& rootNode) const
-{
-    return m_selectors.queryAll(rootNode);
-}
-
 inline Element* SelectorQuery::queryFirst(ContainerNode& rootNode) const
 {
     return m_selectors.queryFirst(rootNode);
@@ -3244,42 +3244,17 @@ unsigned Editor::countMatchesForText(const String& target, Range* range, FindOpt
     if (!searchRange)
         searchRange = rangeOfContents(document());
 
-    Node* originalEndContainer = searchRange->endContainer();
-    int originalEndOffset = searchRange->endOffset();
-
-    unsigned matchCount = 0;
-    do {
-        RefPtr<Range> resultRange(findPlainText(*searchRange, target, options & ~Backwards));
-        if (resultRange->collapsed(IGNORE_EXCEPTION)) {
-            if (!resultRange->startContainer()->isInShadowTree())
-                break;
-
-            searchRange->setStartAfter(resultRange->startContainer()->shadowHost(), IGNORE_EXCEPTION);
-            searchRange->setEnd(originalEndContainer, originalEndOffset, IGNORE_EXCEPTION);
-            continue;
-        }
-
-        ++matchCount;
-        if (matches)
-            matches->append(resultRange);
-        
-        if (markMatches)
-            document().markers().addMarker(resultRange.get(), DocumentMarker::TextMatch);
+    Vector<RefPtr<Range>> foundMatches;
+    findPlainTextMatches(*searchRange, target, options & ~Backwards, limit, foundMatches);
+    unsigned matchCount = foundMatches.size();
 
-        // Stop looking if we hit the specified limit. A limit of 0 means no limit.
-        if (limit > 0 && matchCount >= limit)
-            break;
-
-        // Set the new start for the search range to be the end of the previous
-        // result range. There is no need to use a VisiblePosition here,
-        // since findPlainText will use a TextIterator to go over the visible
-        // text nodes. 
-        searchRange->setStart(resultRange->endContainer(IGNORE_EXCEPTION), resultRange->endOffset(IGNORE_EXCEPTION), IGNORE_EXCEPTION);
+    if (markMatches) {
+        for (auto& match : foundMatches)
+            document().markers().addMarker(match.get(), DocumentMarker::TextMatch);
+    }
 
-        Node* shadowTreeRoot = searchRange->shadowRoot();
-        if (searchRange->collapsed(IGNORE_EXCEPTION) && shadowTreeRoot)
-            searchRange->setEnd(shadowTreeRoot, shadowTreeRoot->childNodeCount(), IGNORE_EXCEPTION);
-    } while (true);
+    if (matches)
+        matches->appendVector(foundMatches);
 
     if (markMatches || matches) {
         // Do a "fake" paint in order to execute the code that computes the rendered rect for each text match.
@@ -2533,22 +2533,27 @@ static PassRefPtr<Range> collapsedToBoundary(const Range& range, bool forward)
     return result.release();
 }
 
+static void prependContextBeforeRange(SearchBuffer& buffer, const Range& range)
+{
+    if (!buffer.needsMoreContext())
+        return;
+
+    RefPtr<Range> beforeStartRange = range.ownerDocument().createRange();
+    beforeStartRange->setEnd(range.startContainer(), range.startOffset());
+    for (SimplifiedBackwardsTextIterator backwardsIterator(*beforeStartRange); !backwardsIterator.atEnd(); backwardsIterator.advance()) {
+        buffer.prependContext(backwardsIterator.text());
+        if (!buffer.needsMoreContext())
+            break;
+    }
+}
+
 static size_t findPlainText(const Range& range, const String& target, FindOptions options, size_t& matchStart)
 {
     matchStart = 0;
     size_t matchLength = 0;
 
     SearchBuffer buffer(target, options);
-
-    if (buffer.needsMoreContext()) {
-        RefPtr<Range> beforeStartRange = range.ownerDocument().createRange();
-        beforeStartRange->setEnd(range.startContainer(), range.startOffset());
-        for (SimplifiedBackwardsTextIterator backwardsIterator(*beforeStartRange); !backwardsIterator.atEnd(); backwardsIterator.advance()) {
-            buffer.prependContext(backwardsIterator.text());
-            if (!buffer.needsMoreContext())
-                break;
-        }
-    }
+    prependContextBeforeRange(buffer, range);
 
     CharacterIterator findIterator(range, TextIteratorEntersTextControls);
 
@@ -2593,4 +2598,57 @@ PassRefPtr<Range> findPlainText(const Range& range, const String& target, FindOp
     return characterSubrange(computeRangeIterator, matchStart, matchLength);
 }
 
+void findPlainTextMatches(const Range& range, const String& target, FindOptions options, unsigned limit, Vector<RefPtr<Range>>& matches)
+{
+    ASSERT(!(options & Backwards));
+
+    // Calling findPlainText() once per match sets up a new SearchBuffer and walks the text
+    // from the previous match for every result. Instead, collect the character offsets of
+    // all the matches in a single pass, then turn them into ranges in a second one.
+    Vector<std::pair<size_t, size_t>> matchOffsets;
+    {
+        SearchBuffer buffer(target, options);
+        prependContextBeforeRange(buffer, range);
+
+        CharacterIterator findIterator(range, TextIteratorEntersTextControls);
+        size_t endOfLastMatch = 0;
+        while (!findIterator.atEnd()) {
+            findIterator.advance(buffer.append(findIterator.text()));
+tryAgain:
+            size_t matchStartOffset;
+            if (size_t matchLength = buffer.search(matchStartOffset)) {
+                size_t lastCharacterInBufferOffset = findIterator.characterOffset();
+                ASSERT(lastCharacterInBufferOffset >= matchStartOffset);
+                size_t matchStart = lastCharacterInBufferOffset - matchStartOffset;
+                // The buffer can also report matches overlapping the previous one; skip those,
+                // as searching again from the end of the previous match would.
+                if (matchStart >= endOfLastMatch) {
+                    matchOffsets.append(std::make_pair(matchStart, matchLength));
+                    endOfLastMatch = matchStart + matchLength;
+                    if (limit && matchOffsets.size() >= limit)
+                        break;
+                }
+                goto tryAgain;
+            }
+            if (findIterator.atBreak() && !buffer.atBreak()) {
+                buffer.reachedBreak();
+                goto tryAgain;
+            }
+        }
+    }
+
+    if (matchOffsets.isEmpty())
+        return;
+
+    matches.reserveCapacity(matches.size() + matchOffsets.size());
+    CharacterIterator computeRangeIterator(range, TextIteratorEntersTextControls);
+    size_t iteratorOffset = 0;
+    for (const auto& match : matchOffsets) {
+        ASSERT(match.first >= iteratorOffset);
+        matches.append(characterSubrange(computeRangeIterator, match.first - iteratorOffset, match.second));
+        // characterSubrange() leaves the iterator on the last character of the match.
+        iteratorOffset = match.first + match.second - 1;
+    }
+}
+
 }
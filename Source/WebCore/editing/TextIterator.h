@@ -42,6 +42,8 @@ class RenderTextFragment;
 
 String plainText(const Range*, TextIteratorBehavior = TextIteratorDefaultBehavior, bool isDisplayString = false);
 PassRefPtr<Range> findPlainText(const Range&, const String&, FindOptions);
+// Appends up to limit non-overlapping forward matches to the vector. A limit of 0 means no limit.
+void findPlainTextMatches(const Range&, const String&, FindOptions, unsigned limit, Vector<RefPtr<Range>>&);
 
 // FIXME: Move this somewhere else in the editing directory. It doesn't belong here.
 bool isRendererReplacedElement(RenderObject*);
@@ -362,6 +362,13 @@ namespace {
             break;
         }
     }
+
+    // Premultiplication only changes texels that carry both color and alpha, so
+    // for other formats an UNPACK_PREMULTIPLY_ALPHA_WEBGL upload can skip conversion.
+    bool premultiplyAlphaAffectsFormat(GC3Denum format)
+    {
+        return format == GraphicsContext3D::LUMINANCE_ALPHA || format == GraphicsContext3D::RGBA;
+    }
 } // namespace anonymous
 
 class WebGLRenderingContextLostCallback : public GraphicsContext3D::ContextLostCallback {
@@ -3866,10 +3873,11 @@ void WebGLRenderingContext::texImage2D(GC3Denum target, GC3Dint level, GC3Denum
     void* data = pixels ? pixels->baseAddress() : 0;
     Vector<uint8_t> tempData;
     bool changeUnpackAlignment = false;
-    if (data && (m_unpackFlipY || m_unpackPremultiplyAlpha)) {
+    bool premultiplyAlpha = m_unpackPremultiplyAlpha && premultiplyAlphaAffectsFormat(format);
+    if (data && (m_unpackFlipY || premultiplyAlpha)) {
         if (!m_context->extractTextureData(width, height, format, type,
                                            m_unpackAlignment,
-                                           m_unpackFlipY, m_unpackPremultiplyAlpha,
+                                           m_unpackFlipY, premultiplyAlpha,
                                            data,
                                            tempData))
             return;
@@ -4128,10 +4136,11 @@ void WebGLRenderingContext::texSubImage2D(GC3Denum target, GC3Dint level, GC3Din
     void* data = pixels->baseAddress();
     Vector<uint8_t> tempData;
     bool changeUnpackAlignment = false;
-    if (data && (m_unpackFlipY || m_unpackPremultiplyAlpha)) {
+    bool premultiplyAlpha = m_unpackPremultiplyAlpha && premultiplyAlphaAffectsFormat(format);
+    if (data && (m_unpackFlipY || premultiplyAlpha)) {
         if (!m_context->extractTextureData(width, height, format, type,
                                            m_unpackAlignment,
-                                           m_unpackFlipY, m_unpackPremultiplyAlpha,
+                                           m_unpackFlipY, premultiplyAlpha,
                                            data,
                                            tempData))
             return;
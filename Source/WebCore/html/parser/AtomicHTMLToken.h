@@ -27,6 +27,7 @@
 #define AtomicHTMLToken_h
 
 #include "Attribute.h"
+#include "CompactHTMLToken.h"
 #include "HTMLToken.h"
 #include <wtf/RefCounted.h>
 #include <wtf/RefPtr.h>
@@ -152,6 +153,43 @@ public:
         }
     }
 
+    // The character data of a Character token stays owned by the CompactHTMLToken.
+    explicit AtomicHTMLToken(CompactHTMLToken& token)
+        : m_type(token.type())
+        , m_externalCharacters(0)
+        , m_externalCharactersLength(0)
+        , m_isAll8BitData(false)
+        , m_selfClosing(false)
+    {
+        switch (m_type) {
+        case HTMLToken::Uninitialized:
+            ASSERT_NOT_REACHED();
+            break;
+        case HTMLToken::DOCTYPE:
+            m_name = AtomicString(token.data());
+            m_doctypeData = token.releaseDoctypeData();
+            break;
+        case HTMLToken::EndOfFile:
+            break;
+        case HTMLToken::StartTag:
+        case HTMLToken::EndTag: {
+            m_selfClosing = token.selfClosing();
+            m_name = AtomicString(token.data());
+            initializeAttributes(token.attributes());
+            break;
+        }
+        case HTMLToken::Comment:
+            m_data = token.data();
+            break;
+        case HTMLToken::Character:
+            ASSERT(!token.data().is8Bit());
+            m_externalCharacters = token.data().characters16();
+            m_externalCharactersLength = token.data().length();
+            m_isAll8BitData = token.isAll8BitData();
+            break;
+        }
+    }
+
     explicit AtomicHTMLToken(HTMLToken::Type type)
         : m_type(type)
         , m_externalCharacters(0)
@@ -177,6 +215,7 @@ private:
     HTMLToken::Type m_type;
 
     void initializeAttributes(const HTMLToken::AttributeList& attributes);
+    void initializeAttributes(const Vector<CompactHTMLToken::Attribute>& attributes);
     QualifiedName nameForAttribute(const HTMLToken::Attribute&) const;
 
     bool usesName() const;
@@ -238,6 +277,25 @@ inline void AtomicHTMLToken::initializeAttributes(const HTMLToken::AttributeList
     }
 }
 
+inline void AtomicHTMLToken::initializeAttributes(const Vector<CompactHTMLToken::Attribute>& attributes)
+{
+    size_t size = attributes.size();
+    if (!size)
+        return;
+
+    m_attributes.clear();
+    m_attributes.reserveInitialCapacity(size);
+    for (auto& attribute : attributes) {
+        if (attribute.name.isEmpty())
+            continue;
+
+        QualifiedName name(nullAtom, AtomicString(attribute.name), nullAtom);
+        // FIXME: This is N^2 for the number of attributes.
+        if (!findAttributeInVector(m_attributes, name))
+            m_attributes.append(Attribute(name, AtomicString(attribute.value)));
+    }
+}
+
 }
 
 #endif
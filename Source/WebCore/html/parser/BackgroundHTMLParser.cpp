@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "config.h"
+#include "BackgroundHTMLParser.h"
+
+#include "HTMLDocumentParser.h"
+#include "HTMLTokenizer.h"
+#include "XSSAuditor.h"
+#include <wtf/MainThread.h>
+
+namespace WebCore {
+
+// Small enough that the main thread gets its first tokens quickly, large
+// enough that we don't bounce back and forth for every few tags.
+static const size_t pendingTokenLimit = 256;
+
+PassRefPtr<BackgroundHTMLParser> BackgroundHTMLParser::create(std::unique_ptr<Configuration> configuration)
+{
+    return adoptRef(new BackgroundHTMLParser(std::move(configuration)));
+}
+
+BackgroundHTMLParser::BackgroundHTMLParser(std::unique_ptr<Configuration> configuration)
+    : m_tokenizer(std::make_unique<HTMLTokenizer>(configuration->options))
+    , m_treeBuilderSimulator(configuration->options)
+    , m_parser(configuration->parser)
+    , m_xssAuditor(std::move(configuration->xssAuditor))
+    , m_pendingChunk(std::make_unique<ParsedChunk>())
+    , m_isStopped(false)
+{
+    ASSERT(isMainThread());
+    ASSERT(m_xssAuditor->isSafeToSendToAnotherThread());
+}
+
+BackgroundHTMLParser::~BackgroundHTMLParser()
+{
+}
+
+void BackgroundHTMLParser::append(const String& input)
+{
+    ASSERT(!isMainThread());
+    if (m_isStopped)
+        return;
+    m_input.append(SegmentedString(input));
+    pumpTokenizer();
+}
+
+void BackgroundHTMLParser::finish()
+{
+    ASSERT(!isMainThread());
+    if (m_isStopped)
+        return;
+    m_input.append(SegmentedString(String(&kEndOfFileMarker, 1)));
+    m_input.close();
+    pumpTokenizer();
+}
+
+void BackgroundHTMLParser::stop()
+{
+    ASSERT(!isMainThread());
+    m_isStopped = true;
+}
+
+void BackgroundHTMLParser::pumpTokenizer()
+{
+    while (!m_isStopped) {
+        m_sourceTracker.start(m_input, m_tokenizer.get(), m_token);
+        if (!m_tokenizer->nextToken(m_input, m_token))
+            break;
+        m_sourceTracker.end(m_input, m_tokenizer.get(), m_token);
+
+        // The auditor may strip attributes from the token, so it runs before
+        // we copy the token out.
+        TextPosition position(m_input.currentLine(), m_input.currentColumn());
+        if (auto xssInfo = m_xssAuditor->filterToken(FilterTokenRequest(m_token, m_sourceTracker, m_tokenizer->shouldAllowCDATA()))) {
+            xssInfo->m_textPosition = position;
+            m_pendingChunk->xssInfos.append(std::move(xssInfo));
+        }
+
+        unsigned endOffset = static_cast<unsigned>(m_input.numberOfCharactersConsumed() - m_tokenizer->numberOfBufferedCharacters());
+        CompactHTMLToken token(m_token, position, endOffset, m_tokenizer->state());
+        m_token.clear();
+
+        m_treeBuilderSimulator.simulate(token, *m_tokenizer);
+        token.recordSimulation(*m_tokenizer);
+
+        bool isEndOfFile = token.type() == HTMLToken::EndOfFile;
+        m_pendingChunk->tokens.append(std::move(token));
+        if (isEndOfFile) {
+            m_isStopped = true;
+            break;
+        }
+        if (m_pendingChunk->tokens.size() >= pendingTokenLimit)
+            sendTokensToMainThread();
+    }
+
+    sendTokensToMainThread();
+}
+
+void BackgroundHTMLParser::sendTokensToMainThread()
+{
+    if (m_pendingChunk->tokens.isEmpty() && m_pendingChunk->xssInfos.isEmpty())
+        return;
+
+    // The chunk travels as a raw pointer so that nothing on this thread keeps
+    // a reference to the Strings inside it once it has been posted.
+    ParsedChunk* chunk = m_pendingChunk.release();
+    m_pendingChunk = std::make_unique<ParsedChunk>();
+
+    WeakPtr<HTMLDocumentParser> parser = m_parser;
+    callOnMainThread([parser, chunk] {
+        std::unique_ptr<ParsedChunk> adoptedChunk(chunk);
+        if (parser)
+            parser->didReceiveParsedChunkFromBackgroundParser(std::move(adoptedChunk));
+    });
+}
+
+} // namespace WebCore
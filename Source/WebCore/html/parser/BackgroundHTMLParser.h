@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef BackgroundHTMLParser_h
+#define BackgroundHTMLParser_h
+
+#include "CompactHTMLToken.h"
+#include "HTMLParserOptions.h"
+#include "HTMLSourceTracker.h"
+#include "HTMLToken.h"
+#include "HTMLTreeBuilderSimulator.h"
+#include "SegmentedString.h"
+#include "XSSAuditorDelegate.h"
+#include <wtf/PassRefPtr.h>
+#include <wtf/ThreadSafeRefCounted.h>
+#include <wtf/WeakPtr.h>
+
+namespace WebCore {
+
+class HTMLDocumentParser;
+class HTMLTokenizer;
+class XSSAuditor;
+
+// A batch of tokens handed from the BackgroundHTMLParser to the main thread.
+struct ParsedChunk {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    CompactHTMLTokenStream tokens;
+    Vector<std::unique_ptr<XSSInfo>> xssInfos;
+};
+
+// Tokenizes a document's source on the HTMLParserThread ahead of the main
+// thread. The HTMLDocumentParser creates it on the main thread; every other
+// member function runs on the parser thread.
+class BackgroundHTMLParser : public ThreadSafeRefCounted<BackgroundHTMLParser> {
+public:
+    struct Configuration {
+        WTF_MAKE_FAST_ALLOCATED;
+    public:
+        HTMLParserOptions options;
+        WeakPtr<HTMLDocumentParser> parser;
+        std::unique_ptr<XSSAuditor> xssAuditor;
+    };
+
+    static PassRefPtr<BackgroundHTMLParser> create(std::unique_ptr<Configuration>);
+    ~BackgroundHTMLParser();
+
+    void append(const String&);
+    void finish();
+    void stop();
+
+private:
+    explicit BackgroundHTMLParser(std::unique_ptr<Configuration>);
+
+    void pumpTokenizer();
+    void sendTokensToMainThread();
+
+    SegmentedString m_input;
+    HTMLToken m_token;
+    std::unique_ptr<HTMLTokenizer> m_tokenizer;
+    HTMLTreeBuilderSimulator m_treeBuilderSimulator;
+    HTMLSourceTracker m_sourceTracker;
+    WeakPtr<HTMLDocumentParser> m_parser;
+    std::unique_ptr<XSSAuditor> m_xssAuditor;
+    std::unique_ptr<ParsedChunk> m_pendingChunk;
+    bool m_isStopped;
+};
+
+} // namespace WebCore
+
+#endif // BackgroundHTMLParser_h
@@ -50,19 +50,33 @@ void CSSPreloadScanner::reset()
     m_ruleValue.clear();
 }
 
-void CSSPreloadScanner::scan(const HTMLToken::DataVector& data, PreloadRequestStream& requests)
+template<typename CharacterType>
+void CSSPreloadScanner::scanCharacters(const CharacterType* characters, unsigned length, PreloadRequestStream& requests)
 {
     ASSERT(!m_requests);
     TemporaryChange<PreloadRequestStream*> change(m_requests, &requests);
 
-    for (UChar c : data) {
+    for (unsigned i = 0; i < length; ++i) {
         if (m_state == DoneParsingImportRules)
             break;
 
-        tokenize(c);
+        tokenize(characters[i]);
     }
 }
 
+void CSSPreloadScanner::scan(const HTMLToken::DataVector& data, PreloadRequestStream& requests)
+{
+    scanCharacters(data.data(), data.size(), requests);
+}
+
+void CSSPreloadScanner::scan(const String& data, PreloadRequestStream& requests)
+{
+    if (data.is8Bit())
+        scanCharacters(data.characters8(), data.length(), requests);
+    else
+        scanCharacters(data.characters16(), data.length(), requests);
+}
+
 inline void CSSPreloadScanner::tokenize(UChar c)
 {
     // We are just interested in @import rules, no need for real tokenization here
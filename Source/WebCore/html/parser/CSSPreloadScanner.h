@@ -42,6 +42,7 @@ public:
     void reset();
 
     void scan(const HTMLToken::DataVector&, PreloadRequestStream&);
+    void scan(const String&, PreloadRequestStream&);
 
 private:
     enum State {
@@ -57,6 +58,9 @@ private:
         DoneParsingImportRules,
     };
 
+    template<typename CharacterType>
+    void scanCharacters(const CharacterType*, unsigned length, PreloadRequestStream&);
+
     inline void tokenize(UChar);
     void emitRule();
 
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "config.h"
+#include "CompactHTMLToken.h"
+
+#include "HTMLParserIdioms.h"
+#include "QualifiedName.h"
+
+namespace WebCore {
+
+CompactHTMLToken::CompactHTMLToken(HTMLToken& token, const TextPosition& endPosition, unsigned endOffset, HTMLTokenizer::State state)
+    : m_type(token.type())
+    , m_selfClosing(false)
+    , m_isAll8BitData(false)
+    , m_simulatedShouldAllowCDATA(false)
+    , m_simulatedForceNullCharacterReplacement(false)
+    , m_tokenizerStateBeforeSimulation(state)
+    , m_simulatedTokenizerState(state)
+    , m_endPosition(endPosition)
+    , m_endOffset(endOffset)
+{
+    switch (token.type()) {
+    case HTMLToken::Uninitialized:
+        ASSERT_NOT_REACHED();
+        break;
+    case HTMLToken::DOCTYPE:
+        m_data = StringImpl::create8BitIfPossible(token.name());
+        m_doctypeData = token.releaseDoctypeData();
+        break;
+    case HTMLToken::EndOfFile:
+        break;
+    case HTMLToken::StartTag:
+        m_attributes.reserveInitialCapacity(token.attributes().size());
+        for (auto& attribute : token.attributes())
+            m_attributes.uncheckedAppend(Attribute(StringImpl::create8BitIfPossible(attribute.name), StringImpl::create8BitIfPossible(attribute.value)));
+        FALLTHROUGH;
+    case HTMLToken::EndTag:
+        m_selfClosing = token.selfClosing();
+        m_data = StringImpl::create8BitIfPossible(token.name());
+        break;
+    case HTMLToken::Comment:
+        m_isAll8BitData = token.isAll8BitData();
+        if (token.isAll8BitData())
+            m_data = String::make8BitFrom16BitSource(token.comment());
+        else
+            m_data = String(token.comment());
+        break;
+    case HTMLToken::Character:
+        // AtomicHTMLToken hands out a UChar pointer to character data, so keep
+        // it in 16-bit form.
+        m_isAll8BitData = token.isAll8BitData();
+        m_data = String(token.characters().data(), token.characters().size());
+        break;
+    }
+}
+
+const CompactHTMLToken::Attribute* CompactHTMLToken::getAttributeItem(const QualifiedName& name) const
+{
+    for (auto& attribute : m_attributes) {
+        if (threadSafeMatch(attribute.name, name))
+            return &attribute;
+    }
+    return nullptr;
+}
+
+void CompactHTMLToken::recordSimulation(const HTMLTokenizer& tokenizer)
+{
+    m_simulatedTokenizerState = tokenizer.state();
+    m_simulatedShouldAllowCDATA = tokenizer.shouldAllowCDATA();
+    m_simulatedForceNullCharacterReplacement = tokenizer.forceNullCharacterReplacement();
+}
+
+} // namespace WebCore
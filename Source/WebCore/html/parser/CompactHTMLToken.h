@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef CompactHTMLToken_h
+#define CompactHTMLToken_h
+
+#include "HTMLToken.h"
+#include "HTMLTokenizer.h"
+#include <wtf/Vector.h>
+#include <wtf/text/TextPosition.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebCore {
+
+class QualifiedName;
+
+// A CompactHTMLToken is an HTMLToken whose data has been copied out into
+// Strings so that it can be produced on the parser thread and handed to the
+// main thread. None of its Strings are shared with the thread that made it.
+class CompactHTMLToken {
+public:
+    struct Attribute {
+        Attribute(const String& name, const String& value)
+            : name(name)
+            , value(value)
+        {
+        }
+
+        String name;
+        String value;
+    };
+
+    CompactHTMLToken(HTMLToken&, const TextPosition& endPosition, unsigned endOffset, HTMLTokenizer::State);
+
+    HTMLToken::Type type() const { return static_cast<HTMLToken::Type>(m_type); }
+
+    // The name for DOCTYPE, StartTag and EndTag tokens, the comment text for
+    // Comment tokens and the characters, always 16-bit, for Character tokens.
+    const String& data() const { return m_data; }
+
+    bool selfClosing() const { return m_selfClosing; }
+    bool isAll8BitData() const { return m_isAll8BitData; }
+
+    const Vector<Attribute>& attributes() const { return m_attributes; }
+    const Attribute* getAttributeItem(const QualifiedName&) const;
+
+    std::unique_ptr<DoctypeData> releaseDoctypeData() { return std::move(m_doctypeData); }
+
+    // The position and offset in the document source right after this token.
+    const TextPosition& endPosition() const { return m_endPosition; }
+    unsigned endOffset() const { return m_endOffset; }
+
+    // The state the tokenizer was in when it emitted this token, before the
+    // tree builder simulator had a chance to adjust it.
+    HTMLTokenizer::State tokenizerStateBeforeSimulation() const { return m_tokenizerStateBeforeSimulation; }
+
+    // How the HTMLTreeBuilderSimulator predicted the tree builder would leave
+    // the tokenizer after processing this token. The main thread checks these
+    // predictions against the real tree builder.
+    HTMLTokenizer::State simulatedTokenizerState() const { return m_simulatedTokenizerState; }
+    bool simulatedShouldAllowCDATA() const { return m_simulatedShouldAllowCDATA; }
+    bool simulatedForceNullCharacterReplacement() const { return m_simulatedForceNullCharacterReplacement; }
+    void recordSimulation(const HTMLTokenizer&);
+
+private:
+    unsigned m_type : 4;
+    unsigned m_selfClosing : 1;
+    unsigned m_isAll8BitData : 1;
+    unsigned m_simulatedShouldAllowCDATA : 1;
+    unsigned m_simulatedForceNullCharacterReplacement : 1;
+    HTMLTokenizer::State m_tokenizerStateBeforeSimulation;
+    HTMLTokenizer::State m_simulatedTokenizerState;
+    String m_data;
+    Vector<Attribute> m_attributes;
+    std::unique_ptr<DoctypeData> m_doctypeData;
+    TextPosition m_endPosition;
+    unsigned m_endOffset;
+};
+
+typedef Vector<CompactHTMLToken> CompactHTMLTokenStream;
+
+} // namespace WebCore
+
+#endif // CompactHTMLToken_h
@@ -26,11 +26,13 @@
 #include "config.h"
 #include "HTMLDocumentParser.h"
 
+#include "BackgroundHTMLParser.h"
 #include "ContentSecurityPolicy.h"
 #include "DocumentFragment.h"
 #include "DocumentLoader.h"
 #include "Frame.h"
 #include "HTMLParserScheduler.h"
+#include "HTMLParserThread.h"
 #include "HTMLScriptRunner.h"
 #include "HTMLTreeBuilder.h"
 #include "HTMLDocument.h"
@@ -77,8 +79,15 @@ HTMLDocumentParser::HTMLDocumentParser(HTMLDocument& document)
     , m_parserScheduler(std::make_unique<HTMLParserScheduler>(*this))
     , m_xssAuditorDelegate(document)
     , m_preloader(std::make_unique<HTMLResourcePreloader>(document))
+    , m_weakFactory(this)
+    , m_nextSpeculativeTokenIndex(0)
+    , m_backgroundParserSourceOffset(0)
+    , m_lastSpeculativeTokenEndOffset(0)
+    , m_speculativeResumeState(HTMLTokenizer::DataState)
     , m_endWasDelayed(false)
     , m_haveBackgroundParser(false)
+    , m_hasConsideredBackgroundParser(false)
+    , m_backgroundParserWasFinished(false)
     , m_pumpSessionNestingLevel(0)
 {
     ASSERT(m_token);
@@ -94,8 +103,15 @@ HTMLDocumentParser::HTMLDocumentParser(DocumentFragment& fragment, Element* cont
     , m_tokenizer(std::make_unique<HTMLTokenizer>(m_options))
     , m_treeBuilder(std::make_unique<HTMLTreeBuilder>(*this, fragment, contextElement, this->parserContentPolicy(), m_options))
     , m_xssAuditorDelegate(fragment.document())
+    , m_weakFactory(this)
+    , m_nextSpeculativeTokenIndex(0)
+    , m_backgroundParserSourceOffset(0)
+    , m_lastSpeculativeTokenEndOffset(0)
+    , m_speculativeResumeState(HTMLTokenizer::DataState)
     , m_endWasDelayed(false)
     , m_haveBackgroundParser(false)
+    , m_hasConsideredBackgroundParser(true)
+    , m_backgroundParserWasFinished(false)
     , m_pumpSessionNestingLevel(0)
 {
     bool reportErrors = false; // For now document fragment parsing never reports errors.
@@ -116,6 +132,8 @@ void HTMLDocumentParser::detach()
 {
     DocumentParser::detach();
 
+    if (m_haveBackgroundParser)
+        stopBackgroundParser();
     if (m_scriptRunner)
         m_scriptRunner->detach();
     m_treeBuilder->detach();
@@ -129,6 +147,8 @@ void HTMLDocumentParser::detach()
 void HTMLDocumentParser::stopParsing()
 {
     DocumentParser::stopParsing();
+    if (m_haveBackgroundParser)
+        stopBackgroundParser();
     m_parserScheduler = nullptr; // Deleting the scheduler will clear any timers.
 }
 
@@ -186,6 +206,11 @@ void HTMLDocumentParser::pumpTokenizerIfPossible(SynchronousMode mode)
         return;
     }
 
+    if (m_haveBackgroundParser) {
+        pumpPendingSpeculations(mode);
+        return;
+    }
+
     pumpTokenizer(mode);
 }
 
@@ -203,7 +228,10 @@ void HTMLDocumentParser::resumeParsingAfterYield()
 
     // We should never be here unless we can pump immediately.  Call pumpTokenizer()
     // directly so that ASSERTS will fire if we're wrong.
-    pumpTokenizer(AllowYield);
+    if (m_haveBackgroundParser)
+        pumpPendingSpeculations(AllowYield);
+    else
+        pumpTokenizer(AllowYield);
     endIfDelayed();
 }
 
@@ -223,8 +251,6 @@ bool HTMLDocumentParser::canTakeNextToken(SynchronousMode mode, PumpSession& ses
     if (isStopped())
         return false;
 
-    ASSERT(!m_haveBackgroundParser || mode == ForceSynchronous);
-
     if (isWaitingForScripts()) {
         if (mode == AllowYield)
             m_parserScheduler->checkForYieldBeforeScript(session);
@@ -277,7 +303,7 @@ void HTMLDocumentParser::pumpTokenizer(SynchronousMode mode)
     ASSERT(refCount() >= 2);
     ASSERT(m_tokenizer);
     ASSERT(m_token);
-    ASSERT(!m_haveBackgroundParser || mode == ForceSynchronous);
+    ASSERT(!m_haveBackgroundParser);
 
     PumpSession session(m_pumpSessionNestingLevel, contextForParsingSession());
 
@@ -357,6 +383,219 @@ void HTMLDocumentParser::constructTreeFromHTMLToken(HTMLToken& rawToken)
     }
 }
 
+bool HTMLDocumentParser::shouldUseBackgroundParser() const
+{
+    Settings* settings = document()->settings();
+    if (!settings || !settings->threadedHTMLParserEnabled())
+        return false;
+
+    // Script-created documents are written to synchronously, and anything the
+    // tokenizer has already seen would have to be replayed on the parser thread.
+    return !isParsingFragment()
+        && m_scriptRunner
+        && !wasCreatedByScript()
+        && !inPumpSession()
+        && !m_input.hasInsertionPoint()
+        && m_input.current().isEmpty()
+        && m_tokenizer->state() == HTMLTokenizer::DataState;
+}
+
+void HTMLDocumentParser::startBackgroundParser()
+{
+    ASSERT(!m_haveBackgroundParser);
+    m_haveBackgroundParser = true;
+
+    auto configuration = std::make_unique<BackgroundHTMLParser::Configuration>();
+    configuration->options = m_options;
+    configuration->parser = m_weakFactory.createWeakPtr();
+    configuration->xssAuditor = std::make_unique<XSSAuditor>();
+    configuration->xssAuditor->init(document(), &m_xssAuditorDelegate);
+
+    // FIXME: Preload scanning stays on the main thread because TokenPreloadScanner
+    // matches tag and attribute names with AtomicStrings.
+    m_backgroundPreloadScanner = std::make_unique<TokenPreloadScanner>(document()->url(), document()->deviceScaleFactor());
+    m_backgroundPreloadScanner->setPredictedBaseElementURL(document()->baseElementURL());
+
+    m_backgroundParser = BackgroundHTMLParser::create(std::move(configuration));
+}
+
+void HTMLDocumentParser::stopBackgroundParser()
+{
+    ASSERT(m_haveBackgroundParser);
+    m_haveBackgroundParser = false;
+
+    // Our reference goes to the parser thread along with the stop request, so
+    // that the BackgroundHTMLParser is destroyed there after any queued work.
+    BackgroundHTMLParser* parser = m_backgroundParser.release().leakRef();
+    HTMLParserThread::shared().postTask([parser] {
+        parser->stop();
+        parser->deref();
+    });
+
+    m_speculations.clear();
+    m_nextSpeculativeTokenIndex = 0;
+    m_backgroundParserSource.clear();
+    m_backgroundPreloadScanner = nullptr;
+}
+
+void HTMLDocumentParser::didReceiveParsedChunkFromBackgroundParser(std::unique_ptr<ParsedChunk> chunk)
+{
+    if (!m_haveBackgroundParser || isStopped())
+        return;
+
+    // didBlockScript and pumping can cause this parser to be detached from the
+    // Document, but we need to ensure it isn't deleted yet.
+    Ref<HTMLDocumentParser> protect(*this);
+
+    for (auto& xssInfo : chunk->xssInfos) {
+        m_xssAuditorDelegate.didBlockScript(*xssInfo);
+        if (isStopped() || !m_haveBackgroundParser)
+            return;
+    }
+
+    PreloadRequestStream requests;
+    for (auto& token : chunk->tokens)
+        m_backgroundPreloadScanner->scan(token, requests);
+    m_preloader->preload(std::move(requests));
+
+    if (chunk->tokens.isEmpty())
+        return;
+    m_speculations.append(std::move(chunk));
+
+    if (inPumpSession()) {
+        // We'll process these tokens in a less-nested pump.
+        return;
+    }
+
+    pumpTokenizerIfPossible(AllowYield);
+    endIfDelayed();
+}
+
+void HTMLDocumentParser::pumpPendingSpeculations(SynchronousMode mode)
+{
+    ASSERT(!isStopped());
+    ASSERT(!isScheduledForResume());
+    // ASSERT that this object is both attached to the Document and protected.
+    ASSERT(refCount() >= 2);
+    ASSERT(m_haveBackgroundParser);
+
+    {
+        PumpSession session(m_pumpSessionNestingLevel, contextForParsingSession());
+
+        InspectorInstrumentationCookie cookie = InspectorInstrumentation::willWriteHTML(document(), m_input.current().currentLine().zeroBasedInt());
+
+        // Running scripts in canTakeNextToken can make us fall back to the main
+        // thread tokenizer, so check for speculations after it.
+        while (canTakeNextToken(mode, session) && !session.needsYield && m_haveBackgroundParser && !m_speculations.isEmpty())
+            processSpeculativeToken();
+
+        // Ensure we haven't been totally deref'ed after pumping. Any caller of this
+        // function should be holding a RefPtr to this to ensure we weren't deleted.
+        ASSERT(refCount() >= 1);
+
+        if (isStopped())
+            return;
+
+        if (session.needsYield)
+            m_parserScheduler->scheduleForResume();
+
+        InspectorInstrumentation::didWriteHTML(cookie, m_input.current().currentLine().zeroBasedInt());
+    }
+
+    if (!m_haveBackgroundParser)
+        pumpTokenizerIfPossible(mode);
+}
+
+void HTMLDocumentParser::processSpeculativeToken()
+{
+    ParsedChunk& chunk = *m_speculations.first();
+    CompactHTMLToken& compactToken = chunk.tokens[m_nextSpeculativeTokenIndex];
+
+    // Constructing the tree can re-enter the parser and throw the speculations
+    // away, so take everything we need from the token up front. The String
+    // keeps Character data alive for the AtomicHTMLToken that points into it.
+    HTMLToken::Type type = compactToken.type();
+    String data = compactToken.data();
+    HTMLTokenizer::State simulatedState = compactToken.simulatedTokenizerState();
+    bool simulatedShouldAllowCDATA = compactToken.simulatedShouldAllowCDATA();
+    bool simulatedForceNullCharacterReplacement = compactToken.simulatedForceNullCharacterReplacement();
+
+    // The tree builder reads the tokenizer and the source position as if the
+    // main thread had just tokenized this token.
+    const TextPosition& position = compactToken.endPosition();
+    m_input.current().setCurrentPosition(position.m_line, position.m_column, 0);
+    m_tokenizer->setState(compactToken.tokenizerStateBeforeSimulation());
+    AtomicHTMLToken token(compactToken);
+
+    m_lastSpeculativeTokenEndOffset = compactToken.endOffset();
+    m_lastSpeculativeTokenEndPosition = position;
+    if (type == HTMLToken::StartTag)
+        m_lastSpeculativeStartTagName = data;
+
+    while (!m_backgroundParserSource.isEmpty() && m_backgroundParserSourceOffset + m_backgroundParserSource.first().length() <= m_lastSpeculativeTokenEndOffset)
+        m_backgroundParserSourceOffset += m_backgroundParserSource.takeFirst().length();
+
+    if (++m_nextSpeculativeTokenIndex == chunk.tokens.size()) {
+        m_speculations.removeFirst();
+        m_nextSpeculativeTokenIndex = 0;
+    }
+
+    m_treeBuilder->constructTree(&token);
+
+    if (!m_haveBackgroundParser)
+        return;
+
+    if (type == HTMLToken::EndOfFile) {
+        stopBackgroundParser();
+        m_input.closeWithoutMarkingEndOfFile();
+        attemptToEnd();
+        return;
+    }
+
+    // Character tokens never change how the tree builder drives the tokenizer.
+    if (type == HTMLToken::Character)
+        return;
+
+    m_speculativeResumeState = m_tokenizer->state();
+    if (m_tokenizer->state() != simulatedState
+        || m_tokenizer->shouldAllowCDATA() != simulatedShouldAllowCDATA
+        || m_tokenizer->forceNullCharacterReplacement() != simulatedForceNullCharacterReplacement)
+        discardSpeculationsAndResumeOnMainThread();
+}
+
+void HTMLDocumentParser::discardSpeculationsAndResumeOnMainThread()
+{
+    ASSERT(m_haveBackgroundParser);
+
+    // Everything after the last token the tree builder has seen goes back into
+    // the main thread's input stream.
+    SegmentedString remainingSource;
+    unsigned offset = m_backgroundParserSourceOffset;
+    for (auto& source : m_backgroundParserSource) {
+        unsigned end = offset + source.length();
+        if (end > m_lastSpeculativeTokenEndOffset)
+            remainingSource.append(SegmentedString(offset >= m_lastSpeculativeTokenEndOffset ? source : source.substring(m_lastSpeculativeTokenEndOffset - offset)));
+        offset = end;
+    }
+    bool wasFinished = m_backgroundParserWasFinished;
+
+    stopBackgroundParser();
+
+    m_tokenizer->setState(m_speculativeResumeState);
+    if (!m_lastSpeculativeStartTagName.isNull())
+        m_tokenizer->setAppropriateEndTagName(m_lastSpeculativeStartTagName);
+
+    m_input.appendToEnd(remainingSource);
+    // With an insertion point, the InsertionPointRecord restores the position.
+    if (!m_input.hasInsertionPoint())
+        m_input.current().setCurrentPosition(m_lastSpeculativeTokenEndPosition.m_line, m_lastSpeculativeTokenEndPosition.m_column, 0);
+
+    if (wasFinished) {
+        m_input.markEndOfFile();
+        m_endWasDelayed = true;
+    }
+}
+
 bool HTMLDocumentParser::hasInsertionPoint()
 {
     // FIXME: The wasCreatedByScript() branch here might not be fully correct.
@@ -376,6 +615,11 @@ void HTMLDocumentParser::insert(const SegmentedString& source)
     // but we need to ensure it isn't deleted yet.
     Ref<HTMLDocumentParser> protect(*this);
 
+    // The background parser cannot follow document.write, so tokenize the rest
+    // of the document on the main thread.
+    if (m_haveBackgroundParser)
+        discardSpeculationsAndResumeOnMainThread();
+
     SegmentedString excludedLineNumberSource(source);
     excludedLineNumberSource.setExcludeLineNumbers();
     m_input.insertAtCurrentInsertionPoint(excludedLineNumberSource);
@@ -404,6 +648,26 @@ void HTMLDocumentParser::append(PassRefPtr<StringImpl> inputSource)
     Ref<HTMLDocumentParser> protect(*this);
     String source(inputSource);
 
+    if (!m_hasConsideredBackgroundParser) {
+        m_hasConsideredBackgroundParser = true;
+        if (shouldUseBackgroundParser())
+            startBackgroundParser();
+    }
+
+    if (m_haveBackgroundParser) {
+        m_backgroundParserSource.append(source);
+
+        // The copy is handed over by pointer so that only the parser thread
+        // ever touches its reference count.
+        String* isolatedSource = new String(source.isolatedCopy());
+        RefPtr<BackgroundHTMLParser> parser = m_backgroundParser;
+        HTMLParserThread::shared().postTask([parser, isolatedSource] {
+            std::unique_ptr<String> adoptedSource(isolatedSource);
+            parser->append(*adoptedSource);
+        });
+        return;
+    }
+
     if (m_preloadScanner) {
         if (m_input.current().isEmpty() && !isWaitingForScripts()) {
             // We have parsed until the end of the current input and so are now moving ahead of the preload scanner.
@@ -484,6 +748,18 @@ void HTMLDocumentParser::finish()
     // We're not going to get any more data off the network, so we tell the
     // input stream we've reached the end of file. finish() can be called more
     // than once, if the first time does not call end().
+    if (m_haveBackgroundParser) {
+        // We end once the main thread reaches the background parser's end of file token.
+        if (!m_backgroundParserWasFinished) {
+            m_backgroundParserWasFinished = true;
+            RefPtr<BackgroundHTMLParser> parser = m_backgroundParser;
+            HTMLParserThread::shared().postTask([parser] {
+                parser->finish();
+            });
+        }
+        return;
+    }
+
     if (!m_input.haveSeenEndOfFile())
         m_input.markEndOfFile();
 
@@ -58,6 +58,7 @@ class ScriptController;
 class ScriptSourceCode;
 
 class PumpSession;
+struct ParsedChunk;
 
 class HTMLDocumentParser :  public ScriptableDocumentParser, HTMLScriptRunnerHost, CachedResourceClient {
     WTF_MAKE_FAST_ALLOCATED;
@@ -93,6 +94,8 @@ protected:
     void forcePlaintextForTextDocument();
 
 private:
+    friend class BackgroundHTMLParser;
+
     static PassRefPtr<HTMLDocumentParser> create(DocumentFragment& fragment, Element* contextElement, ParserContentPolicy parserContentPolicy)
     {
         return adoptRef(new HTMLDocumentParser(fragment, contextElement, parserContentPolicy));
@@ -129,6 +132,14 @@ private:
     void pumpTokenizerIfPossible(SynchronousMode);
     void constructTreeFromHTMLToken(HTMLToken&);
 
+    bool shouldUseBackgroundParser() const;
+    void startBackgroundParser();
+    void stopBackgroundParser();
+    void didReceiveParsedChunkFromBackgroundParser(std::unique_ptr<ParsedChunk>);
+    void pumpPendingSpeculations(SynchronousMode);
+    void processSpeculativeToken();
+    void discardSpeculationsAndResumeOnMainThread();
+
     void runScriptsForPausedTreeBuilder();
     void resumeParsingAfterScriptExecution();
 
@@ -161,8 +172,28 @@ private:
 
     std::unique_ptr<HTMLResourcePreloader> m_preloader;
 
+    // Speculative tokenization on the HTMLParserThread. Tokens come back in
+    // chunks and are fed to the tree builder here, on the main thread.
+    WeakPtrFactory<HTMLDocumentParser> m_weakFactory;
+    RefPtr<BackgroundHTMLParser> m_backgroundParser;
+    std::unique_ptr<TokenPreloadScanner> m_backgroundPreloadScanner;
+    Deque<std::unique_ptr<ParsedChunk>> m_speculations;
+    size_t m_nextSpeculativeTokenIndex;
+
+    // Enough of the source and of the last token's position to pick up on the
+    // main thread if the tree builder does something the background parser
+    // could not predict.
+    Deque<String> m_backgroundParserSource;
+    unsigned m_backgroundParserSourceOffset;
+    unsigned m_lastSpeculativeTokenEndOffset;
+    TextPosition m_lastSpeculativeTokenEndPosition;
+    String m_lastSpeculativeStartTagName;
+    HTMLTokenizer::State m_speculativeResumeState;
+
     bool m_endWasDelayed;
     bool m_haveBackgroundParser;
+    bool m_hasConsideredBackgroundParser;
+    bool m_backgroundParserWasFinished;
     unsigned m_pumpSessionNestingLevel;
 };
 
@@ -290,6 +290,13 @@ bool threadSafeMatch(const QualifiedName& a, const QualifiedName& b)
     return threadSafeEqual(*a.localName().impl(), *b.localName().impl());
 }
 
+bool threadSafeMatch(const String& localName, const QualifiedName& qName)
+{
+    if (localName.isNull())
+        return false;
+    return threadSafeEqual(*localName.impl(), *qName.localName().impl());
+}
+
 typedef Vector<ImageWithScale> ImageCandidates;
 
 static inline bool compareByScaleFactor(const ImageWithScale& first, const ImageWithScale& second)
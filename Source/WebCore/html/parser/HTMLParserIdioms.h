@@ -130,6 +130,7 @@ inline bool isHTMLSpaceButNotLineBreak(UChar character)
 }
 
 bool threadSafeMatch(const QualifiedName&, const QualifiedName&);
+bool threadSafeMatch(const String& localName, const QualifiedName&);
 
 ImageWithScale bestFitSourceForImageAttributes(float deviceScaleFactor, const String& srcAttribute, const String& sourceSetAttribute);
 
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "config.h"
+#include "HTMLParserThread.h"
+
+#include <wtf/AutodrainedPool.h>
+#include <wtf/MainThread.h>
+
+namespace WebCore {
+
+HTMLParserThread& HTMLParserThread::shared()
+{
+    ASSERT(isMainThread());
+    static NeverDestroyed<HTMLParserThread> thread;
+    return thread;
+}
+
+HTMLParserThread::HTMLParserThread()
+{
+    ASSERT(isMainThread());
+    m_threadID = createThread(HTMLParserThread::threadEntryPointCallback, this, "WebCore: HTMLParser");
+}
+
+void HTMLParserThread::threadEntryPointCallback(void* thread)
+{
+    static_cast<HTMLParserThread*>(thread)->threadEntryPoint();
+}
+
+void HTMLParserThread::threadEntryPoint()
+{
+    ASSERT(!isMainThread());
+
+    while (auto task = m_queue.waitForMessage()) {
+        AutodrainedPool pool;
+        (*task)();
+    }
+}
+
+void HTMLParserThread::postTask(std::function<void ()> task)
+{
+    ASSERT(isMainThread());
+    ASSERT(m_threadID);
+    m_queue.append(std::make_unique<std::function<void ()>>(std::move(task)));
+}
+
+} // namespace WebCore
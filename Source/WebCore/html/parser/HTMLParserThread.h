@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef HTMLParserThread_h
+#define HTMLParserThread_h
+
+#include <functional>
+#include <wtf/MessageQueue.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Threading.h>
+
+namespace WebCore {
+
+// The thread that BackgroundHTMLParsers tokenize on. It is shared by every
+// document and lives for the rest of the process once started.
+class HTMLParserThread {
+    WTF_MAKE_NONCOPYABLE(HTMLParserThread); WTF_MAKE_FAST_ALLOCATED;
+public:
+    static HTMLParserThread& shared();
+
+    void postTask(std::function<void ()>);
+
+private:
+    friend NeverDestroyed<HTMLParserThread>;
+
+    HTMLParserThread();
+
+    // Called on the parser thread.
+    static void threadEntryPointCallback(void*);
+    void threadEntryPoint();
+
+    ThreadIdentifier m_threadID;
+    MessageQueue<std::function<void ()>> m_queue;
+};
+
+} // namespace WebCore
+
+#endif // HTMLParserThread_h
@@ -28,6 +28,7 @@
 #include "config.h"
 #include "HTMLPreloadScanner.h"
 
+#include "CompactHTMLToken.h"
 #include "HTMLNames.h"
 #include "HTMLParserIdioms.h"
 #include "HTMLTokenizer.h"
@@ -39,9 +40,8 @@ namespace WebCore {
 
 using namespace HTMLNames;
 
-TokenPreloadScanner::TagId TokenPreloadScanner::tagIdFor(const HTMLToken::DataVector& data)
+TokenPreloadScanner::TagId TokenPreloadScanner::tagIdFor(const AtomicString& tagName)
 {
-    AtomicString tagName(data);
     if (tagName == imgTag)
         return TagId::Img;
     if (tagName == inputTag)
@@ -50,6 +50,10 @@ TokenPreloadScanner::TagId TokenPreloadScanner::tagIdFor(const HTMLToken::DataVe
         return TagId::Link;
     if (tagName == scriptTag)
         return TagId::Script;
+#if ENABLE(VIDEO)
+    if (tagName == videoTag)
+        return TagId::Video;
+#endif
     if (tagName == styleTag)
         return TagId::Style;
     if (tagName == baseTag)
@@ -70,6 +74,8 @@ String TokenPreloadScanner::initiatorFor(TagId tagId)
         return "link";
     case TagId::Script:
         return "script";
+    case TagId::Video:
+        return "video";
     case TagId::Unknown:
     case TagId::Style:
     case TagId::Base:
@@ -101,7 +107,21 @@ public:
             String attributeValue = StringImpl::create8BitIfPossible(iter->value);
             processAttribute(attributeName, attributeValue);
         }
+        resolveSourceSet();
+    }
 
+    void processAttributes(const Vector<CompactHTMLToken::Attribute>& attributes)
+    {
+        ASSERT(isMainThread());
+        if (m_tagId >= TagId::Unknown)
+            return;
+        for (auto& attribute : attributes)
+            processAttribute(AtomicString(attribute.name), attribute.value);
+        resolveSourceSet();
+    }
+
+    void resolveSourceSet()
+    {
         // Resolve between src and srcSet if we have them.
         if (!m_srcSetAttribute.isEmpty()) {
             ImageWithScale imageCandidate = bestFitSourceForImageAttributes(m_deviceScaleFactor, m_urlToLoad, m_srcSetAttribute);
@@ -154,6 +174,9 @@ private:
                 setUrlToLoad(attributeValue);
             else if (match(attributeName, typeAttr))
                 m_inputIsImage = equalIgnoringCase(attributeValue, InputTypeNames::image());
+        } else if (m_tagId == TagId::Video) {
+            if (match(attributeName, posterAttr))
+                setUrlToLoad(attributeValue);
         }
     }
 
@@ -178,7 +201,7 @@ private:
     const String& charset() const
     {
         // FIXME: Its not clear that this if is needed, the loader probably ignores charset for image requests anyway.
-        if (m_tagId == TagId::Img)
+        if (m_tagId == TagId::Img || m_tagId == TagId::Video)
             return emptyString();
         return m_charset;
     }
@@ -187,7 +210,7 @@ private:
     {
         if (m_tagId == TagId::Script)
             return CachedResource::Script;
-        if (m_tagId == TagId::Img || (m_tagId == TagId::Input && m_inputIsImage))
+        if (m_tagId == TagId::Img || m_tagId == TagId::Video || (m_tagId == TagId::Input && m_inputIsImage))
             return CachedResource::ImageResource;
         if (m_tagId == TagId::Link && m_linkIsStyleSheet)
             return CachedResource::CSSStyleSheet;
@@ -264,6 +287,17 @@ void TokenPreloadScanner::rewindTo(TokenPreloadScannerCheckpoint checkpointIndex
 }
 
 void TokenPreloadScanner::scan(const HTMLToken& token, Vector<std::unique_ptr<PreloadRequest>>& requests)
+{
+    scanToken(token, requests);
+}
+
+void TokenPreloadScanner::scan(const CompactHTMLToken& token, Vector<std::unique_ptr<PreloadRequest>>& requests)
+{
+    scanToken(token, requests);
+}
+
+template<typename Token>
+void TokenPreloadScanner::scanToken(const Token& token, Vector<std::unique_ptr<PreloadRequest>>& requests)
 {
     switch (token.type()) {
     case HTMLToken::Character:
@@ -273,7 +307,7 @@ void TokenPreloadScanner::scan(const HTMLToken& token, Vector<std::unique_ptr<Pr
         return;
 
     case HTMLToken::EndTag: {
-        TagId tagId = tagIdFor(token.data());
+        TagId tagId = tagIdFor(AtomicString(token.data()));
 #if ENABLE(TEMPLATE_ELEMENT)
         if (tagId == TagId::Template) {
             if (m_templateCount)
@@ -294,7 +328,7 @@ void TokenPreloadScanner::scan(const HTMLToken& token, Vector<std::unique_ptr<Pr
         if (m_templateCount)
             return;
 #endif
-        TagId tagId = tagIdFor(token.data());
+        TagId tagId = tagIdFor(AtomicString(token.data()));
 #if ENABLE(TEMPLATE_ELEMENT)
         if (tagId == TagId::Template) {
             ++m_templateCount;
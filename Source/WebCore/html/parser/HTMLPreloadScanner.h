@@ -36,6 +36,7 @@ namespace WebCore {
 
 typedef size_t TokenPreloadScannerCheckpoint;
 
+class CompactHTMLToken;
 class HTMLParserOptions;
 class HTMLTokenizer;
 class SegmentedString;
@@ -47,6 +48,7 @@ public:
     ~TokenPreloadScanner();
 
     void scan(const HTMLToken&, PreloadRequestStream& requests);
+    void scan(const CompactHTMLToken&, PreloadRequestStream& requests);
 
     void setPredictedBaseElementURL(const URL& url) { m_predictedBaseElementURL = url; }
 
@@ -68,6 +70,7 @@ private:
         Input,
         Link,
         Script,
+        Video,
 
         // These tags are not scanned by the StartTagScanner.
         Unknown,
@@ -78,10 +81,13 @@ private:
 
     class StartTagScanner;
 
-    static TagId tagIdFor(const HTMLToken::DataVector&);
+    static TagId tagIdFor(const AtomicString&);
 
     static String initiatorFor(TagId);
 
+    template<typename Token>
+    void scanToken(const Token&, PreloadRequestStream&);
+
     template<typename Token>
     void updatePredictedBaseURL(const Token&);
 
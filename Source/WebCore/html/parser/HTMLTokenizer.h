@@ -164,6 +164,15 @@ public:
     State state() const { return m_state; }
     void setState(State state) { m_state = state; }
 
+    // Lets this tokenizer pick up where another tokenizer left off after
+    // emitting a start tag, so that the matching end tag is recognized.
+    void setAppropriateEndTagName(const String& tagName)
+    {
+        m_appropriateEndTagName.clear();
+        for (unsigned i = 0; i < tagName.length(); ++i)
+            m_appropriateEndTagName.append(tagName[i]);
+    }
+
     inline bool shouldSkipNullCharacters() const
     {
         return !m_forceNullCharacterReplacement
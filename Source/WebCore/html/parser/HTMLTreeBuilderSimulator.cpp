@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "config.h"
+#include "HTMLTreeBuilderSimulator.h"
+
+#include "CompactHTMLToken.h"
+#include "HTMLNames.h"
+#include "HTMLParserIdioms.h"
+#include "HTMLTokenizer.h"
+#include "MathMLNames.h"
+#include "SVGNames.h"
+
+namespace WebCore {
+
+using namespace HTMLNames;
+
+static bool tokenExitsForeignContent(const CompactHTMLToken& token)
+{
+    // This is the list of start tags that pop us out of foreign content in
+    // HTMLTreeBuilder::processTokenInForeignContent, matched without touching
+    // AtomicStrings.
+    const String& tagName = token.data();
+    return threadSafeMatch(tagName, bTag)
+        || threadSafeMatch(tagName, bigTag)
+        || threadSafeMatch(tagName, blockquoteTag)
+        || threadSafeMatch(tagName, bodyTag)
+        || threadSafeMatch(tagName, brTag)
+        || threadSafeMatch(tagName, centerTag)
+        || threadSafeMatch(tagName, codeTag)
+        || threadSafeMatch(tagName, ddTag)
+        || threadSafeMatch(tagName, divTag)
+        || threadSafeMatch(tagName, dlTag)
+        || threadSafeMatch(tagName, dtTag)
+        || threadSafeMatch(tagName, emTag)
+        || threadSafeMatch(tagName, embedTag)
+        || threadSafeMatch(tagName, h1Tag)
+        || threadSafeMatch(tagName, h2Tag)
+        || threadSafeMatch(tagName, h3Tag)
+        || threadSafeMatch(tagName, h4Tag)
+        || threadSafeMatch(tagName, h5Tag)
+        || threadSafeMatch(tagName, h6Tag)
+        || threadSafeMatch(tagName, headTag)
+        || threadSafeMatch(tagName, hrTag)
+        || threadSafeMatch(tagName, iTag)
+        || threadSafeMatch(tagName, imgTag)
+        || threadSafeMatch(tagName, liTag)
+        || threadSafeMatch(tagName, listingTag)
+        || threadSafeMatch(tagName, menuTag)
+        || threadSafeMatch(tagName, metaTag)
+        || threadSafeMatch(tagName, nobrTag)
+        || threadSafeMatch(tagName, olTag)
+        || threadSafeMatch(tagName, pTag)
+        || threadSafeMatch(tagName, preTag)
+        || threadSafeMatch(tagName, rubyTag)
+        || threadSafeMatch(tagName, sTag)
+        || threadSafeMatch(tagName, smallTag)
+        || threadSafeMatch(tagName, spanTag)
+        || threadSafeMatch(tagName, strongTag)
+        || threadSafeMatch(tagName, strikeTag)
+        || threadSafeMatch(tagName, subTag)
+        || threadSafeMatch(tagName, supTag)
+        || threadSafeMatch(tagName, tableTag)
+        || threadSafeMatch(tagName, ttTag)
+        || threadSafeMatch(tagName, uTag)
+        || threadSafeMatch(tagName, ulTag)
+        || threadSafeMatch(tagName, varTag)
+        || (threadSafeMatch(tagName, fontTag) && (token.getAttributeItem(colorAttr) || token.getAttributeItem(faceAttr) || token.getAttributeItem(sizeAttr)));
+}
+
+static bool tokenExitsSVG(const CompactHTMLToken& token)
+{
+    // The tokenizer lowercases tag names, so foreignObject has to be matched
+    // without regard to case.
+    const String& tagName = token.data();
+    return equalIgnoringCase(tagName, SVGNames::foreignObjectTag.localName())
+        || threadSafeMatch(tagName, SVGNames::descTag)
+        || threadSafeMatch(tagName, SVGNames::titleTag);
+}
+
+static bool tokenExitsMath(const CompactHTMLToken& token)
+{
+    const String& tagName = token.data();
+    return threadSafeMatch(tagName, MathMLNames::miTag)
+        || threadSafeMatch(tagName, MathMLNames::moTag)
+        || threadSafeMatch(tagName, MathMLNames::mnTag)
+        || threadSafeMatch(tagName, MathMLNames::msTag)
+        || threadSafeMatch(tagName, MathMLNames::mtextTag);
+}
+
+static bool isRawTextState(HTMLTokenizer::State state)
+{
+    return state == HTMLTokenizer::RCDATAState
+        || state == HTMLTokenizer::RAWTEXTState
+        || state == HTMLTokenizer::ScriptDataState;
+}
+
+HTMLTreeBuilderSimulator::HTMLTreeBuilderSimulator(const HTMLParserOptions& options)
+    : m_options(options)
+{
+    m_namespaceStack.append(HTML);
+}
+
+void HTMLTreeBuilderSimulator::simulate(const CompactHTMLToken& token, HTMLTokenizer& tokenizer)
+{
+    if (token.type() == HTMLToken::StartTag) {
+        const String& tagName = token.data();
+        if (threadSafeMatch(tagName, SVGNames::svgTag))
+            m_namespaceStack.append(SVG);
+        if (threadSafeMatch(tagName, MathMLNames::mathTag))
+            m_namespaceStack.append(MathML);
+        if (inForeignContent() && tokenExitsForeignContent(token)) {
+            while (inForeignContent())
+                m_namespaceStack.removeLast();
+        }
+        if (!inForeignContent()) {
+            // This mirrors HTMLTokenizer::updateStateFor, which needs AtomicStrings.
+            if (threadSafeMatch(tagName, textareaTag) || threadSafeMatch(tagName, titleTag))
+                tokenizer.setState(HTMLTokenizer::RCDATAState);
+            else if (threadSafeMatch(tagName, plaintextTag))
+                tokenizer.setState(HTMLTokenizer::PLAINTEXTState);
+            else if (threadSafeMatch(tagName, scriptTag))
+                tokenizer.setState(HTMLTokenizer::ScriptDataState);
+            else if (threadSafeMatch(tagName, styleTag)
+                || threadSafeMatch(tagName, iframeTag)
+                || threadSafeMatch(tagName, xmpTag)
+                || (threadSafeMatch(tagName, noembedTag) && m_options.pluginsEnabled)
+                || threadSafeMatch(tagName, noframesTag)
+                || (threadSafeMatch(tagName, noscriptTag) && m_options.scriptEnabled))
+                tokenizer.setState(HTMLTokenizer::RAWTEXTState);
+        }
+
+        // Integration points are foreign elements whose children are parsed as HTML.
+        if (token.selfClosing()) {
+            if (inForeignContent() && (threadSafeMatch(tagName, SVGNames::svgTag) || threadSafeMatch(tagName, MathMLNames::mathTag)))
+                m_namespaceStack.removeLast();
+        } else if ((m_namespaceStack.last() == SVG && tokenExitsSVG(token))
+            || (m_namespaceStack.last() == MathML && tokenExitsMath(token)))
+            m_namespaceStack.append(HTML);
+    }
+
+    if (token.type() == HTMLToken::EndTag) {
+        const String& tagName = token.data();
+        if (m_namespaceStack.size() > 1) {
+            if ((m_namespaceStack.last() == SVG && threadSafeMatch(tagName, SVGNames::svgTag))
+                || (m_namespaceStack.last() == MathML && threadSafeMatch(tagName, MathMLNames::mathTag))
+                || (m_namespaceStack.contains(SVG) && m_namespaceStack.last() == HTML && tokenExitsSVG(token))
+                || (m_namespaceStack.contains(MathML) && m_namespaceStack.last() == HTML && tokenExitsMath(token)))
+                m_namespaceStack.removeLast();
+        }
+        if (threadSafeMatch(tagName, scriptTag) && !inForeignContent())
+            tokenizer.setState(HTMLTokenizer::DataState);
+    }
+
+    // These mirror the adjustments at the end of HTMLTreeBuilder::constructTree.
+    tokenizer.setForceNullCharacterReplacement(isRawTextState(tokenizer.state()) || inForeignContent());
+    tokenizer.setShouldAllowCDATA(inForeignContent());
+}
+
+} // namespace WebCore
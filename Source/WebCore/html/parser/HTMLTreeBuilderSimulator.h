@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef HTMLTreeBuilderSimulator_h
+#define HTMLTreeBuilderSimulator_h
+
+#include "HTMLParserOptions.h"
+#include <wtf/Vector.h>
+
+namespace WebCore {
+
+class CompactHTMLToken;
+class HTMLTokenizer;
+
+// Predicts, without building a tree, how the HTMLTreeBuilder would adjust the
+// tokenizer after each token. This lets the BackgroundHTMLParser keep
+// tokenizing ahead of the main thread. It only tracks enough of the stack of
+// open elements to know whether we are in foreign content, and it may guess
+// wrong; the main thread checks every guess against the real tree builder.
+class HTMLTreeBuilderSimulator {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    explicit HTMLTreeBuilderSimulator(const HTMLParserOptions&);
+
+    void simulate(const CompactHTMLToken&, HTMLTokenizer&);
+
+private:
+    enum Namespace { HTML, SVG, MathML };
+
+    bool inForeignContent() const { return m_namespaceStack.last() != HTML; }
+
+    HTMLParserOptions m_options;
+    Vector<Namespace, 1> m_namespaceStack;
+};
+
+} // namespace WebCore
+
+#endif // HTMLTreeBuilderSimulator_h
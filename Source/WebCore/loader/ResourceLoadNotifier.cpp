@@ -31,14 +31,21 @@
 #include "config.h"
 #include "ResourceLoadNotifier.h"
 
+#include "DNS.h"
+#include "Document.h"
 #include "DocumentLoader.h"
 #include "Frame.h"
 #include "FrameLoader.h"
 #include "FrameLoaderClient.h"
 #include "InspectorInstrumentation.h"
+#include "MainFrame.h"
 #include "Page.h"
 #include "ProgressTracker.h"
 #include "ResourceLoader.h"
+#include "Settings.h"
+#include <wtf/HashMap.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/text/StringHash.h>
 
 #if USE(QUICK_LOOK)
 #include "QuickLook.h"
@@ -46,11 +53,77 @@
 
 namespace WebCore {
 
+// Remembers which other hosts served subresources for pages of each top-level host, so that
+// their names can already be resolved when a later navigation to that host starts.
+typedef HashMap<String, Vector<String>> SubresourceHostMap;
+
+static SubresourceHostMap& subresourceHostsByTopLevelHost()
+{
+    static NeverDestroyed<SubresourceHostMap> map;
+    return map;
+}
+
+static const unsigned maximumPredictedTopLevelHosts = 64;
+static const unsigned maximumPredictedSubresourceHosts = 16;
+
+static void predictSubresourceHosts(Frame& frame, ResourceLoader* loader, const ResourceRequest& request)
+{
+    // Follow the same policy as Document::initDNSPrefetch(): only plain HTTP pages prefetch.
+    if (!frame.settings().dnsPrefetchingEnabled() || !frame.page() || frame.page()->usesEphemeralSession())
+        return;
+
+    const URL& url = request.url();
+    if (!url.protocolIsInHTTPFamily())
+        return;
+
+    SubresourceHostMap& map = subresourceHostsByTopLevelHost();
+
+    // The main resource of a navigation is loaded by the provisional DocumentLoader; subresources
+    // belong to the committed one.
+    DocumentLoader* documentLoader = loader->documentLoader();
+    if (frame.isMainFrame() && documentLoader && documentLoader == frame.loader().provisionalDocumentLoader()) {
+        if (!url.protocolIs("http"))
+            return;
+        auto hosts = map.find(url.host());
+        if (hosts == map.end())
+            return;
+        for (size_t i = 0; i < hosts->value.size(); ++i)
+            prefetchDNS(hosts->value[i]);
+        return;
+    }
+
+    Document* topDocument = frame.mainFrame().document();
+    if (!topDocument || !topDocument->url().protocolIs("http"))
+        return;
+
+    String topLevelHost = topDocument->url().host();
+    String host = url.host();
+    if (topLevelHost.isEmpty() || host.isEmpty() || equalIgnoringCase(host, topLevelHost))
+        return;
+
+    auto hosts = map.find(topLevelHost);
+    if (hosts == map.end()) {
+        if (map.size() >= maximumPredictedTopLevelHosts)
+            map.remove(map.begin());
+        hosts = map.add(topLevelHost, Vector<String>()).iterator;
+    }
+
+    Vector<String>& subresourceHosts = hosts->value;
+    if (subresourceHosts.contains(host) || subresourceHosts.size() >= maximumPredictedSubresourceHosts)
+        return;
+    subresourceHosts.append(host);
+}
+
 ResourceLoadNotifier::ResourceLoadNotifier(Frame& frame)
     : m_frame(frame)
 {
 }
 
+void ResourceLoadNotifier::clearPredictedSubresourceHosts()
+{
+    subresourceHostsByTopLevelHost().clear();
+}
+
 void ResourceLoadNotifier::didReceiveAuthenticationChallenge(ResourceLoader* loader, const AuthenticationChallenge& currentWebChallenge)
 {
     didReceiveAuthenticationChallenge(loader->identifier(), loader->documentLoader(), currentWebChallenge);
@@ -75,6 +148,8 @@ void ResourceLoadNotifier::willSendRequest(ResourceLoader* loader, ResourceReque
 {
     m_frame.loader().applyUserAgent(clientRequest);
 
+    predictSubresourceHosts(m_frame, loader, clientRequest);
+
     dispatchWillSendRequest(loader->documentLoader(), loader->identifier(), clientRequest, redirectResponse);
 }
 
@@ -48,6 +48,9 @@ class ResourceLoadNotifier {
 public:
     explicit ResourceLoadNotifier(Frame&);
 
+    // Forgets the hosts remembered for DNS prefetching, e.g. when the user clears their history or caches.
+    static void clearPredictedSubresourceHosts();
+
     void didReceiveAuthenticationChallenge(ResourceLoader*, const AuthenticationChallenge&);
     void didReceiveAuthenticationChallenge(unsigned long identifier, DocumentLoader*, const AuthenticationChallenge&);
     void didCancelAuthenticationChallenge(ResourceLoader*, const AuthenticationChallenge&);
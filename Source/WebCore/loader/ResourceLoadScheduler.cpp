@@ -232,6 +232,23 @@ void ResourceLoadScheduler::crossOriginRedirectReceived(ResourceLoader* resource
     oldHost->remove(resourceLoader);
 }
 
+void ResourceLoadScheduler::setResourceLoadPriority(ResourceLoader* resourceLoader, ResourceLoadPriority priority)
+{
+    ASSERT(resourceLoader);
+
+    // Only loads that are still waiting for a connection can be moved; loads in progress keep their place.
+    HostInformation* host = hostForURL(resourceLoader->url());
+    if (!host || !host->reschedulePending(resourceLoader, priority))
+        return;
+
+    if (priority > ResourceLoadPriorityLow && !isSuspendingPendingRequests()) {
+        servePendingRequests(host, priority);
+        return;
+    }
+
+    scheduleServePendingRequests();
+}
+
 void ResourceLoadScheduler::servePendingRequests(ResourceLoadPriority minimumPriority)
 {
     LOG(ResourceLoading, "ResourceLoadScheduler::servePendingRequests. m_suspendPendingRequestsCount=%d", m_suspendPendingRequestsCount); 
@@ -357,6 +374,24 @@ void ResourceLoadScheduler::HostInformation::remove(ResourceLoader* resourceLoad
     }
 }
 
+bool ResourceLoadScheduler::HostInformation::reschedulePending(ResourceLoader* resourceLoader, ResourceLoadPriority newPriority)
+{
+    for (int priority = ResourceLoadPriorityHighest; priority >= ResourceLoadPriorityLowest; --priority) {
+        RequestQueue::iterator end = m_requestsPending[priority].end();
+        for (RequestQueue::iterator it = m_requestsPending[priority].begin(); it != end; ++it) {
+            if (*it == resourceLoader) {
+                if (priority == newPriority)
+                    return false;
+                RefPtr<ResourceLoader> protector(resourceLoader);
+                m_requestsPending[priority].remove(it);
+                m_requestsPending[newPriority].append(protector.release());
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 bool ResourceLoadScheduler::HostInformation::hasRequests() const
 {
     if (!m_requestsLoading.isEmpty())
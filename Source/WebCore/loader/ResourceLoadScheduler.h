@@ -54,6 +54,7 @@ public:
     virtual PassRefPtr<NetscapePlugInStreamLoader> schedulePluginStreamLoad(Frame*, NetscapePlugInStreamLoaderClient*, const ResourceRequest&);
     virtual void remove(ResourceLoader*);
     virtual void crossOriginRedirectReceived(ResourceLoader*, const URL& redirectURL);
+    virtual void setResourceLoadPriority(ResourceLoader*, ResourceLoadPriority);
     
     virtual void servePendingRequests(ResourceLoadPriority minimumPriority = ResourceLoadPriorityVeryLow);
     virtual void suspendPendingRequests();
@@ -93,6 +94,7 @@ private:
         void schedule(ResourceLoader*, ResourceLoadPriority = ResourceLoadPriorityVeryLow);
         void addLoadInProgress(ResourceLoader*);
         void remove(ResourceLoader*);
+        bool reschedulePending(ResourceLoader*, ResourceLoadPriority);
         bool hasRequests() const;
         bool limitRequests(ResourceLoadPriority) const;
 
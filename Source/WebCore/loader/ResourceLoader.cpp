@@ -398,6 +398,7 @@ void ResourceLoader::didChangePriority(ResourceLoadPriority loadPriority)
 {
     if (m_handle)
         m_handle->didChangePriority(loadPriority);
+    platformStrategies()->loaderStrategy()->resourceLoadScheduler()->setResourceLoadPriority(this, loadPriority);
 }
 
 void ResourceLoader::cancel()
@@ -36,6 +36,7 @@
 #include "Image.h"
 #include "Logging.h"
 #include "PublicSuffix.h"
+#include "ResourceLoadNotifier.h"
 #include "SecurityOrigin.h"
 #include "SecurityOriginHash.h"
 #include "WorkerGlobalScope.h"
@@ -972,6 +973,8 @@ void MemoryCache::setDisabled(bool disabled)
 
 void MemoryCache::evictResources()
 {
+    ResourceLoadNotifier::clearPredictedSubresourceHosts();
+
     if (disabled())
         return;
 
@@ -1132,6 +1132,9 @@ void IconDatabase::performOpenInitialization()
             }          
         }
     }
+
+    // Losing the most recent icon writes on a power failure is harmless; they are recreated on the next visit.
+    m_syncDB.setSynchronousNormalIfUsingWAL();
     
     int version = databaseVersionNumber(m_syncDB);
     
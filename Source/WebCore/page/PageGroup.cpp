@@ -36,6 +36,7 @@
 #include "MainFrame.h"
 #include "Page.h"
 #include "PageCache.h"
+#include "ResourceLoadNotifier.h"
 #include "SecurityOrigin.h"
 #include "Settings.h"
 #include "StorageNamespace.h"
@@ -255,6 +256,7 @@ void PageGroup::removeAllVisitedLinks()
 {
     Page::removeAllVisitedLinks();
     pageCache()->markPagesForVistedLinkStyleRecalc();
+    ResourceLoadNotifier::clearPredictedSubresourceHosts();
 }
 
 void PageGroup::setShouldTrackVisitedLinks(bool shouldTrack)
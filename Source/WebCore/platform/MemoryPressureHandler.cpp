@@ -55,6 +55,7 @@ MemoryPressureHandler::MemoryPressureHandler()
     , m_lastRespondTime(0)
     , m_lowMemoryHandler(releaseMemory)
     , m_underMemoryPressure(false)
+    , m_isInBackground(false)
 #if PLATFORM(IOS)
     // FIXME: Can we share more of this with OpenSource?
     , m_memoryPressureReason(MemoryPressureReasonNone)
@@ -65,13 +66,31 @@ MemoryPressureHandler::MemoryPressureHandler()
 {
 }
 
+void MemoryPressureHandler::setIsInBackground(bool isInBackground)
+{
+    if (isInBackground == m_isInBackground)
+        return;
+    m_isInBackground = isInBackground;
+
+    // Nobody is waiting on a background process, so it can give back every free
+    // page. In the foreground, freed pages are likely to be reused soon, so let
+    // the allocator keep them around and avoid refaulting them.
+    if (m_isInBackground)
+        WTF::setFastMallocScavengerTarget(0);
+    else
+        WTF::clearFastMallocScavengerTarget();
+}
+
 void MemoryPressureHandler::releaseMemory(bool critical)
 {
-    {
+    if (critical) {
         ReliefLogger log("Empty the PageCache");
-        int savedPageCacheCapacity = pageCache()->capacity();
-        pageCache()->setCapacity(0);
-        pageCache()->setCapacity(savedPageCacheCapacity);
+        pageCache()->pruneToCapacityNow(0);
+    } else {
+        // Keep the most recent page so that going back once stays instant. Its decoded
+        // images are not being painted, so the MemoryCache prune below drops them anyway.
+        ReliefLogger log("Prune the PageCache to the most recent page");
+        pageCache()->pruneToCapacityNow(1);
     }
 
     {
@@ -94,15 +113,19 @@ void MemoryPressureHandler::releaseMemory(bool critical)
         clearWidthCaches();
     }
 
-    {
-        ReliefLogger log("Discard StyleResolvers");
-        for (auto* document : Document::allDocuments())
-            document->clearStyleResolver();
-    }
-
-    {
-        ReliefLogger log("Discard all JIT-compiled code");
-        gcController().discardAllCompiledCode();
+    if (critical) {
+        // Both of these are expensive to rebuild, so only give them up when
+        // the system is actually running out of memory.
+        {
+            ReliefLogger log("Discard StyleResolvers");
+            for (auto* document : Document::allDocuments())
+                document->clearStyleResolver();
+        }
+
+        {
+            ReliefLogger log("Discard all JIT-compiled code");
+            gcController().discardAllCompiledCode();
+        }
     }
 
     platformReleaseMemory(critical);
@@ -123,7 +146,7 @@ void MemoryPressureHandler::releaseMemory(bool critical)
 void MemoryPressureHandler::install() { }
 void MemoryPressureHandler::uninstall() { }
 void MemoryPressureHandler::holdOff(unsigned) { }
-void MemoryPressureHandler::respondToMemoryPressure() { }
+void MemoryPressureHandler::respondToMemoryPressure(bool) { }
 void MemoryPressureHandler::platformReleaseMemory(bool) { }
 void MemoryPressureHandler::ReliefLogger::platformLog() { }
 size_t MemoryPressureHandler::ReliefLogger::platformMemoryUsage() { return 0; }
@@ -61,6 +61,11 @@ public:
 
     bool isUnderMemoryPressure() const { return m_underMemoryPressure; }
 
+    // A process with nothing on screen has its free memory returned to the
+    // system right away instead of on the allocator's usual schedule.
+    void setIsInBackground(bool);
+    bool isInBackground() const { return m_isInBackground; }
+
 #if PLATFORM(IOS)
     // FIXME: Can we share more of this with OpenSource?
     void installMemoryReleaseBlock(void (^releaseMemoryBlock)(), bool clearPressureOnMemoryRelease = true);
@@ -101,7 +106,7 @@ private:
     MemoryPressureHandler();
     ~MemoryPressureHandler();
 
-    void respondToMemoryPressure();
+    void respondToMemoryPressure(bool critical);
     static void releaseMemory(bool critical);
     static void platformReleaseMemory(bool critical);
 
@@ -110,6 +115,7 @@ private:
     LowMemoryHandler m_lowMemoryHandler;
 
     std::atomic<bool> m_underMemoryPressure;
+    bool m_isInBackground;
 
 #if PLATFORM(IOS)
     uint32_t m_memoryPressureReason;
@@ -654,8 +654,33 @@ void vclip(const float* sourceP, int sourceStride, const float* lowThresholdP, c
     float lowThreshold = *lowThresholdP;
     float highThreshold = *highThresholdP;
 
-    // FIXME: Optimize for SSE2.
-#if HAVE(ARM_NEON_INTRINSICS)
+#ifdef __SSE2__
+    if ((sourceStride == 1) && (destStride == 1)) {
+        // If the sourceP address is not 16-byte aligned, the first several frames (at most three) should be processed separately.
+        while ((reinterpret_cast<uintptr_t>(sourceP) & 0x0F) && n) {
+            *destP = std::max(std::min(*sourceP, highThreshold), lowThreshold);
+            sourceP++;
+            destP++;
+            n--;
+        }
+
+        // Now the sourceP is aligned, use SSE.
+        int tailFrames = n % 4;
+        const float* endP = destP + n - tailFrames;
+
+        __m128 low = _mm_set1_ps(lowThreshold);
+        __m128 high = _mm_set1_ps(highThreshold);
+        while (destP < endP) {
+            __m128 source = _mm_load_ps(sourceP);
+            // minps and maxps return their second operand when either is NaN, so pass the
+            // source second to propagate NaN like the scalar loop does.
+            _mm_storeu_ps(destP, _mm_max_ps(low, _mm_min_ps(high, source)));
+            sourceP += 4;
+            destP += 4;
+        }
+        n = tailFrames;
+    }
+#elif HAVE(ARM_NEON_INTRINSICS)
     if ((sourceStride == 1) && (destStride == 1)) {
         int tailFrames = n % 4;
         const float* endP = destP + n - tailFrames;
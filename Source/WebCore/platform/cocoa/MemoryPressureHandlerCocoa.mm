@@ -74,6 +74,18 @@ static int _notifyToken;
 static const unsigned s_minimumHoldOffTime = 5;
 static const unsigned s_holdOffMultiplier = 20;
 
+// Only the iOS memory status source tells warning and critical pressure apart.
+// Every other source is treated as critical, so that ports without a separate
+// critical signal still release everything they can.
+static bool cacheEventIsCritical()
+{
+#if PLATFORM(IOS) && __IPHONE_OS_VERSION_MIN_REQUIRED >= 80000
+    return dispatch_source_get_data(_cache_event_source) & DISPATCH_MEMORYSTATUS_PRESSURE_CRITICAL;
+#else
+    return true;
+#endif
+}
+
 void MemoryPressureHandler::install()
 {
     if (m_installed || _timer_event_source)
@@ -81,7 +93,7 @@ void MemoryPressureHandler::install()
 
     dispatch_async(dispatch_get_main_queue(), ^{
 #if PLATFORM(IOS) && __IPHONE_OS_VERSION_MIN_REQUIRED >= 80000
-        _cache_event_source = dispatch_source_create(DISPATCH_SOURCE_TYPE_MEMORYSTATUS, 0, DISPATCH_MEMORYSTATUS_PRESSURE_WARN, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0));
+        _cache_event_source = dispatch_source_create(DISPATCH_SOURCE_TYPE_MEMORYSTATUS, 0, DISPATCH_MEMORYSTATUS_PRESSURE_WARN | DISPATCH_MEMORYSTATUS_PRESSURE_CRITICAL, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0));
 #elif PLATFORM(MAC) && MAC_OS_X_VERSION_MIN_REQUIRED >= 1090
         _cache_event_source = wkCreateMemoryStatusPressureCriticalDispatchOnMainQueue();
 #else
@@ -90,7 +102,7 @@ void MemoryPressureHandler::install()
         if (_cache_event_source) {
             dispatch_set_context(_cache_event_source, this);
             dispatch_source_set_event_handler(_cache_event_source, ^{
-                memoryPressureHandler().respondToMemoryPressure();
+                memoryPressureHandler().respondToMemoryPressure(cacheEventIsCritical());
             });
             dispatch_resume(_cache_event_source);
         }
@@ -103,7 +115,7 @@ void MemoryPressureHandler::install()
         // This gives us a more consistent picture of live objects at the end of testing.
         gcController().garbageCollectNow();
 
-        memoryPressureHandler().respondToMemoryPressure();
+        memoryPressureHandler().respondToMemoryPressure(true);
         malloc_zone_pressure_relief(nullptr, 0);
     });
 
@@ -154,13 +166,13 @@ void MemoryPressureHandler::holdOff(unsigned seconds)
     });
 }
 
-void MemoryPressureHandler::respondToMemoryPressure()
+void MemoryPressureHandler::respondToMemoryPressure(bool critical)
 {
     uninstall();
 
     double startTime = monotonicallyIncreasingTime();
 
-    m_lowMemoryHandler(false);
+    m_lowMemoryHandler(critical);
 
     unsigned holdOffTime = (monotonicallyIncreasingTime() - startTime) * s_holdOffMultiplier;
 
@@ -29,7 +29,11 @@
 
 #include "ANGLEWebKitBridge.h"
 #include "Logging.h"
+#include <wtf/HashMap.h>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/StdLibExtras.h>
+#include <wtf/text/StringBuilder.h>
+#include <wtf/text/StringHash.h>
 
 namespace WebCore {
 
@@ -144,6 +148,48 @@ static bool getSymbolInfo(ShHandle compiler, ShShaderInfo symbolType, Vector<ANG
     return true;
 }
 
+// Pages commonly compile the same shaders in every context and on every reload, so
+// successful translations are shared process-wide. The key covers everything that can
+// change ANGLE's output: the source, shader type, output and spec, compile options and
+// built-in resources.
+struct ShaderTranslation {
+    String translatedShaderSource;
+    Vector<ANGLEShaderSymbol> symbols;
+};
+
+typedef HashMap<String, ShaderTranslation> ShaderTranslationCache;
+
+static ShaderTranslationCache& shaderTranslationCache()
+{
+    static NeverDestroyed<ShaderTranslationCache> cache;
+    return cache;
+}
+
+static const unsigned maximumShaderTranslationCacheSize = 256;
+
+static String shaderTranslationCacheKey(const char* shaderSource, ANGLEShaderType shaderType, ShShaderOutput shaderOutput, ShShaderSpec shaderSpec, int compileOptions, const ShBuiltInResources& resources)
+{
+    const int values[] = {
+        shaderType, shaderOutput, shaderSpec, compileOptions,
+        resources.MaxVertexAttribs, resources.MaxVertexUniformVectors, resources.MaxVaryingVectors,
+        resources.MaxVertexTextureImageUnits, resources.MaxCombinedTextureImageUnits, resources.MaxTextureImageUnits,
+        resources.MaxFragmentUniformVectors, resources.MaxDrawBuffers,
+        resources.OES_standard_derivatives, resources.OES_EGL_image_external, resources.ARB_texture_rectangle,
+        resources.EXT_draw_buffers, resources.EXT_frag_depth, resources.FragmentPrecisionHigh,
+        resources.ArrayIndexClampingStrategy, resources.MaxExpressionComplexity, resources.MaxCallStackDepth
+    };
+
+    StringBuilder key;
+    for (size_t i = 0; i < WTF_ARRAY_LENGTH(values); ++i) {
+        key.appendNumber(values[i]);
+        key.append(',');
+    }
+    key.appendNumber(static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(resources.HashFunction)));
+    key.append('\n');
+    key.append(shaderSource);
+    return key.toString();
+}
+
 ANGLEWebKitBridge::ANGLEWebKitBridge(ShShaderOutput shaderOutput, ShShaderSpec shaderSpec)
     : builtCompilers(false)
     , m_fragmentCompiler(0)
@@ -182,6 +228,16 @@ void ANGLEWebKitBridge::setResources(ShBuiltInResources resources)
 
 bool ANGLEWebKitBridge::compileShaderSource(const char* shaderSource, ANGLEShaderType shaderType, String& translatedShaderSource, String& shaderValidationLog, Vector<ANGLEShaderSymbol>& symbols, int extraCompileOptions)
 {
+    String cacheKey = shaderTranslationCacheKey(shaderSource, shaderType, m_shaderOutput, m_shaderSpec, extraCompileOptions, m_resources);
+    ShaderTranslationCache& cache = shaderTranslationCache();
+    auto cachedTranslation = cache.find(cacheKey);
+    if (cachedTranslation != cache.end()) {
+        translatedShaderSource = cachedTranslation->value.translatedShaderSource;
+        symbols.appendVector(cachedTranslation->value.symbols);
+        return true;
+    }
+    size_t firstNewSymbol = symbols.size();
+
     if (!builtCompilers) {
         m_fragmentCompiler = ShConstructCompiler(SH_FRAGMENT_SHADER, m_shaderSpec, m_shaderOutput, &m_resources);
         m_vertexCompiler = ShConstructCompiler(SH_VERTEX_SHADER, m_shaderSpec, m_shaderOutput, &m_resources);
@@ -231,6 +287,13 @@ bool ANGLEWebKitBridge::compileShaderSource(const char* shaderSource, ANGLEShade
     if (!getSymbolInfo(compiler, SH_VARYINGS, symbols))
         return false;
 
+    if (cache.size() >= maximumShaderTranslationCacheSize)
+        cache.clear();
+    ShaderTranslation translation;
+    translation.translatedShaderSource = translatedShaderSource;
+    translation.symbols.append(symbols.data() + firstNewSymbol, symbols.size() - firstNewSymbol);
+    cache.add(cacheKey, std::move(translation));
+
     return true;
 }
 
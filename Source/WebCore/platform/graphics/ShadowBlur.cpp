@@ -37,6 +37,7 @@
 #include "Timer.h"
 #include <wtf/MathExtras.h>
 #include <wtf/Noncopyable.h>
+#include <wtf/Vector.h>
 
 namespace WebCore {
 
@@ -115,6 +116,42 @@ public:
         return true;
     }
 
+    // Blurred and colored nine-piece templates for outer rect shadows drawn with tiling.
+    // Pages tend to repeat a handful of box-shadow styles, so keeping several templates
+    // avoids re-blurring when they alternate.
+    ImageBuffer* cachedShadowTemplate(const FloatSize& radius, const Color& color, ColorSpace colorSpace, const FloatRect& shadowRect, const FloatRoundedRect::Radii& radii)
+    {
+        for (size_t i = 0; i < m_shadowTemplates.size(); ++i) {
+            ShadowTemplate& shadowTemplate = m_shadowTemplates[i];
+            if (shadowTemplate.radius == radius && shadowTemplate.color == color && shadowTemplate.colorSpace == colorSpace && shadowTemplate.shadowRect == shadowRect && shadowTemplate.radii == radii) {
+                // Keep the most recently used template at the end so eviction drops the oldest one.
+                if (i != m_shadowTemplates.size() - 1) {
+                    ShadowTemplate usedTemplate = std::move(shadowTemplate);
+                    m_shadowTemplates.remove(i);
+                    m_shadowTemplates.append(std::move(usedTemplate));
+                }
+                return m_shadowTemplates.last().image.get();
+            }
+        }
+        return nullptr;
+    }
+
+    void addShadowTemplate(const FloatSize& radius, const Color& color, ColorSpace colorSpace, const FloatRect& shadowRect, const FloatRoundedRect::Radii& radii, std::unique_ptr<ImageBuffer> image)
+    {
+        const size_t maximumShadowTemplates = 8;
+        if (m_shadowTemplates.size() == maximumShadowTemplates)
+            m_shadowTemplates.remove(0);
+
+        ShadowTemplate shadowTemplate;
+        shadowTemplate.radius = radius;
+        shadowTemplate.color = color;
+        shadowTemplate.colorSpace = colorSpace;
+        shadowTemplate.shadowRect = shadowRect;
+        shadowTemplate.radii = radii;
+        shadowTemplate.image = std::move(image);
+        m_shadowTemplates.append(std::move(shadowTemplate));
+    }
+
     void scheduleScratchBufferPurge()
     {
 #if !ASSERT_DISABLED
@@ -133,6 +170,7 @@ private:
     void timerFired(Timer<ScratchBuffer>*)
     {
         clearScratchBuffer();
+        m_shadowTemplates.clear();
     }
     
     void clearScratchBuffer()
@@ -142,7 +180,17 @@ private:
         m_lastLayerSize = FloatSize();
     }
 
+    struct ShadowTemplate {
+        FloatSize radius;
+        Color color;
+        ColorSpace colorSpace;
+        FloatRect shadowRect;
+        FloatRoundedRect::Radii radii;
+        std::unique_ptr<ImageBuffer> image;
+    };
+
     std::unique_ptr<ImageBuffer> m_imageBuffer;
+    Vector<ShadowTemplate> m_shadowTemplates;
     Timer<ScratchBuffer> m_purgeTimer;
     
     FloatRect m_lastInsetBounds;
@@ -740,15 +788,17 @@ void ShadowBlur::drawInsetShadowWithTiling(GraphicsContext* graphicsContext, con
 
 void ShadowBlur::drawRectShadowWithTiling(GraphicsContext* graphicsContext, const FloatRoundedRect& shadowedRect, const IntSize& templateSize, const IntSize& edgeSize)
 {
-    m_layerImage = ScratchBuffer::shared().getScratchBuffer(templateSize);
-    if (!m_layerImage)
-        return;
-
     FloatRect templateShadow = FloatRect(edgeSize.width(), edgeSize.height(), templateSize.width() - 2 * edgeSize.width(), templateSize.height() - 2 * edgeSize.height());
 
-    // Only redraw in the scratch buffer if its cached contents don't match our needs
-    bool redrawNeeded = ScratchBuffer::shared().setCachedShadowValues(m_blurRadius, m_color, m_colorSpace, templateShadow, shadowedRect.radii(), m_layerSize);
-    if (redrawNeeded) {
+    // Only draw a new template if none of the cached ones match our needs.
+    ScratchBuffer& scratchBuffer = ScratchBuffer::shared();
+    m_layerImage = scratchBuffer.cachedShadowTemplate(m_blurRadius, m_color, m_colorSpace, templateShadow, shadowedRect.radii());
+    if (!m_layerImage) {
+        std::unique_ptr<ImageBuffer> templateImage = ImageBuffer::create(templateSize, 1);
+        if (!templateImage)
+            return;
+        m_layerImage = templateImage.get();
+
         // Draw shadow into the ImageBuffer.
         GraphicsContext* shadowContext = m_layerImage->context();
         GraphicsContextStateSaver shadowStateSaver(*shadowContext);
@@ -765,6 +815,7 @@ void ShadowBlur::drawRectShadowWithTiling(GraphicsContext* graphicsContext, cons
         }
 
         blurAndColorShadowBuffer(templateSize);
+        scratchBuffer.addShadowTemplate(m_blurRadius, m_color, m_colorSpace, templateShadow, shadowedRect.radii(), std::move(templateImage));
     }
     FloatSize offset = m_offset;
     if (shadowsIgnoreTransforms()) {
@@ -780,7 +831,7 @@ void ShadowBlur::drawRectShadowWithTiling(GraphicsContext* graphicsContext, cons
     drawLayerPieces(graphicsContext, shadowBounds, shadowedRect.radii(), edgeSize, templateSize, OuterShadow);
 
     m_layerImage = 0;
-    ScratchBuffer::shared().scheduleScratchBufferPurge();
+    scratchBuffer.scheduleScratchBufferPurge();
 }
 
 void ShadowBlur::drawLayerPieces(GraphicsContext* graphicsContext, const FloatRect& shadowBounds, const FloatRoundedRect::Radii& radii, const IntSize& bufferPadding, const IntSize& templateSize, ShadowDirection direction)
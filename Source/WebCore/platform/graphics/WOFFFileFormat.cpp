@@ -70,6 +70,9 @@ static bool writeUInt16(Vector<char>& vector, uint16_t value)
 
 static const uint32_t woffSignature = 0x774f4646; /* 'wOFF' */
 
+// Fonts rarely compress better than this; the sfnt still grows past it when one does.
+static const size_t maximumReservedExpansionRatio = 8;
+
 bool isWOFF(SharedBuffer* buffer)
 {
     size_t offset = 0;
@@ -129,6 +132,15 @@ bool convertWOFFToSfnt(SharedBuffer* woff, Vector<char>& sfnt)
     if (woff->size() - offset < numTables * 5 * sizeof(uint32_t))
         return false;
 
+    // Allocate the whole sfnt up front so appending the tables does not repeatedly reallocate and copy it.
+    // totalSfntSize is not validated until the tables have been decompressed, so don't let it make us
+    // reserve more than the WOFF could plausibly expand to.
+    size_t reservedSfntSize = totalSfntSize;
+    if (reservedSfntSize / maximumReservedExpansionRatio > woff->size())
+        reservedSfntSize = woff->size() * maximumReservedExpansionRatio;
+    if (!sfnt.tryReserveCapacity(reservedSfntSize))
+        return false;
+
     // Write the sfnt offset subtable.
     uint16_t entrySelector = 0;
     uint16_t searchRange = 1;
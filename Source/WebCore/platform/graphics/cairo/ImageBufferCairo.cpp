@@ -196,6 +196,27 @@ PassRefPtr<cairo_surface_t> copySurfaceToImageAndAdjustRect(cairo_surface_t* sur
     return adoptRef(cairo_image_surface_create(CAIRO_FORMAT_ARGB32, rect.width(), rect.height()));
 }
 
+// Reciprocals of each alpha value scaled by 2^24 and rounded up. For every 8-bit channel
+// value v, (v * 255 * reciprocal) >> 24 equals v * 255 / alpha exactly, so unpremultiplying
+// does not need three integer divisions per pixel.
+static const uint32_t* unpremultiplyReciprocals()
+{
+    static uint32_t reciprocals[256];
+    static bool initialized = false;
+    if (!initialized) {
+        reciprocals[0] = 0;
+        for (unsigned alpha = 1; alpha < 256; ++alpha)
+            reciprocals[alpha] = ((1 << 24) + alpha - 1) / alpha;
+        initialized = true;
+    }
+    return reciprocals;
+}
+
+static inline unsigned unpremultiplyChannel(unsigned value, uint32_t reciprocal)
+{
+    return (static_cast<uint64_t>(value * 255) * reciprocal) >> 24;
+}
+
 template <Multiply multiplied>
 PassRefPtr<Uint8ClampedArray> getImageData(const IntRect& rect, const ImageBufferData& data, const IntSize& size)
 {
@@ -240,6 +261,8 @@ PassRefPtr<Uint8ClampedArray> getImageData(const IntRect& rect, const ImageBuffe
     int stride = cairo_image_surface_get_stride(imageSurface.get());
     unsigned destBytesPerRow = 4 * rect.width();
 
+    const uint32_t* reciprocals = multiplied == Unmultiplied ? unpremultiplyReciprocals() : 0;
+
     unsigned char* destRows = dataDst + desty * destBytesPerRow + destx * 4;
     for (int y = 0; y < numRows; ++y) {
         unsigned* row = reinterpret_cast_ptr<unsigned*>(dataSrc + stride * (y + originy));
@@ -256,9 +279,10 @@ PassRefPtr<Uint8ClampedArray> getImageData(const IntRect& rect, const ImageBuffe
 
             if (multiplied == Unmultiplied) {
                 if (alpha && alpha != 255) {
-                    red = red * 255 / alpha;
-                    green = green * 255 / alpha;
-                    blue = blue * 255 / alpha;
+                    uint32_t reciprocal = reciprocals[alpha];
+                    red = unpremultiplyChannel(red, reciprocal);
+                    green = unpremultiplyChannel(green, reciprocal);
+                    blue = unpremultiplyChannel(blue, reciprocal);
                 }
             }
 
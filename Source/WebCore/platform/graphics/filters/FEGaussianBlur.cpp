@@ -304,8 +304,9 @@ inline void FEGaussianBlur::platformApplyGeneric(Uint8ClampedArray* srcPixelArra
 
     // The final result should be stored in srcPixelArray.
     if (dst == srcPixelArray) {
-        ASSERT(src->length() == dst->length());
-        memcpy(dst->data(), src->data(), src->length());
+        // The scratch buffer can be longer than the pixel data it holds.
+        ASSERT(src->length() >= dst->length());
+        memcpy(dst->data(), src->data(), dst->length());
     }
 
 }
@@ -453,8 +454,9 @@ void FEGaussianBlur::platformApplySoftware()
     IntSize kernelSize = calculateKernelSize(filter(), FloatPoint(m_stdX, m_stdY));
 
     IntSize paintSize = absolutePaintRect().size();
-    RefPtr<Uint8ClampedArray> tmpImageData = Uint8ClampedArray::createUninitialized(paintSize.width() * paintSize.height() * 4);
-    Uint8ClampedArray* tmpPixelArray = tmpImageData.get();
+    Uint8ClampedArray* tmpPixelArray = filter().scratchPixelArray(paintSize.width() * paintSize.height() * 4);
+    if (!tmpPixelArray)
+        return;
 
     platformApply(srcPixelArray, tmpPixelArray, kernelSize.width(), kernelSize.height(), paintSize);
 }
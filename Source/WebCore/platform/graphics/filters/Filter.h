@@ -59,8 +59,20 @@ public:
     virtual FloatRect sourceImageRect() const = 0;
     virtual FloatRect filterRegion() const = 0;
 
+    // Intermediate pixel storage shared by the effects of this filter while it is being applied,
+    // so that a chain of blurs does not allocate a new buffer for each effect. The buffer only
+    // grows, and may be longer than requested. Callers release it once the filter is applied.
+    Uint8ClampedArray* scratchPixelArray(unsigned length)
+    {
+        if (!m_scratchPixelArray || m_scratchPixelArray->length() < length)
+            m_scratchPixelArray = Uint8ClampedArray::createUninitialized(length);
+        return m_scratchPixelArray.get();
+    }
+    void releaseScratchPixelArray() { m_scratchPixelArray = nullptr; }
+
 private:
     std::unique_ptr<ImageBuffer> m_sourceImage;
+    RefPtr<Uint8ClampedArray> m_scratchPixelArray;
     FloatSize m_filterResolution;
     AffineTransform m_absoluteTransform;
     RenderingMode m_renderingMode;
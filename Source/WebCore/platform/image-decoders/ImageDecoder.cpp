@@ -305,6 +305,30 @@ void ImageDecoder::prepareScaleDataIfNecessary()
     fillScaledValues(m_scaledRows, scale, height);
 }
 
+unsigned ImageDecoder::prescaleDenominator(unsigned maximumDenominator) const
+{
+    if (!m_scaled)
+        return 1;
+
+    double inflateRate = sqrt(size().width() * static_cast<double>(size().height()) / m_maxNumPixels);
+    unsigned denominator = 1;
+    while (denominator * 2 <= maximumDenominator && denominator * 2 <= inflateRate)
+        denominator *= 2;
+    return denominator;
+}
+
+void ImageDecoder::prepareScaleDataForPrescaledSize(unsigned denominator, const IntSize& prescaledSize)
+{
+    ASSERT(m_scaled);
+    m_scaledColumns.clear();
+    m_scaledRows.clear();
+
+    double scale = sqrt(m_maxNumPixels / (size().width() * static_cast<double>(size().height()))) * denominator;
+    ASSERT(scale <= 1);
+    fillScaledValues(m_scaledColumns, scale, prescaledSize.width());
+    fillScaledValues(m_scaledRows, scale, prescaledSize.height());
+}
+
 int ImageDecoder::upperBoundScaledX(int origX, int searchStart)
 {
     return getScaledValue<UpperBound>(m_scaledColumns, origX, searchStart);
@@ -368,6 +368,10 @@ namespace WebCore {
 
     protected:
         void prepareScaleDataIfNecessary();
+        // Decoders that can shrink an image by a power of two while decoding it (e.g. with JPEG DCT
+        // scaling) use these to do most of the downsampling that way and drop rows and columns for the rest.
+        unsigned prescaleDenominator(unsigned maximumDenominator) const;
+        void prepareScaleDataForPrescaledSize(unsigned denominator, const IntSize& prescaledSize);
         int upperBoundScaledX(int origX, int searchStart = 0);
         int lowerBoundScaledX(int origX, int searchStart = 0);
         int upperBoundScaledY(int origY, int searchStart = 0);
@@ -39,6 +39,8 @@
 
 #include "config.h"
 #include "JPEGImageDecoder.h"
+
+#include "Color.h"
 #include <wtf/PassOwnPtr.h>
 
 extern "C" {
@@ -394,9 +396,21 @@ public:
             // image is a sequential JPEG.
             m_info.buffered_image = jpeg_has_multiple_scans(&m_info);
 
+#if ENABLE(IMAGE_DECODER_DOWN_SAMPLING)
+            // Let libjpeg do most of the downsampling in the DCT instead of decoding every pixel
+            // and dropping most of them.
+            m_info.scale_num = 1;
+            m_info.scale_denom = m_decoder->dctScaleDenominator();
+#endif
+
             // Used to set up image size so arrays can be allocated.
             jpeg_calc_output_dimensions(&m_info);
 
+#if ENABLE(IMAGE_DECODER_DOWN_SAMPLING)
+            if (m_info.scale_denom > 1)
+                m_decoder->setDCTScaledOutputSize(m_info.scale_denom, m_info.output_width, m_info.output_height);
+#endif
+
             // Make a one-row-high sample array that will go away when done with
             // image. Always make it big enough to hold an RGB row. Since this
             // uses the IJG memory manager, it must be allocated before the call
@@ -637,15 +651,18 @@ bool JPEGImageDecoder::setFailed()
 }
 
 template <J_COLOR_SPACE colorSpace>
-void setPixel(ImageFrame& buffer, ImageFrame::PixelData* currentAddress, JSAMPARRAY samples, int column)
-{
-    JSAMPLE* jsample = *samples + column * (colorSpace == JCS_RGB ? 3 : 4);
+inline unsigned samplesPerPixel() { return colorSpace == JCS_RGB ? 3 : 4; }
 
+// JPEG output is always opaque, so pixels are packed directly instead of going
+// through ImageFrame::setRGBA(), which has to test for premultiplication.
+template <J_COLOR_SPACE colorSpace>
+inline void setPixel(ImageFrame::PixelData* currentAddress, const JSAMPLE* jsample)
+{
     switch (colorSpace) {
     case JCS_RGB:
-        buffer.setRGBA(currentAddress, jsample[0], jsample[1], jsample[2], 0xFF);
+        *currentAddress = 0xFF000000U | jsample[0] << 16 | jsample[1] << 8 | jsample[2];
         break;
-    case JCS_CMYK:
+    case JCS_CMYK: {
         // Source is 'Inverted CMYK', output is RGB.
         // See: http://www.easyrgb.com/math.php?MATH=M12#text12
         // Or: http://www.ilkeratalay.com/colorspacesfaq.php#rgb
@@ -656,9 +673,30 @@ void setPixel(ImageFrame& buffer, ImageFrame::PixelData* currentAddress, JSAMPAR
         // From CMY (0..1) to RGB (0..1):
         // R = 1 - C => 1 - (1 - iC*iK) => iC*iK  [G and B similar]
         unsigned k = jsample[3];
-        buffer.setRGBA(currentAddress, jsample[0] * k / 255, jsample[1] * k / 255, jsample[2] * k / 255, 0xFF);
+        unsigned r = fastDivideBy255(jsample[0] * k);
+        unsigned g = fastDivideBy255(jsample[1] * k);
+        unsigned b = fastDivideBy255(jsample[2] * k);
+        *currentAddress = 0xFF000000U | r << 16 | g << 8 | b;
         break;
     }
+    }
+}
+
+// Converts one decoded scanline into the frame buffer. The unscaled case walks
+// the sample row linearly so the loop body is free of column lookups.
+template <J_COLOR_SPACE colorSpace, bool isScaled>
+void JPEGImageDecoder::outputRow(ImageFrame::PixelData* currentAddress, const JSAMPLE* row, int width)
+{
+    const unsigned channels = samplesPerPixel<colorSpace>();
+    if (isScaled) {
+        for (int x = 0; x < width; ++x)
+            setPixel<colorSpace>(currentAddress++, row + m_scaledColumns[x] * channels);
+        return;
+    }
+
+    ImageFrame::PixelData* end = currentAddress + width;
+    for (; currentAddress < end; row += channels)
+        setPixel<colorSpace>(currentAddress++, row);
 }
 
 template <J_COLOR_SPACE colorSpace, bool isScaled>
@@ -685,11 +723,7 @@ bool JPEGImageDecoder::outputScanlines(ImageFrame& buffer)
             qcms_transform_data(m_reader->colorTransform(), *samples, *samples, info->output_width);
 #endif
 
-        ImageFrame::PixelData* currentAddress = buffer.getAddr(0, destY);
-        for (int x = 0; x < width; ++x) {
-            setPixel<colorSpace>(buffer, currentAddress, samples, isScaled ? m_scaledColumns[x] : x);
-            ++currentAddress;
-        }
+        outputRow<colorSpace, isScaled>(buffer.getAddr(0, destY), *samples, width);
     }
     return true;
 }
@@ -738,7 +772,7 @@ bool JPEGImageDecoder::outputScanlines()
 #endif
 
     switch (info->out_color_space) {
-    // The code inside outputScanlines<int, bool> will be executed
+    // The code inside outputRow<int, bool> will be executed
     // for each pixel, so we want to avoid any extra comparisons there.
     // That is why we use template and template specializations here so
     // the proper code will be generated at compile time.
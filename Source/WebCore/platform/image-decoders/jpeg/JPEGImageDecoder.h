@@ -70,6 +70,12 @@ namespace WebCore {
             return m_scaled;
         }
 
+#if ENABLE(IMAGE_DECODER_DOWN_SAMPLING)
+        // libjpeg can scale the output by 1/2, 1/4 or 1/8 in the DCT.
+        unsigned dctScaleDenominator() const { return prescaleDenominator(8); }
+        void setDCTScaledOutputSize(unsigned denominator, unsigned width, unsigned height) { prepareScaleDataForPrescaledSize(denominator, IntSize(width, height)); }
+#endif
+
         bool outputScanlines();
         void jpegComplete();
 
@@ -88,6 +94,9 @@ namespace WebCore {
         template <J_COLOR_SPACE colorSpace, bool isScaled>
         bool outputScanlines(ImageFrame& buffer);
 
+        template <J_COLOR_SPACE colorSpace, bool isScaled>
+        void outputRow(ImageFrame::PixelData* currentAddress, const JSAMPLE* row, int width);
+
         OwnPtr<JPEGImageReader> m_reader;
     };
 
@@ -839,8 +839,9 @@ void ResourceHandleManager::setupPOST(ResourceHandle* job, struct curl_slist** h
     if (!numElements)
         return;
 
-    // Do not stream for simple POST data
-    if (numElements == 1) {
+    // Do not stream for simple POST data. A lone file still has to be streamed, since
+    // flatten() only copies the data elements.
+    if (numElements == 1 && job->firstRequest().httpBody()->elements()[0].m_type == FormDataElement::data) {
         job->firstRequest().httpBody()->flatten(d->m_postBytes);
         if (d->m_postBytes.size()) {
             curl_easy_setopt(d->m_handle, CURLOPT_POSTFIELDSIZE, d->m_postBytes.size());
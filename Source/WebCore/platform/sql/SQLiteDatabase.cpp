@@ -57,6 +57,7 @@ SQLiteDatabase::SQLiteDatabase()
     , m_sharable(false)
     , m_openingThread(0)
     , m_interrupted(false)
+    , m_isUsingWAL(false)
     , m_openError(SQLITE_ERROR)
     , m_openErrorMessage()
     , m_lastChangesCount(0)
@@ -104,13 +105,12 @@ bool SQLiteDatabase::open(const String& filename, bool forWebSQLDatabase)
     if (result != SQLITE_OK && result != SQLITE_ROW)
         LOG_ERROR("SQLite database failed to set journal_mode to WAL, error: %s",  lastErrorMsg());
 
-#ifndef NDEBUG
     if (result == SQLITE_ROW) {
         String mode = walStatement.getColumnText(0);
-        if (!equalIgnoringCase(mode, "wal"))
+        m_isUsingWAL = equalIgnoringCase(mode, "wal");
+        if (!m_isUsingWAL)
             LOG_ERROR("journal_mode of database should be 'wal', but is '%s'", mode.utf8().data());
     }
-#endif
 
     return isOpen();
 }
@@ -129,6 +129,7 @@ void SQLiteDatabase::close()
     }
 
     m_openingThread = 0;
+    m_isUsingWAL = false;
     m_openError = SQLITE_ERROR;
     m_openErrorMessage = CString();
 }
@@ -251,6 +252,12 @@ void SQLiteDatabase::setSynchronous(SynchronousPragma sync)
     executeCommand("PRAGMA synchronous = " + String::number(sync));
 }
 
+void SQLiteDatabase::setSynchronousNormalIfUsingWAL()
+{
+    if (m_isUsingWAL)
+        setSynchronous(SyncNormal);
+}
+
 void SQLiteDatabase::setBusyTimeout(int ms)
 {
     if (m_db)
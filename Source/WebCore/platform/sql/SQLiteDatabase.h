@@ -103,6 +103,11 @@ public:
     // OFF - Calls return immediately after the data has been passed to disk
     enum SynchronousPragma { SyncOff = 0, SyncNormal = 1, SyncFull = 2 };
     void setSynchronous(SynchronousPragma);
+
+    // With a WAL journal, NORMAL only syncs at checkpoints instead of on every commit, and the database
+    // still survives a power loss intact, minus the most recent transactions. Databases that can afford to
+    // lose those writes can opt in; this does nothing if WAL could not be enabled when opening.
+    void setSynchronousNormalIfUsingWAL();
     
     int lastError();
     const char* lastErrorMsg();
@@ -164,6 +169,8 @@ private:
     Mutex m_databaseClosingMutex;
     bool m_interrupted;
 
+    bool m_isUsingWAL;
+
     int m_openError;
     CString m_openErrorMessage;
 
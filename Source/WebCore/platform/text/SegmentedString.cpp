@@ -125,11 +125,31 @@ void SegmentedString::append(const SegmentedSubstring& s)
         m_numberOfCharactersConsumedPriorToCurrentString += m_currentString.numberOfCharactersConsumed();
         m_currentString = s;
         updateAdvanceFunctionPointers();
+    } else if (!m_substrings.isEmpty() && canCoalesce(m_substrings.last(), s)) {
+        // Pages that document.write() one tag at a time would otherwise leave
+        // us with a long chain of tiny substrings to walk through one by one.
+        StringBuilder builder;
+        m_substrings.last().appendTo(builder);
+        s.appendTo(builder);
+        SegmentedSubstring coalesced(builder.toString());
+        if (s.excludeLineNumbers())
+            coalesced.setExcludeLineNumbers();
+        m_substrings.last() = coalesced;
     } else
         m_substrings.append(s);
     m_empty = false;
 }
 
+bool SegmentedString::canCoalesce(const SegmentedSubstring& last, const SegmentedSubstring& s)
+{
+    const int maximumCoalescedSubstringLength = 256;
+    return last.m_length < maximumCoalescedSubstringLength
+        && s.m_length < maximumCoalescedSubstringLength
+        && !last.numberOfCharactersConsumed()
+        && !s.numberOfCharactersConsumed()
+        && last.doNotExcludeLineNumbers() == s.doNotExcludeLineNumbers();
+}
+
 void SegmentedString::prepend(const SegmentedSubstring& s)
 {
     ASSERT(!escaped());
@@ -323,6 +323,7 @@ private:
 
     void append(const SegmentedSubstring&);
     void prepend(const SegmentedSubstring&);
+    static bool canCoalesce(const SegmentedSubstring& last, const SegmentedSubstring&);
 
     void advance8();
     void advance16();
@@ -348,6 +348,7 @@ void FilterEffectRenderer::apply()
     RefPtr<FilterEffect> effect = lastEffect();
     effect->apply();
     effect->transformResultColorSpace(ColorSpaceDeviceRGB);
+    releaseScratchPixelArray();
 }
 
 LayoutRect FilterEffectRenderer::computeSourceImageRectForDirtyRect(const LayoutRect& filterBoxRect, const LayoutRect& dirtyRect)
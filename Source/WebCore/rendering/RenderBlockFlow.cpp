@@ -2263,6 +2263,12 @@ bool RenderBlockFlow::positionNewFloats()
     if (lastPlacedFloatingObject)
         logicalTop = std::max(logicalTopForFloat(lastPlacedFloatingObject), logicalTop);
 
+    // Clearing floats need the lowest placed float bottoms. Compute them once and keep them up to
+    // date as we go, rather than walking the whole float list for every clearing float.
+    bool hasLowestFloatLogicalBottoms = false;
+    LayoutUnit lowestLeftFloatLogicalBottom;
+    LayoutUnit lowestRightFloatLogicalBottom;
+
     auto end = floatingObjectSet.end();
     // Now walk through the set of unpositioned floats and place them.
     for (; it != end; ++it) {
@@ -2278,10 +2284,15 @@ bool RenderBlockFlow::positionNewFloats()
 
         LayoutRect oldRect = childBox.frameRect();
 
+        if (childBox.style().clear() != CNONE && !hasLowestFloatLogicalBottoms) {
+            lowestLeftFloatLogicalBottom = lowestFloatLogicalBottom(FloatingObject::FloatLeft);
+            lowestRightFloatLogicalBottom = lowestFloatLogicalBottom(FloatingObject::FloatRight);
+            hasLowestFloatLogicalBottoms = true;
+        }
         if (childBox.style().clear() & CLEFT)
-            logicalTop = std::max(lowestFloatLogicalBottom(FloatingObject::FloatLeft), logicalTop);
+            logicalTop = std::max(lowestLeftFloatLogicalBottom, logicalTop);
         if (childBox.style().clear() & CRIGHT)
-            logicalTop = std::max(lowestFloatLogicalBottom(FloatingObject::FloatRight), logicalTop);
+            logicalTop = std::max(lowestRightFloatLogicalBottom, logicalTop);
 
         LayoutPoint floatLogicalLocation = computeLogicalLocationForFloat(floatingObject, logicalTop);
 
@@ -2339,6 +2350,13 @@ bool RenderBlockFlow::positionNewFloats()
 
         m_floatingObjects->addPlacedObject(floatingObject);
 
+        if (hasLowestFloatLogicalBottoms) {
+            if (floatingObject->type() == FloatingObject::FloatLeft)
+                lowestLeftFloatLogicalBottom = std::max(lowestLeftFloatLogicalBottom, logicalBottomForFloat(floatingObject));
+            else
+                lowestRightFloatLogicalBottom = std::max(lowestRightFloatLogicalBottom, logicalBottomForFloat(floatingObject));
+        }
+
 #if ENABLE(CSS_SHAPES)
         if (ShapeOutsideInfo* shapeOutside = childBox.shapeOutsideInfo())
             shapeOutside->setReferenceBoxLogicalSize(logicalSizeForChild(childBox));
@@ -78,6 +78,11 @@ static OverrideSizeMap* gOverrideWidthMap = 0;
 static OverrideSizeMap* gOverrideContainingBlockLogicalHeightMap = 0;
 static OverrideSizeMap* gOverrideContainingBlockLogicalWidthMap = 0;
 
+// Used by boxes with a native appearance whose control needs to repaint after painting, for example to animate.
+// Kept out of line since very few boxes ever need one.
+typedef WTF::HashMap<const RenderBox*, std::unique_ptr<Timer<RenderBox>>> ControlRepaintTimerMap;
+static ControlRepaintTimerMap* gControlRepaintTimerMap = 0;
+
 
 // Size of border belt for autoscroll. When mouse pointer in border belt,
 // autoscroll is started.
@@ -102,7 +107,6 @@ RenderBox::RenderBox(Element& element, PassRef<RenderStyle> style, unsigned base
     , m_minPreferredLogicalWidth(-1)
     , m_maxPreferredLogicalWidth(-1)
     , m_inlineBoxWrapper(0)
-    , m_repaintTimer(this, &RenderBox::repaintTimerFired)
 {
     setIsBox();
 }
@@ -112,14 +116,14 @@ RenderBox::RenderBox(Document& document, PassRef<RenderStyle> style, unsigned ba
     , m_minPreferredLogicalWidth(-1)
     , m_maxPreferredLogicalWidth(-1)
     , m_inlineBoxWrapper(0)
-    , m_repaintTimer(this, &RenderBox::repaintTimerFired)
 {
     setIsBox();
 }
 
 RenderBox::~RenderBox()
 {
-    m_repaintTimer.stop();
+    if (gControlRepaintTimerMap)
+        gControlRepaintTimerMap->remove(this);
     if (hasControlStatesForRenderer(this))
         removeControlStatesForRenderer(this);
 }
@@ -1230,7 +1234,7 @@ void RenderBox::paintBoxDecorations(PaintInfo& paintInfo, const LayoutPoint& pai
     bool themePainted = style().hasAppearance() && !theme().paint(this, controlStates, paintInfo, snappedPaintRect);
 
     if (controlStates && controlStates->needsRepaint())
-        m_repaintTimer.startOneShot(0);
+        startControlRepaintTimer();
 
     if (!themePainted) {
         if (bleedAvoidance == BackgroundBleedBackgroundOverBorder)
@@ -4748,6 +4752,16 @@ LayoutUnit RenderBox::offsetFromLogicalTopOfFirstPage() const
     return containerBlock->offsetFromLogicalTopOfFirstPage() + logicalTop();
 }
 
+void RenderBox::startControlRepaintTimer()
+{
+    if (!gControlRepaintTimerMap)
+        gControlRepaintTimerMap = new ControlRepaintTimerMap;
+    std::unique_ptr<Timer<RenderBox>>& timer = gControlRepaintTimerMap->add(this, nullptr).iterator->value;
+    if (!timer)
+        timer = std::make_unique<Timer<RenderBox>>(this, &RenderBox::repaintTimerFired);
+    timer->startOneShot(0);
+}
+
 void RenderBox::repaintTimerFired(Timer<RenderBox>&)
 {
     if (!document().inPageCache())
@@ -720,12 +720,11 @@ protected:
     RefPtr<RenderOverflow> m_overflow;
 
 private:
+    void startControlRepaintTimer();
     void repaintTimerFired(Timer<RenderBox>&);
 
     // Used to store state between styleWillChange and styleDidChange
     static bool s_hadOverflowClip;
-
-    Timer<RenderBox> m_repaintTimer;
 };
 
 RENDER_OBJECT_TYPE_CASTS(RenderBox, isBox())
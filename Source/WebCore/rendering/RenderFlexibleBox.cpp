@@ -235,6 +235,13 @@ static EAlignItems resolveAlignment(const RenderStyle* parentStyle, const Render
     return align;
 }
 
+void RenderFlexibleBox::removeChild(RenderObject& oldChild)
+{
+    if (oldChild.isBox())
+        m_intrinsicSizeAlongMainAxis.remove(toRenderBox(&oldChild));
+    RenderBlock::removeChild(oldChild);
+}
+
 void RenderFlexibleBox::styleDidChange(StyleDifference diff, const RenderStyle* oldStyle)
 {
     RenderBlock::styleDidChange(diff, oldStyle);
@@ -269,6 +276,9 @@ void RenderFlexibleBox::layoutBlock(bool relayoutChildren, LayoutUnit)
 
     preparePaginationBeforeBlockLayout(relayoutChildren);
 
+    if (relayoutChildren)
+        m_intrinsicSizeAlongMainAxis.clear();
+
     m_numberOfInFlowChildrenOnFirstLine = -1;
 
     RenderBlock::startDelayUpdateScrollInfo();
@@ -671,12 +681,19 @@ LayoutUnit RenderFlexibleBox::preferredMainAxisContentExtentForChild(RenderBox&
 
     Length flexBasis = flexBasisForChild(child);
     if (flexBasis.isAuto() || (flexBasis.isFixed() && !flexBasis.value() && hasInfiniteLineLength)) {
+        LayoutUnit mainAxisExtent;
         if (hasOrthogonalFlow(child)) {
-            if (hasOverrideSize)
-                child.setChildNeedsLayout(MarkOnlyThis);
-            child.layoutIfNeeded();
-        }
-        LayoutUnit mainAxisExtent = hasOrthogonalFlow(child) ? child.logicalHeight() : child.maxPreferredLogicalWidth();
+            auto it = m_intrinsicSizeAlongMainAxis.find(&child);
+            if (child.needsLayout() || it == m_intrinsicSizeAlongMainAxis.end()) {
+                if (hasOverrideSize)
+                    child.setChildNeedsLayout(MarkOnlyThis);
+                child.layoutIfNeeded();
+                m_intrinsicSizeAlongMainAxis.set(&child, child.logicalHeight());
+                mainAxisExtent = child.logicalHeight();
+            } else
+                mainAxisExtent = it->value;
+        } else
+            mainAxisExtent = child.maxPreferredLogicalWidth();
         ASSERT(mainAxisExtent - mainAxisBorderAndPaddingExtentForChild(child) >= 0);
         return mainAxisExtent - mainAxisBorderAndPaddingExtentForChild(child);
     }
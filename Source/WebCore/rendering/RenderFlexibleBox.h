@@ -48,6 +48,7 @@ public:
     virtual bool avoidsFloats() const override final { return true; }
     virtual bool canCollapseAnonymousBlockChild() const override final { return false; }
     virtual void layoutBlock(bool relayoutChildren, LayoutUnit pageLogicalHeight = 0) override final;
+    virtual void removeChild(RenderObject&) override;
 
     virtual int baselinePosition(FontBaseline, bool firstLine, LineDirectionMode, LinePositionMode = PositionOnContainingLine) const override;
     virtual int firstLineBaseline() const override;
@@ -159,6 +160,10 @@ private:
 
     mutable OrderIterator m_orderIterator;
     int m_numberOfInFlowChildrenOnFirstLine;
+
+    // Main axis sizes of orthogonal flow children laid out without an override size. They stay valid
+    // until the child or the flexbox needs to relayout it, so we don't lay out clean children twice.
+    HashMap<const RenderBox*, LayoutUnit> m_intrinsicSizeAlongMainAxis;
 };
 
 RENDER_OBJECT_TYPE_CASTS(RenderFlexibleBox, isFlexibleBox())
@@ -749,11 +749,14 @@ void RenderGrid::placeSpecifiedMajorAxisItemsOnGrid(const Vector<RenderBox*>& au
 
 void RenderGrid::placeAutoMajorAxisItemsOnGrid(const Vector<RenderBox*>& autoGridItems)
 {
+    // Placing items only ever fills cells, so a major axis line found to be full stays full and
+    // doesn't need to be scanned again by the following items.
+    size_t firstNonFullMajorAxisIndex = 0;
     for (auto& autoGridItem : autoGridItems)
-        placeAutoMajorAxisItemOnGrid(autoGridItem);
+        placeAutoMajorAxisItemOnGrid(autoGridItem, firstNonFullMajorAxisIndex);
 }
 
-void RenderGrid::placeAutoMajorAxisItemOnGrid(RenderBox* gridItem)
+void RenderGrid::placeAutoMajorAxisItemOnGrid(RenderBox* gridItem, size_t& firstNonFullMajorAxisIndex)
 {
     std::unique_ptr<GridSpan> minorAxisPositions = resolveGridPositionsFromStyle(gridItem, autoPlacementMinorAxisDirection());
     ASSERT(!resolveGridPositionsFromStyle(gridItem, autoPlacementMajorAxisDirection()));
@@ -767,8 +770,8 @@ void RenderGrid::placeAutoMajorAxisItemOnGrid(RenderBox* gridItem)
         }
     } else {
         const size_t endOfMajorAxis = (autoPlacementMajorAxisDirection() == ForColumns) ? gridColumnCount() : gridRowCount();
-        for (size_t majorAxisIndex = 0; majorAxisIndex < endOfMajorAxis; ++majorAxisIndex) {
-            GridIterator iterator(m_grid, autoPlacementMajorAxisDirection(), majorAxisIndex);
+        for (; firstNonFullMajorAxisIndex < endOfMajorAxis; ++firstNonFullMajorAxisIndex) {
+            GridIterator iterator(m_grid, autoPlacementMajorAxisDirection(), firstNonFullMajorAxisIndex);
             if (std::unique_ptr<GridCoordinate> emptyGridArea = iterator.nextEmptyGridArea()) {
                 insertItemIntoGrid(gridItem, emptyGridArea->rows.initialPositionIndex, emptyGridArea->columns.initialPositionIndex);
                 return;
@@ -82,7 +82,7 @@ private:
     void populateExplicitGridAndOrderIterator();
     void placeSpecifiedMajorAxisItemsOnGrid(const Vector<RenderBox*>&);
     void placeAutoMajorAxisItemsOnGrid(const Vector<RenderBox*>&);
-    void placeAutoMajorAxisItemOnGrid(RenderBox*);
+    void placeAutoMajorAxisItemOnGrid(RenderBox*, size_t& firstNonFullMajorAxisIndex);
     GridTrackSizingDirection autoPlacementMajorAxisDirection() const;
     GridTrackSizingDirection autoPlacementMinorAxisDirection() const;
 
@@ -127,9 +127,14 @@ public:
         return false;
     }
 
-    void unite(const OverlapMapContainer& otherContainer)
+    void unite(OverlapMapContainer&& otherContainer)
     {
-        m_layerRects.appendVector(otherContainer.m_layerRects);
+        // The parent container is frequently still empty when a child is popped,
+        // in which case the child's rects can be adopted without copying them.
+        if (m_layerRects.isEmpty())
+            m_layerRects.swap(otherContainer.m_layerRects);
+        else
+            m_layerRects.appendVector(otherContainer.m_layerRects);
         m_boundingBox.unite(otherContainer.m_boundingBox);
     }
 private:
@@ -181,42 +186,13 @@ public:
 
     void popCompositingContainer()
     {
-        m_overlapStack[m_overlapStack.size() - 2].unite(m_overlapStack.last());
+        m_overlapStack[m_overlapStack.size() - 2].unite(std::move(m_overlapStack.last()));
         m_overlapStack.removeLast();
     }
 
     RenderGeometryMap& geometryMap() { return m_geometryMap; }
 
 private:
-    struct RectList {
-        Vector<IntRect> rects;
-        IntRect boundingRect;
-        
-        void append(const IntRect& rect)
-        {
-            rects.append(rect);
-            boundingRect.unite(rect);
-        }
-
-        void append(const RectList& rectList)
-        {
-            rects.appendVector(rectList.rects);
-            boundingRect.unite(rectList.boundingRect);
-        }
-        
-        bool intersects(const IntRect& rect) const
-        {
-            if (!rects.size() || !boundingRect.intersects(rect))
-                return false;
-
-            for (unsigned i = 0; i < rects.size(); i++) {
-                if (rects[i].intersects(rect))
-                    return true;
-            }
-            return false;
-        }
-    };
-
     Vector<OverlapMapContainer> m_overlapStack;
     HashSet<const RenderLayer*> m_layers;
     RenderGeometryMap m_geometryMap;
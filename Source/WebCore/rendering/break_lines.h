@@ -79,6 +79,16 @@ inline bool needsLineBreakIterator(UChar ch)
     return ch > asciiLineBreakTableLastChar && ch != noBreakSpace;
 }
 
+// Latin-1 letters other than the multiplication and division signs have the Unicode line breaking class AL.
+// Like ASCII letters and digits, two of them in a row never form a break opportunity, so there is no need
+// to consult (and possibly instantiate) the ICU break iterator for such pairs.
+inline bool isAlphanumericOrLatin1Letter(UChar ch)
+{
+    if (ch <= asciiLineBreakTableLastChar)
+        return isASCIIAlphanumeric(ch);
+    return ch >= 0xC0 && ch <= 0xFF && ch != 0xD7 && ch != 0xF7;
+}
+
 template<typename CharacterType, bool treatNoBreakSpaceAsBreak>
 inline int nextBreakablePosition(LazyLineBreakIterator& lazyBreakIterator, const CharacterType* str, unsigned length, int pos)
 {
@@ -94,7 +104,8 @@ inline int nextBreakablePosition(LazyLineBreakIterator& lazyBreakIterator, const
         if (isBreakableSpace<treatNoBreakSpaceAsBreak>(ch) || shouldBreakAfter(lastLastCh, lastCh, ch))
             return i;
 
-        if (needsLineBreakIterator<treatNoBreakSpaceAsBreak>(ch) || needsLineBreakIterator<treatNoBreakSpaceAsBreak>(lastCh)) {
+        if ((needsLineBreakIterator<treatNoBreakSpaceAsBreak>(ch) || needsLineBreakIterator<treatNoBreakSpaceAsBreak>(lastCh))
+            && !(isAlphanumericOrLatin1Letter(lastCh) && isAlphanumericOrLatin1Letter(ch))) {
             if (nextBreak < i) {
                 // Don't break if positioned at start of primary context and there is no prior context.
                 if (i || priorContextLength) {
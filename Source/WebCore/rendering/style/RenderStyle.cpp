@@ -198,6 +198,15 @@ void RenderStyle::copyNonInheritedFrom(const RenderStyle* other)
     ASSERT(zoom() == initialZoom());
 }
 
+void RenderStyle::shareBoxDataWithCacheEntry(RefPtr<StyleBoxData>& cacheEntry)
+{
+    if (cacheEntry && *cacheEntry == *m_box) {
+        m_box = DataRef<StyleBoxData>(*cacheEntry);
+        return;
+    }
+    cacheEntry = const_cast<StyleBoxData*>(m_box.get());
+}
+
 bool RenderStyle::operator==(const RenderStyle& o) const
 {
     // compare everything except the pseudoStyle pointer
@@ -493,6 +493,10 @@ public:
     void inheritFrom(const RenderStyle* inheritParent, IsAtShadowBoundary = NotAtShadowBoundary);
     void copyNonInheritedFrom(const RenderStyle*);
 
+    // Shares the box data of the given cache entry if it is equal to ours; otherwise ours replaces it.
+    void shareBoxDataWithCacheEntry(RefPtr<StyleBoxData>& cacheEntry);
+    unsigned boxDataHash() const { return m_box->hash(); }
+
     PseudoId styleType() const { return noninherited_flags.styleType(); }
     void setStyleType(PseudoId styleType) { noninherited_flags.setStyleType(styleType); }
 
@@ -24,6 +24,7 @@
 
 #include "RenderStyle.h"
 #include "RenderStyleConstants.h"
+#include <wtf/HashFunctions.h>
 
 namespace WebCore {
 
@@ -90,4 +91,26 @@ bool StyleBoxData::operator==(const StyleBoxData& o) const
             ;
 }
 
+static inline unsigned hashLength(unsigned hash, const Length& length)
+{
+    hash = pairIntHash(hash, length.type());
+    // Undefined lengths have no value and calculated lengths compare by their expression,
+    // so only their type takes part in the hash.
+    if (!length.isUndefined() && !length.isCalculated())
+        hash = pairIntHash(hash, FloatHash<float>::hash(length.value()));
+    return hash;
+}
+
+unsigned StyleBoxData::hash() const
+{
+    unsigned hash = hashLength(m_zIndex, m_width);
+    hash = hashLength(hash, m_height);
+    hash = hashLength(hash, m_minWidth);
+    hash = hashLength(hash, m_maxWidth);
+    hash = hashLength(hash, m_minHeight);
+    hash = hashLength(hash, m_maxHeight);
+    hash = hashLength(hash, m_verticalAlign);
+    return pairIntHash(hash, m_hasAutoZIndex | m_boxSizing << 1);
+}
+
 } // namespace WebCore
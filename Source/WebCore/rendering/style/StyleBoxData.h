@@ -43,6 +43,9 @@ public:
         return !(*this == o);
     }
 
+    // Equal box data hashes equally, so the hash can be used to look for a shareable copy.
+    unsigned hash() const;
+
     const Length& width() const { return m_width; }
     const Length& height() const { return m_height; }
     
@@ -278,6 +278,7 @@ void RenderSVGResourceFilter::postApplyResource(RenderElement& renderer, Graphic
             lastEffect->applyAll();
             lastEffect->correctFilterResultIfNeeded();
             lastEffect->transformResultColorSpace(ColorSpaceDeviceRGB);
+            filterData->filter->releaseScratchPixelArray();
         }
         filterData->state = FilterData::Built;
 
@@ -258,6 +258,8 @@ void StorageAreaSync::openDatabase(OpenDatabaseParamType openingStrategy)
         return;
     }
 
+    m_database.setSynchronousNormalIfUsingWAL();
+
     migrateItemTableIfNeeded();
 
     if (!m_database.executeCommand("CREATE TABLE IF NOT EXISTS ItemTable (key TEXT UNIQUE ON CONFLICT REPLACE, value BLOB NOT NULL ON CONFLICT FAIL)")) {
@@ -345,7 +347,7 @@ void StorageAreaSync::performImport()
         return;
     }
 
-    m_storageArea->importItems(itemMap);
+    m_storageArea->importItems(std::move(itemMap));
 
     markImported();
 }
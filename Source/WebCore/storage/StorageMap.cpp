@@ -182,8 +182,21 @@ bool StorageMap::contains(const String& key) const
     return m_map.contains(key);
 }
 
-void StorageMap::importItems(const HashMap<String, String>& items)
+void StorageMap::importItems(HashMap<String, String>&& items)
 {
+    if (m_map.isEmpty()) {
+        // Importing into an empty map is the common case; adopt the table instead of rehashing every item into a new one.
+        for (HashMap<String, String>::const_iterator it = items.begin(), end = items.end(); it != end; ++it) {
+            ASSERT(m_currentLength + it->key.length() >= m_currentLength);
+            m_currentLength += it->key.length();
+            ASSERT(m_currentLength + it->value.length() >= m_currentLength);
+            m_currentLength += it->value.length();
+        }
+        m_map.swap(items);
+        invalidateIterator();
+        return;
+    }
+
     for (HashMap<String, String>::const_iterator it = items.begin(), end = items.end(); it != end; ++it) {
         const String& key = it->key;
         const String& value = it->value;
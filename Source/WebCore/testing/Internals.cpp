@@ -1545,6 +1545,39 @@ unsigned Internals::numberOfScrollableAreas(ExceptionCode&)
 
     return count;
 }
+
+unsigned Internals::layoutCount(ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document || !document->view()) {
+        ec = INVALID_ACCESS_ERR;
+        return 0;
+    }
+
+    return document->view()->layoutCount();
+}
+
+unsigned Internals::forcedLayoutCount(ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return 0;
+    }
+
+    return document->forcedLayoutCount();
+}
+
+unsigned Internals::styleRecalcCount(ExceptionCode& ec)
+{
+    Document* document = contextDocument();
+    if (!document) {
+        ec = INVALID_ACCESS_ERR;
+        return 0;
+    }
+
+    return document->styleRecalcCount();
+}
     
 bool Internals::isPageBoxVisible(int pageNumber, ExceptionCode& ec)
 {
@@ -187,6 +187,10 @@ public:
 
     unsigned numberOfScrollableAreas(ExceptionCode&);
 
+    unsigned layoutCount(ExceptionCode&);
+    unsigned forcedLayoutCount(ExceptionCode&);
+    unsigned styleRecalcCount(ExceptionCode&);
+
     bool isPageBoxVisible(int pageNumber, ExceptionCode&);
 
     static const char* internalsId;
@@ -319,11 +319,17 @@ ArrayBuffer* XMLHttpRequest::responseArrayBuffer()
     ASSERT(doneWithoutErrors());
 
     if (!m_responseArrayBuffer) {
-        if (m_binaryResponseBuilder)
+        if (m_binaryResponseArrayBuffer) {
+            if (m_receivedLength == m_binaryResponseArrayBuffer->byteLength())
+                m_responseArrayBuffer = m_binaryResponseArrayBuffer.release();
+            else
+                m_responseArrayBuffer = m_binaryResponseArrayBuffer->slice(0, static_cast<int>(m_receivedLength));
+        } else if (m_binaryResponseBuilder)
             m_responseArrayBuffer = m_binaryResponseBuilder->createArrayBuffer();
         else
             m_responseArrayBuffer = ArrayBuffer::create(nullptr, 0);
         m_binaryResponseBuilder.clear();
+        m_binaryResponseArrayBuffer.clear();
     }
 
     return m_responseArrayBuffer.get();
@@ -891,6 +897,7 @@ void XMLHttpRequest::clearResponseBuffers()
     m_responseDocument = 0;
     m_responseBlob = 0;
     m_binaryResponseBuilder.clear();
+    m_binaryResponseArrayBuffer.clear();
     m_responseArrayBuffer.clear();
     m_responseCacheIsValid = false;
 }
@@ -1169,6 +1176,36 @@ void XMLHttpRequest::didReceiveResponse(unsigned long identifier, const Resource
         m_responseEncoding = response.textEncodingName();
 }
 
+void XMLHttpRequest::appendBinaryResponseData(const char* data, unsigned length)
+{
+    // When the length of an arraybuffer response is known, write it straight into the
+    // ArrayBuffer that response will return, instead of buffering it and copying it at the end.
+    if (m_responseTypeCode == ResponseTypeArrayBuffer && !m_binaryResponseBuilder) {
+        if (!m_binaryResponseArrayBuffer && !m_receivedLength) {
+            long long expectedLength = m_response.expectedContentLength();
+            // With a Content-Encoding, the expected length is that of the encoded body.
+            if (expectedLength > 0 && expectedLength <= std::numeric_limits<int>::max() && m_response.httpHeaderField("Content-Encoding").isEmpty())
+                m_binaryResponseArrayBuffer = ArrayBuffer::createUninitialized(static_cast<unsigned>(expectedLength), 1);
+        }
+
+        if (m_binaryResponseArrayBuffer) {
+            unsigned receivedLength = static_cast<unsigned>(m_receivedLength);
+            if (length <= m_binaryResponseArrayBuffer->byteLength() - receivedLength) {
+                memcpy(static_cast<char*>(m_binaryResponseArrayBuffer->data()) + receivedLength, data, length);
+                return;
+            }
+
+            // The server sent more than it announced, so fall back to buffering.
+            m_binaryResponseBuilder = SharedBuffer::create(static_cast<const char*>(m_binaryResponseArrayBuffer->data()), receivedLength);
+            m_binaryResponseArrayBuffer.clear();
+        }
+    }
+
+    if (!m_binaryResponseBuilder)
+        m_binaryResponseBuilder = SharedBuffer::create();
+    m_binaryResponseBuilder->append(data, length);
+}
+
 void XMLHttpRequest::didReceiveData(const char* data, int len)
 {
     if (m_error)
@@ -1201,12 +1238,8 @@ void XMLHttpRequest::didReceiveData(const char* data, int len)
 
     if (useDecoder)
         m_responseBuilder.append(m_decoder->decode(data, len));
-    else if (m_responseTypeCode == ResponseTypeArrayBuffer || m_responseTypeCode == ResponseTypeBlob) {
-        // Buffer binary data.
-        if (!m_binaryResponseBuilder)
-            m_binaryResponseBuilder = SharedBuffer::create();
-        m_binaryResponseBuilder->append(data, len);
-    }
+    else if (m_responseTypeCode == ResponseTypeArrayBuffer || m_responseTypeCode == ResponseTypeBlob)
+        appendBinaryResponseData(data, len);
 
     if (!m_error) {
         m_receivedLength += len;
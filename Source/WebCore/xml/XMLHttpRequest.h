@@ -185,6 +185,7 @@ private:
     virtual void didFailRedirectCheck() override;
 
     bool responseIsXML() const;
+    void appendBinaryResponseData(const char*, unsigned length);
 
     bool initSend(ExceptionCode&);
     void sendBytesData(const void*, size_t, ExceptionCode&);
@@ -237,6 +238,7 @@ private:
     RefPtr<Document> m_responseDocument;
     
     RefPtr<SharedBuffer> m_binaryResponseBuilder;
+    RefPtr<JSC::ArrayBuffer> m_binaryResponseArrayBuffer;
     RefPtr<JSC::ArrayBuffer> m_responseArrayBuffer;
 
     bool m_error;
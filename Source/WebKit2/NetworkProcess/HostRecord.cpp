@@ -111,6 +111,30 @@ void HostRecord::removeLoader(NetworkResourceLoader* loader)
     }
 }
 
+bool HostRecord::rescheduleResourceLoader(NetworkResourceLoader* loader, ResourceLoadPriority newPriority)
+{
+    ASSERT(RunLoop::isMain());
+    ASSERT(newPriority >= ResourceLoadPriorityLowest && newPriority <= ResourceLoadPriorityHighest);
+
+    // Loads in progress and synchronous loads keep their place; only pending asynchronous loads move between queues.
+    for (int priority = ResourceLoadPriorityHighest; priority >= ResourceLoadPriorityLowest; --priority) {
+        LoaderQueue& queue = m_loadersPending[priority];
+        LoaderQueue::iterator end = queue.end();
+        for (LoaderQueue::iterator it = queue.begin(); it != end; ++it) {
+            if (it->get() == loader) {
+                if (priority == newPriority)
+                    return false;
+                RefPtr<NetworkResourceLoader> protector(loader);
+                queue.remove(it);
+                loader->setPriority(newPriority);
+                m_loadersPending[newPriority].append(protector.release());
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 bool HostRecord::hasRequests() const
 {
     if (!m_loadersInProgress.isEmpty())
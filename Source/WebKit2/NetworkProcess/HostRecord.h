@@ -55,6 +55,7 @@ public:
     void scheduleResourceLoader(PassRefPtr<NetworkResourceLoader>);
     void addLoaderInProgress(NetworkResourceLoader*);
     void removeLoader(NetworkResourceLoader*);
+    bool rescheduleResourceLoader(NetworkResourceLoader*, WebCore::ResourceLoadPriority);
     bool hasRequests() const;
     void servePendingRequests(WebCore::ResourceLoadPriority);
 
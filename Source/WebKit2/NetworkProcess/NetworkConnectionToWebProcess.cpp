@@ -45,6 +45,8 @@
 #include <WebCore/SessionID.h>
 #include <wtf/RunLoop.h>
 
+#define MESSAGE_CHECK(assertion) MESSAGE_CHECK_BASE(assertion, connection())
+
 using namespace WebCore;
 
 namespace WebKit {
@@ -141,6 +143,21 @@ void NetworkConnectionToWebProcess::removeLoadIdentifier(ResourceLoadIdentifier
     loader->abort();
 }
 
+void NetworkConnectionToWebProcess::setResourceLoadPriority(ResourceLoadIdentifier identifier, uint32_t resourceLoadPriority)
+{
+    // The priority indexes the scheduler's pending queues, so never trust the web process with it.
+    static_assert(ResourceLoadPriorityLowest == 0, "An unsigned priority can only be out of range above ResourceLoadPriorityHighest");
+    MESSAGE_CHECK(resourceLoadPriority <= static_cast<uint32_t>(ResourceLoadPriorityHighest));
+
+    RefPtr<NetworkResourceLoader> loader = m_networkResourceLoaders.get(identifier);
+
+    // The load may already have finished and been removed while this message was in flight.
+    if (!loader)
+        return;
+
+    NetworkProcess::shared().networkResourceLoadScheduler().setLoaderPriority(loader.get(), static_cast<ResourceLoadPriority>(resourceLoadPriority));
+}
+
 void NetworkConnectionToWebProcess::servePendingRequests(uint32_t resourceLoadPriority)
 {
     NetworkProcess::shared().networkResourceLoadScheduler().servePendingRequests(static_cast<ResourceLoadPriority>(resourceLoadPriority));
@@ -112,6 +112,23 @@ void NetworkResourceLoadScheduler::receivedRedirect(NetworkResourceLoader* loade
     newHost->addLoaderInProgress(loader);
 }
 
+void NetworkResourceLoadScheduler::setLoaderPriority(NetworkResourceLoader* loader, ResourceLoadPriority priority)
+{
+    ASSERT(RunLoop::isMain());
+    LOG(NetworkScheduling, "(NetworkProcess) NetworkResourceLoadScheduler::setLoaderPriority loader '%s' priority %i", loader->request().url().string().utf8().data(), priority);
+
+    HostRecord* host = loader->hostRecord();
+    if (!host || !host->rescheduleResourceLoader(loader, priority))
+        return;
+
+    if (priority > ResourceLoadPriorityLow) {
+        host->servePendingRequests(priority);
+        return;
+    }
+
+    scheduleServePendingRequests();
+}
+
 void NetworkResourceLoadScheduler::servePendingRequests(ResourceLoadPriority minimumPriority)
 {
     LOG(NetworkScheduling, "(NetworkProcess) NetworkResourceLoadScheduler::servePendingRequests Serving requests for up to %i hosts with minimum priority %i", m_hosts.size(), minimumPriority);
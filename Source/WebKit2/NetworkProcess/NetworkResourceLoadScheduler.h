@@ -59,6 +59,9 @@ public:
     void scheduleRemoveLoader(NetworkResourceLoader*);
 
     void receivedRedirect(NetworkResourceLoader*, const WebCore::URL& redirectURL);
+
+    // Called by the WebProcess when the priority of a ResourceLoader changes, e.g. when a preloaded resource is requested for real.
+    void setLoaderPriority(NetworkResourceLoader*, WebCore::ResourceLoadPriority);
     void servePendingRequests(WebCore::ResourceLoadPriority = WebCore::ResourceLoadPriorityVeryLow);
 
     // For NetworkProcess statistics reporting.
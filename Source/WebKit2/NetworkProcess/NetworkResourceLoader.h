@@ -71,6 +71,7 @@ public:
     NetworkConnectionToWebProcess* connectionToWebProcess() const { return m_connection.get(); }
 
     WebCore::ResourceLoadPriority priority() { return m_priority; }
+    void setPriority(WebCore::ResourceLoadPriority priority) { ASSERT(RunLoop::isMain()); m_priority = priority; }
     WebCore::ResourceRequest& request() { return m_request; }
     WebCore::SessionID sessionID() const { return m_sessionID; }
 
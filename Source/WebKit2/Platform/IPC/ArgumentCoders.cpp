@@ -37,16 +37,46 @@ void ArgumentCoder<AtomicString>::encode(ArgumentEncoder& encoder, const AtomicS
     encoder << atomicString.string();
 }
 
-bool ArgumentCoder<AtomicString>::decode(ArgumentDecoder& decoder, AtomicString& atomicString)
+template <typename CharacterType>
+static inline bool decodeAtomicStringText(ArgumentDecoder& decoder, uint32_t length, AtomicString& result)
 {
-    String string;
-    if (!decoder.decode(string))
+    if (!decoder.bufferIsLargeEnoughToContain<CharacterType>(length)) {
+        decoder.markInvalid();
+        return false;
+    }
+
+    const uint8_t* data;
+    if (!decoder.decodeFixedLengthReference(data, length * sizeof(CharacterType), alignof(CharacterType)))
         return false;
 
-    atomicString = string;
+    // Atomize straight from the message buffer, so that names already in the table,
+    // like common HTTP header names, don't allocate a String just to be thrown away.
+    result = AtomicString(reinterpret_cast<const CharacterType*>(data), length);
     return true;
 }
 
+bool ArgumentCoder<AtomicString>::decode(ArgumentDecoder& decoder, AtomicString& atomicString)
+{
+    // This matches the encoding of ArgumentCoder<String>.
+    uint32_t length;
+    if (!decoder.decode(length))
+        return false;
+
+    if (length == std::numeric_limits<uint32_t>::max()) {
+        // This is the null string.
+        atomicString = AtomicString();
+        return true;
+    }
+
+    bool is8Bit;
+    if (!decoder.decode(is8Bit))
+        return false;
+
+    if (is8Bit)
+        return decodeAtomicStringText<LChar>(decoder, length, atomicString);
+    return decodeAtomicStringText<UChar>(decoder, length, atomicString);
+}
+
 void ArgumentCoder<CString>::encode(ArgumentEncoder& encoder, const CString& string)
 {
     // Special case the null string.
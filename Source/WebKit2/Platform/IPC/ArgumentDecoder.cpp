@@ -110,6 +110,17 @@ bool ArgumentDecoder::decodeFixedLengthData(uint8_t* data, size_t size, unsigned
     return true;
 }
 
+bool ArgumentDecoder::decodeFixedLengthReference(const uint8_t*& data, size_t size, unsigned alignment)
+{
+    if (!alignBufferPosition(alignment, size))
+        return false;
+
+    data = m_bufferPos;
+    m_bufferPos += size;
+
+    return true;
+}
+
 bool ArgumentDecoder::decodeVariableLengthByteArray(DataReference& dataReference)
 {
     uint64_t size;
@@ -47,6 +47,9 @@ public:
 
     bool decodeFixedLengthData(uint8_t*, size_t, unsigned alignment);
 
+    // The data returned here will only be valid for the lifetime of the ArgumentDecoder object.
+    bool decodeFixedLengthReference(const uint8_t*&, size_t, unsigned alignment);
+
     // The data in the data reference here will only be valid for the lifetime of the ArgumentDecoder object.
     bool decodeVariableLengthByteArray(DataReference&);
 
@@ -55,6 +55,23 @@ static inline void freeBuffer(void* addr, size_t size)
 #endif
 }
 
+static inline void* reallocBuffer(void* addr, size_t usedSize, size_t size, size_t newSize)
+{
+#if OS(DARWIN)
+    void* newAddr = allocBuffer(newSize);
+    if (!newAddr)
+        CRASH();
+    memcpy(newAddr, addr, usedSize);
+    freeBuffer(addr, size);
+    return newAddr;
+#else
+    // fastRealloc() can often grow the block in place instead of copying it.
+    UNUSED_PARAM(usedSize);
+    UNUSED_PARAM(size);
+    return fastRealloc(addr, newSize);
+#endif
+}
+
 ArgumentEncoder::ArgumentEncoder()
     : m_buffer(m_inlineBuffer)
     , m_bufferPointer(m_inlineBuffer)
@@ -90,14 +107,14 @@ uint8_t* ArgumentEncoder::grow(unsigned alignment, size_t size)
         while (newCapacity < alignedSize + size)
             newCapacity *= 2;
 
-        uint8_t* newBuffer = static_cast<uint8_t*>(allocBuffer(newCapacity));
-        if (!newBuffer)
-            CRASH();
-
-        memcpy(newBuffer, m_buffer, m_bufferSize);
-
-        if (m_buffer != m_inlineBuffer)
-            freeBuffer(m_buffer, m_bufferCapacity);
+        uint8_t* newBuffer;
+        if (m_buffer == m_inlineBuffer) {
+            newBuffer = static_cast<uint8_t*>(allocBuffer(newCapacity));
+            if (!newBuffer)
+                CRASH();
+            memcpy(newBuffer, m_buffer, m_bufferSize);
+        } else
+            newBuffer = static_cast<uint8_t*>(reallocBuffer(m_buffer, m_bufferSize, m_bufferCapacity, newCapacity));
 
         m_buffer = newBuffer;
         m_bufferCapacity = newCapacity;
@@ -224,6 +224,7 @@ Connection::Connection(Identifier identifier, bool isServer, Client* client, Run
     , m_inDispatchMessageCount(0)
     , m_inDispatchMessageMarkedDispatchWhenWaitingForSyncReplyCount(0)
     , m_didReceiveInvalidMessage(false)
+    , m_hasScheduledSendOutgoingMessages(false)
     , m_syncMessageState(SyncMessageState::getOrCreate(clientRunLoop))
     , m_shouldWaitForSyncReplies(true)
 {
@@ -354,13 +355,18 @@ bool Connection::sendMessage(std::unique_ptr<MessageEncoder> encoder, unsigned m
             || m_inDispatchMessageMarkedDispatchWhenWaitingForSyncReplyCount))
         encoder->setShouldDispatchMessageWhenWaitingForSyncReply(true);
 
+    bool shouldScheduleSendOutgoingMessages;
     {
         MutexLocker locker(m_outgoingMessagesLock);
         m_outgoingMessages.append(std::move(encoder));
+
+        // A burst of messages sent in a row is drained by a single sendOutgoingMessages() call.
+        shouldScheduleSendOutgoingMessages = !m_hasScheduledSendOutgoingMessages;
+        m_hasScheduledSendOutgoingMessages = true;
     }
-    
-    // FIXME: We should add a boolean flag so we don't call this when work has already been scheduled.
-    m_connectionQueue->dispatch(WTF::bind(&Connection::sendOutgoingMessages, this));
+
+    if (shouldScheduleSendOutgoingMessages)
+        m_connectionQueue->dispatch(WTF::bind(&Connection::sendOutgoingMessages, this));
     return true;
 }
 
@@ -696,6 +702,12 @@ bool Connection::canSendOutgoingMessages() const
 
 void Connection::sendOutgoingMessages()
 {
+    {
+        // Messages sent from now on need another call, since this one may stop before reaching them.
+        MutexLocker locker(m_outgoingMessagesLock);
+        m_hasScheduledSendOutgoingMessages = false;
+    }
+
     if (!canSendOutgoingMessages())
         return;
 
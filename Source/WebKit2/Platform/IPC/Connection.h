@@ -237,6 +237,7 @@ private:
     // Outgoing messages.
     Mutex m_outgoingMessagesLock;
     Deque<std::unique_ptr<MessageEncoder>> m_outgoingMessages;
+    bool m_hasScheduledSendOutgoingMessages;
     
     std::condition_variable m_waitForMessageCondition;
     std::mutex m_waitForMessageMutex;
@@ -101,6 +101,8 @@ bool LocalStorageDatabase::tryToOpenDatabase(DatabaseOpeningStrategy openingStra
     // even though we never access the database from different threads simultaneously.
     m_database.disableThreadingChecks();
 
+    m_database.setSynchronousNormalIfUsingWAL();
+
     if (!migrateItemTableIfNeeded()) {
         // We failed to migrate the item table. In order to avoid trying to migrate the table over and over,
         // just delete it and start from scratch.
@@ -189,7 +191,7 @@ void LocalStorageDatabase::importItems(StorageMap& storageMap)
         return;
     }
 
-    storageMap.importItems(items);
+    storageMap.importItems(std::move(items));
 }
 
 void LocalStorageDatabase::setItem(const String& key, const String& value)
@@ -79,6 +79,7 @@ void VisitedLinkProvider::addProcess(WebProcessProxy& process)
     ASSERT(m_table.sharedMemory());
 
     sendTable(process);
+    process.connection()->send(Messages::VisitedLinkTableController::AllVisitedLinkStateChanged(), m_identifier);
 }
 
 void VisitedLinkProvider::removeProcess(WebProcessProxy& process)
@@ -152,12 +153,8 @@ void VisitedLinkProvider::pendingVisitedLinksTimerFired()
     if (addedVisitedLinks.isEmpty())
         return;
 
-    for (auto& processAndCount : m_processes) {
-        if (addedVisitedLinks.size() > 20)
-            processAndCount.key->connection()->send(Messages::VisitedLinkTableController::AllVisitedLinkStateChanged(), m_identifier);
-        else
-            processAndCount.key->connection()->send(Messages::VisitedLinkTableController::VisitedLinkStateChanged(addedVisitedLinks), m_identifier);
-    }
+    for (auto& processAndCount : m_processes)
+        sendVisitedLinkStateChanged(*processAndCount.key, addedVisitedLinks);
 }
 
 void VisitedLinkProvider::resizeTable(unsigned newTableSize)
@@ -195,14 +192,23 @@ void VisitedLinkProvider::resizeTable(unsigned newTableSize)
         }
     }
 
+    Vector<WebCore::LinkHash> addedVisitedLinks;
+
     for (auto linkHash : m_pendingVisitedLinks) {
-        if (m_table.addLinkHash(linkHash))
+        if (m_table.addLinkHash(linkHash)) {
+            addedVisitedLinks.append(linkHash);
             m_keyCount++;
+        }
     }
     m_pendingVisitedLinks.clear();
 
-    for (auto& processAndCount : m_processes)
+    // Links that were already in the old table keep their visited state, so only the
+    // newly added ones need their styles invalidated.
+    for (auto& processAndCount : m_processes) {
         sendTable(*processAndCount.key);
+        if (!addedVisitedLinks.isEmpty())
+            sendVisitedLinkStateChanged(*processAndCount.key, addedVisitedLinks);
+    }
 }
 
 void VisitedLinkProvider::sendTable(WebProcessProxy& process)
@@ -214,4 +220,12 @@ void VisitedLinkProvider::sendTable(WebProcessProxy& process)
     process.connection()->send(Messages::VisitedLinkTableController::SetVisitedLinkTable(handle), m_identifier);
 }
 
+void VisitedLinkProvider::sendVisitedLinkStateChanged(WebProcessProxy& process, const Vector<WebCore::LinkHash>& addedVisitedLinks)
+{
+    if (addedVisitedLinks.size() > 20)
+        process.connection()->send(Messages::VisitedLinkTableController::AllVisitedLinkStateChanged(), m_identifier);
+    else
+        process.connection()->send(Messages::VisitedLinkTableController::VisitedLinkStateChanged(addedVisitedLinks), m_identifier);
+}
+
 } // namespace WebKit
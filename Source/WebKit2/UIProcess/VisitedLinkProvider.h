@@ -63,6 +63,7 @@ private:
 
     void resizeTable(unsigned newTableSize);
     void sendTable(WebProcessProxy&);
+    void sendVisitedLinkStateChanged(WebProcessProxy&, const Vector<WebCore::LinkHash>& addedVisitedLinks);
 
     HashCountedSet<WebProcessProxy*> m_processes;
 
@@ -199,6 +199,18 @@ void WebResourceLoadScheduler::crossOriginRedirectReceived(ResourceLoader*, cons
     // We override this call in the WebProcess to make it a no-op.
 }
 
+void WebResourceLoadScheduler::setResourceLoadPriority(ResourceLoader* resourceLoader, ResourceLoadPriority priority)
+{
+    ASSERT(resourceLoader);
+
+    // Only loads that have been handed to the NetworkProcess can be rescheduled there.
+    ResourceLoadIdentifier identifier = resourceLoader->identifier();
+    if (!identifier || !m_webResourceLoaders.contains(identifier))
+        return;
+
+    WebProcess::shared().networkConnection()->connection()->send(Messages::NetworkConnectionToWebProcess::SetResourceLoadPriority(identifier, priority), 0);
+}
+
 void WebResourceLoadScheduler::servePendingRequests(ResourceLoadPriority minimumPriority)
 {
     LOG(NetworkScheduling, "(WebProcess) WebResourceLoadScheduler::servePendingRequests");
@@ -50,6 +50,7 @@ public:
     
     virtual void remove(WebCore::ResourceLoader*) override;
     virtual void crossOriginRedirectReceived(WebCore::ResourceLoader*, const WebCore::URL& redirectURL) override;
+    virtual void setResourceLoadPriority(WebCore::ResourceLoader*, WebCore::ResourceLoadPriority) override;
     
     virtual void servePendingRequests(WebCore::ResourceLoadPriority minimumPriority = WebCore::ResourceLoadPriorityVeryLow) override;
 
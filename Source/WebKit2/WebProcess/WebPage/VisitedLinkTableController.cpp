@@ -92,10 +92,8 @@ void VisitedLinkTableController::setVisitedLinkTable(const SharedMemory::Handle&
     if (!sharedMemory)
         return;
 
+    // The UI process follows this with a message saying which links need their styles invalidated.
     m_visitedLinkTable.setSharedMemory(sharedMemory.release());
-
-    invalidateStylesForAllLinks();
-    pageCache()->markPagesForVistedLinkStyleRecalc();
 }
 
 void VisitedLinkTableController::visitedLinkStateChanged(const Vector<WebCore::LinkHash>& linkHashes)
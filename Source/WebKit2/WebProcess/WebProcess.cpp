@@ -886,6 +886,10 @@ void WebProcess::getWebCoreStatistics(uint64_t callbackID)
         data.statisticsNumbers.set(ASCIILiteral("JavaScriptFreeSize"), JSDOMWindow::commonVM().heap.capacity() - javaScriptHeapSize);
     }
 
+    GlobalMemoryStatistics globalMemoryStats = globalMemoryStatistics();
+    data.statisticsNumbers.set(ASCIILiteral("JavaScriptStackSize"), globalMemoryStats.stackBytes);
+    data.statisticsNumbers.set(ASCIILiteral("JavaScriptJITSize"), globalMemoryStats.JITBytes);
+
     WTF::FastMallocStatistics fastMallocStatistics = WTF::fastMallocStatistics();
     data.statisticsNumbers.set(ASCIILiteral("FastMallocReservedVMBytes"), fastMallocStatistics.reservedVMBytes);
     data.statisticsNumbers.set(ASCIILiteral("FastMallocCommittedVMBytes"), fastMallocStatistics.committedVMBytes);
@@ -1130,6 +1134,7 @@ void WebProcess::pageDidEnterWindow(uint64_t pageID)
 {
     m_pagesInWindows.add(pageID);
     m_nonVisibleProcessCleanupTimer.stop();
+    memoryPressureHandler().setIsInBackground(false);
 }
 
 void WebProcess::pageWillLeaveWindow(uint64_t pageID)
@@ -1149,6 +1154,8 @@ void WebProcess::nonVisibleProcessCleanupTimerFired(Timer<WebProcess>*)
 #if PLATFORM(COCOA)
     wkDestroyRenderingResources();
 #endif
+
+    memoryPressureHandler().setIsInBackground(true);
 }
 
 RefPtr<API::Object> WebProcess::apiObjectByConvertingFromHandles(API::Object* object)
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "AllocationSiteRecorder.h"
+#include "VMAllocate.h"
+#include <algorithm>
+#include <cstring>
+#include <execinfo.h>
+#include <stdio.h>
+
+namespace bmalloc {
+
+static inline size_t hash(void** frames, size_t frameCount)
+{
+    uintptr_t result = 0;
+    for (size_t i = 0; i < frameCount; ++i)
+        result = (result ^ reinterpret_cast<uintptr_t>(frames[i])) * 0x9E3779B97F4A7C15ull;
+    return result >> 16;
+}
+
+AllocationSiteRecorder::AllocationSiteRecorder()
+    : m_sites()
+    , m_siteCount()
+    , m_droppedSampleCount()
+    , m_isEnabled(false)
+{
+}
+
+void AllocationSiteRecorder::setIsEnabled(std::lock_guard<StaticMutex>&, bool isEnabled)
+{
+    // The table is allocated directly from the VM so recording never re-enters malloc.
+    if (isEnabled && !m_sites)
+        m_sites = static_cast<Site*>(vmAllocate(vmSize(allocationSiteTableCapacity * sizeof(Site))));
+
+    m_isEnabled.store(isEnabled, std::memory_order_relaxed);
+}
+
+void AllocationSiteRecorder::record(std::lock_guard<StaticMutex>&, void** frames, size_t frameCount, size_t bytes)
+{
+    if (!m_sites)
+        return;
+
+    frameCount = std::min(frameCount, allocationSiteFrameCount);
+
+    // Open addressing with linear probing. Sites are never removed, so an empty
+    // slot ends the search.
+    size_t mask = allocationSiteTableCapacity - 1;
+    for (size_t i = hash(frames, frameCount) & mask, probes = 0; probes < allocationSiteTableCapacity; i = (i + 1) & mask, ++probes) {
+        Site& site = m_sites[i];
+        if (!site.sampleCount) {
+            // Keep some slots empty so failed lookups stay short.
+            if (m_siteCount >= allocationSiteTableCapacity * 3 / 4)
+                break;
+
+            memcpy(site.frames, frames, frameCount * sizeof(void*));
+            site.frameCount = frameCount;
+            ++m_siteCount;
+        } else if (site.frameCount != frameCount || memcmp(site.frames, frames, frameCount * sizeof(void*)))
+            continue;
+
+        ++site.sampleCount;
+        site.bytes += bytes;
+        return;
+    }
+
+    ++m_droppedSampleCount;
+}
+
+void AllocationSiteRecorder::dump(std::lock_guard<StaticMutex>&, int fd)
+{
+    if (!m_sites)
+        return;
+
+    for (size_t i = 0; i < allocationSiteTableCapacity; ++i) {
+        Site& site = m_sites[i];
+        if (!site.sampleCount)
+            continue;
+
+        dprintf(fd, "%zu bytes in %zu samples\n", site.bytes, site.sampleCount);
+        backtrace_symbols_fd(site.frames, static_cast<int>(site.frameCount), fd);
+        dprintf(fd, "\n");
+    }
+
+    if (m_droppedSampleCount)
+        dprintf(fd, "%zu samples dropped because the site table was full\n", m_droppedSampleCount);
+}
+
+} // namespace bmalloc
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef AllocationSiteRecorder_h
+#define AllocationSiteRecorder_h
+
+#include "Mutex.h"
+#include "Sizes.h"
+#include <atomic>
+#include <mutex>
+
+namespace bmalloc {
+
+// Histogram of the call stacks that make the allocator go to the slow path.
+// Each sample stands for the bytes the slow path provided, so a small or medium
+// sample is worth a whole line, and a large sample is worth its object.
+
+class AllocationSiteRecorder {
+public:
+    AllocationSiteRecorder();
+
+    // Read without the lock, so the slow paths can skip recording cheaply.
+    bool isEnabled() { return m_isEnabled.load(std::memory_order_relaxed); }
+    void setIsEnabled(std::lock_guard<StaticMutex>&, bool);
+
+    void record(std::lock_guard<StaticMutex>&, void** frames, size_t frameCount, size_t bytes);
+    void dump(std::lock_guard<StaticMutex>&, int fd);
+
+private:
+    struct Site {
+        void* frames[allocationSiteFrameCount];
+        size_t frameCount;
+        size_t sampleCount;
+        size_t bytes;
+    };
+
+    Site* m_sites;
+    size_t m_siteCount;
+    size_t m_droppedSampleCount;
+    std::atomic<bool> m_isEnabled;
+};
+
+} // namespace bmalloc
+
+#endif // AllocationSiteRecorder_h
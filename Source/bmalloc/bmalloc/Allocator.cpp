@@ -27,9 +27,11 @@
 #include "BAssert.h"
 #include "Deallocator.h"
 #include "Heap.h"
+#include "Inline.h"
 #include "PerProcess.h"
 #include "Sizes.h"
 #include <algorithm>
+#include <execinfo.h>
 
 using namespace std;
 
@@ -41,6 +43,7 @@ Allocator::Allocator(Deallocator& deallocator)
     , m_mediumAllocator()
     , m_smallAllocatorLog()
     , m_mediumAllocatorLog()
+    , m_statistics()
 {
     unsigned short size = alignment;
     for (auto& allocator : m_smallAllocators) {
@@ -64,6 +67,36 @@ void Allocator::scavenge()
     processMediumAllocatorLog();
 }
 
+ThreadStatistics Allocator::statistics()
+{
+    ThreadStatistics statistics = m_statistics;
+
+    for (auto& allocator : m_smallAllocators) {
+        if (allocator.isNull())
+            continue;
+        statistics.smallAllocatedBytes[smallSizeClassFor(allocator.size())] += allocator.objectCount() * allocator.size();
+    }
+
+    if (!m_mediumAllocator.isNull())
+        statistics.mediumAllocatedBytes += m_mediumAllocator.allocatedBytes();
+
+    return statistics;
+}
+
+inline bool Allocator::shouldRecordAllocationSite()
+{
+    return PerProcess<Heap>::getFastCase()->allocationSiteRecorder().isEnabled();
+}
+
+NO_INLINE void Allocator::recordAllocationSite(size_t bytes)
+{
+    void* frames[allocationSiteFrameCount];
+    int frameCount = backtrace(frames, allocationSiteFrameCount);
+
+    std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
+    PerProcess<Heap>::getFastCase()->allocationSiteRecorder().record(lock, frames, frameCount, bytes);
+}
+
 void Allocator::log(SmallAllocator& allocator)
 {
     if (m_smallAllocatorLog.size() == m_smallAllocatorLog.capacity())
@@ -72,14 +105,17 @@ void Allocator::log(SmallAllocator& allocator)
     if (allocator.isNull())
         return;
 
+    m_statistics.smallAllocatedBytes[smallSizeClassFor(allocator.size())] += allocator.objectCount() * allocator.size();
     m_smallAllocatorLog.push(std::make_pair(allocator.line(), allocator.derefCount()));
 }
 
 void Allocator::processSmallAllocatorLog()
 {
     std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
+    Heap* heap = PerProcess<Heap>::getFastCase();
 
     for (auto& logEntry : m_smallAllocatorLog) {
+        heap->didAllocateSmallObjects(lock, logEntry.first, SmallLine::maxRefCount - logEntry.second);
         if (!logEntry.first->deref(lock, logEntry.second))
             continue;
         m_deallocator.deallocateSmallLine(lock, logEntry.first);
@@ -95,14 +131,17 @@ void Allocator::log(MediumAllocator& allocator)
     if (allocator.isNull())
         return;
 
+    m_statistics.mediumAllocatedBytes += allocator.allocatedBytes();
     m_mediumAllocatorLog.push(std::make_pair(allocator.line(), allocator.derefCount()));
 }
 
 void Allocator::processMediumAllocatorLog()
 {
     std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
+    Heap* heap = PerProcess<Heap>::getFastCase();
 
     for (auto& logEntry : m_mediumAllocatorLog) {
+        heap->didAllocateMediumObjects(lock, MediumLine::maxRefCount - logEntry.second);
         if (!logEntry.first->deref(lock, logEntry.second))
             continue;
         m_deallocator.deallocateMediumLine(lock, logEntry.first);
@@ -113,6 +152,10 @@ void Allocator::processMediumAllocatorLog()
 void* Allocator::allocateLarge(size_t size)
 {
     size = roundUpToMultipleOf<largeAlignment>(size);
+    m_statistics.largeAllocatedBytes += size;
+    if (shouldRecordAllocationSite())
+        recordAllocationSite(size);
+
     std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
     return PerProcess<Heap>::getFastCase()->allocateLarge(lock, size);
 }
@@ -120,6 +163,10 @@ void* Allocator::allocateLarge(size_t size)
 void* Allocator::allocateXLarge(size_t size)
 {
     size = roundUpToMultipleOf<largeAlignment>(size);
+    m_statistics.xLargeAllocatedBytes += size;
+    if (shouldRecordAllocationSite())
+        recordAllocationSite(size);
+
     std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
     return PerProcess<Heap>::getFastCase()->allocateXLarge(lock, size);
 }
@@ -133,6 +180,9 @@ void* Allocator::allocateMedium(size_t size)
     if (allocator.allocate(size, object))
         return object;
 
+    if (shouldRecordAllocationSite())
+        recordAllocationSite(mediumLineSize);
+
     log(allocator);
     allocator.refill(m_deallocator.allocateMediumLine());
     return allocator.allocate(size);
@@ -147,6 +197,9 @@ IF_DEBUG(
     if (size <= smallMax) {
         size_t smallSizeClass = smallSizeClassFor(size);
         SmallAllocator& allocator = m_smallAllocators[smallSizeClass];
+        if (shouldRecordAllocationSite())
+            recordAllocationSite(smallLineSize);
+
         log(allocator);
         allocator.refill(m_deallocator.allocateSmallLine(smallSizeClass));
         return allocator.allocate();
@@ -30,6 +30,7 @@
 #include "MediumAllocator.h"
 #include "Sizes.h"
 #include "SmallAllocator.h"
+#include "Statistics.h"
 #include <array>
 
 namespace bmalloc {
@@ -49,9 +50,14 @@ public:
     
     void scavenge();
 
+    ThreadStatistics statistics();
+
 private:
     void* allocateFastCase(SmallAllocator&);
 
+    bool shouldRecordAllocationSite();
+    void recordAllocationSite(size_t bytes);
+
     void* allocateMedium(size_t);
     void* allocateLarge(size_t);
     void* allocateXLarge(size_t);
@@ -69,6 +75,9 @@ private:
 
     FixedVector<std::pair<SmallLine*, unsigned char>, smallAllocatorLogCapacity> m_smallAllocatorLog;
     FixedVector<std::pair<MediumLine*, unsigned char>, mediumAllocatorLogCapacity> m_mediumAllocatorLog;
+
+    // Only counts lines this allocator has retired. See statistics().
+    ThreadStatistics m_statistics;
 };
 
 inline bool Allocator::allocateFastCase(size_t size, void*& object)
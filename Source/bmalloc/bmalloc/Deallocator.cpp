@@ -80,16 +80,19 @@ void Deallocator::deallocateXLarge(void* object)
 void Deallocator::processObjectLog()
 {
     std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
+    Heap* heap = PerProcess<Heap>::getFastCase();
     
     for (auto object : m_objectLog) {
         if (isSmall(object)) {
             SmallLine* line = SmallLine::get(object);
+            heap->didDeallocateSmallObject(lock, line);
             if (!line->deref(lock))
                 continue;
             deallocateSmallLine(lock, line);
         } else {
             BASSERT(isSmallOrMedium(object));
             MediumLine* line = MediumLine::get(object);
+            heap->didDeallocateMediumObject(lock);
             if (!line->deref(lock))
                 continue;
             deallocateMediumLine(lock, line);
@@ -48,6 +48,13 @@ static inline void sleep(std::unique_lock<StaticMutex>& lock, std::chrono::milli
 
 Heap::Heap(std::lock_guard<StaticMutex>&)
     : m_isAllocatingPages(false)
+    , m_scavengerTarget(noScavengerTarget)
+    , m_smallLineCounts()
+    , m_smallObjectCounts()
+    , m_mediumLineCount(0)
+    , m_mediumObjectCount(0)
+    , m_xLargeChunkCount(0)
+    , m_xLargeChunkBytes(0)
     , m_scavenger(*this, &Heap::concurrentScavenge)
 {
 }
@@ -55,8 +62,18 @@ Heap::Heap(std::lock_guard<StaticMutex>&)
 void Heap::concurrentScavenge()
 {
     std::unique_lock<StaticMutex> lock(PerProcess<Heap>::mutex());
+    if (m_scavengerTarget != noScavengerTarget) {
+        scavengeToTarget(lock);
+        return;
+    }
     scavenge(lock, scavengeSleepDuration);
 }
+
+void Heap::setScavengerTarget(std::lock_guard<StaticMutex>&, size_t target)
+{
+    m_scavengerTarget = target;
+    m_scavenger.run();
+}
     
 void Heap::scavenge(std::unique_lock<StaticMutex>& lock, std::chrono::milliseconds sleepDuration)
 {
@@ -116,6 +133,91 @@ void Heap::scavengeLargeRanges(std::unique_lock<StaticMutex>& lock, std::chrono:
     }
 }
 
+// Pages are pushed onto the free page lists as they become free, so the front
+// of each list holds the pages that have gone unused the longest.
+template<typename Page>
+static void takeColdestPages(Vector<Page*>& pages, size_t count, Vector<Page*>& coldestPages)
+{
+    count = std::min(count, pages.size());
+    coldestPages.push(pages.begin(), pages.begin() + count);
+    for (size_t i = count; i < pages.size(); ++i)
+        pages[i - count] = pages[i];
+    pages.shrink(pages.size() - count);
+}
+
+static inline size_t pageCountForExcess(size_t footprint, size_t target)
+{
+    return roundUpToMultipleOf<vmPageSize>(footprint - target) / vmPageSize;
+}
+
+// Unlike scavenge(), this doesn't sleep or back off while the heap is growing,
+// because the client wants the memory back now. It stops as soon as the process
+// is small enough, so it never decommits pages we aren't asked to give up.
+void Heap::scavengeToTarget(std::unique_lock<StaticMutex>& lock)
+{
+    Vector<SmallPage*> coldSmallPages;
+    Vector<MediumPage*> coldMediumPages;
+
+    while (1) {
+        size_t footprint = vmFootprint();
+        if (footprint <= m_scavengerTarget)
+            return;
+
+        // Small and medium pages are the same size, so drain the longer list first.
+        if (m_smallPages.size() && m_smallPages.size() >= m_mediumPages.size()) {
+            takeColdestPages(m_smallPages, pageCountForExcess(footprint, m_scavengerTarget), coldSmallPages);
+            while (coldSmallPages.size())
+                m_vmHeap.deallocateSmallPage(lock, coldSmallPages.pop());
+            continue;
+        }
+
+        if (m_mediumPages.size()) {
+            takeColdestPages(m_mediumPages, pageCountForExcess(footprint, m_scavengerTarget), coldMediumPages);
+            while (coldMediumPages.size())
+                m_vmHeap.deallocateMediumPage(lock, coldMediumPages.pop());
+            continue;
+        }
+
+        Range range = m_largeRanges.takeGreedy(vmPageSize);
+        if (!range)
+            return;
+        m_vmHeap.deallocateLargeRange(lock, range);
+    }
+}
+
+static inline size_t objectCount(size_t count)
+{
+    // See the comment above m_smallObjectCounts.
+    return static_cast<ptrdiff_t>(count) < 0 ? 0 : count;
+}
+
+HeapStatistics Heap::statistics(std::lock_guard<StaticMutex>&)
+{
+    HeapStatistics statistics;
+
+    for (size_t i = 0; i < statistics.smallSizeClasses.size(); ++i) {
+        SmallSizeClassStatistics& sizeClass = statistics.smallSizeClasses[i];
+        sizeClass.objectSize = (i + 1) * alignment;
+        sizeClass.allocatedBytes = objectCount(m_smallObjectCounts[i]) * sizeClass.objectSize;
+        sizeClass.lineBytes = m_smallLineCounts[i] * smallLineSize;
+    }
+
+    statistics.medium.objectCount = objectCount(m_mediumObjectCount);
+    statistics.medium.lineBytes = m_mediumLineCount * mediumLineSize;
+
+    statistics.smallChunkCount = m_vmHeap.smallChunkCount();
+    statistics.mediumChunkCount = m_vmHeap.mediumChunkCount();
+    statistics.largeChunkCount = m_vmHeap.largeChunkCount();
+    statistics.xLargeChunkCount = m_xLargeChunkCount;
+
+    statistics.committedChunkBytes = statistics.smallChunkCount * smallChunkSize
+        + statistics.mediumChunkCount * mediumChunkSize
+        + statistics.largeChunkCount * largeChunkSize
+        + m_xLargeChunkBytes;
+
+    return statistics;
+}
+
 SmallLine* Heap::allocateSmallLineSlowCase(std::lock_guard<StaticMutex>& lock, size_t smallSizeClass)
 {
     m_isAllocatingPages = true;
@@ -137,6 +239,7 @@ SmallLine* Heap::allocateSmallLineSlowCase(std::lock_guard<StaticMutex>& lock, s
     BASSERT(!line->refCount(lock));
     page->setSmallSizeClass(smallSizeClass);
     page->ref(lock);
+    ++m_smallLineCounts[smallSizeClass];
     return line;
 }
 
@@ -158,12 +261,15 @@ MediumLine* Heap::allocateMediumLineSlowCase(std::lock_guard<StaticMutex>& lock)
         m_mediumLines.push(it);
 
     page->ref(lock);
+    ++m_mediumLineCount;
     return line;
 }
 
 void* Heap::allocateXLarge(std::lock_guard<StaticMutex>&, size_t size)
 {
     XLargeChunk* chunk = XLargeChunk::create(size);
+    ++m_xLargeChunkCount;
+    m_xLargeChunkBytes += size;
 
     BeginTag* beginTag = LargeChunk::beginTag(chunk->begin());
     beginTag->setXLarge();
@@ -176,6 +282,8 @@ void* Heap::allocateXLarge(std::lock_guard<StaticMutex>&, size_t size)
 void Heap::deallocateXLarge(std::lock_guard<StaticMutex>&, void* object)
 {
     XLargeChunk* chunk = XLargeChunk::get(object);
+    --m_xLargeChunkCount;
+    m_xLargeChunkBytes -= chunk->size();
     XLargeChunk::destroy(chunk);
 }
 
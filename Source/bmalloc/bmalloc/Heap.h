@@ -26,6 +26,7 @@
 #ifndef Heap_h
 #define Heap_h
 
+#include "AllocationSiteRecorder.h"
 #include "FixedVector.h"
 #include "VMHeap.h"
 #include "MediumLine.h"
@@ -36,6 +37,7 @@
 #include "SegregatedFreeList.h"
 #include "SmallChunk.h"
 #include "SmallLine.h"
+#include "Statistics.h"
 #include "Vector.h"
 #include <array>
 #include <mutex>
@@ -62,6 +64,17 @@ public:
     void deallocateXLarge(std::lock_guard<StaticMutex>&, void*);
 
     void scavenge(std::unique_lock<StaticMutex>&, std::chrono::milliseconds sleepDuration);
+
+    // Pass noScavengerTarget to go back to scavenging on the regular schedule.
+    void setScavengerTarget(std::lock_guard<StaticMutex>&, size_t);
+
+    void didAllocateSmallObjects(std::lock_guard<StaticMutex>&, SmallLine*, size_t count);
+    void didDeallocateSmallObject(std::lock_guard<StaticMutex>&, SmallLine*);
+    void didAllocateMediumObjects(std::lock_guard<StaticMutex>&, size_t count);
+    void didDeallocateMediumObject(std::lock_guard<StaticMutex>&);
+
+    HeapStatistics statistics(std::lock_guard<StaticMutex>&);
+    AllocationSiteRecorder& allocationSiteRecorder() { return m_allocationSiteRecorder; }
     
 private:
     ~Heap() = delete;
@@ -81,6 +94,7 @@ private:
     void scavengeSmallPages(std::unique_lock<StaticMutex>&, std::chrono::milliseconds);
     void scavengeMediumPages(std::unique_lock<StaticMutex>&, std::chrono::milliseconds);
     void scavengeLargeRanges(std::unique_lock<StaticMutex>&, std::chrono::milliseconds);
+    void scavengeToTarget(std::unique_lock<StaticMutex>&);
 
     std::array<Vector<SmallLine*>, smallMax / alignment> m_smallLines;
     Vector<MediumLine*> m_mediumLines;
@@ -91,6 +105,18 @@ private:
     SegregatedFreeList m_largeRanges;
 
     bool m_isAllocatingPages;
+    size_t m_scavengerTarget;
+
+    // Object counts use modular arithmetic: a free can be counted before the
+    // allocation it undoes, so a count may briefly wrap below zero.
+    std::array<size_t, smallMax / alignment> m_smallLineCounts;
+    std::array<size_t, smallMax / alignment> m_smallObjectCounts;
+    size_t m_mediumLineCount;
+    size_t m_mediumObjectCount;
+    size_t m_xLargeChunkCount;
+    size_t m_xLargeChunkBytes;
+
+    AllocationSiteRecorder m_allocationSiteRecorder;
 
     VMHeap m_vmHeap;
     AsyncTask<Heap, decltype(&Heap::concurrentScavenge)> m_scavenger;
@@ -100,6 +126,7 @@ inline void Heap::deallocateSmallLine(std::lock_guard<StaticMutex>& lock, SmallL
 {
     BASSERT(!line->refCount(lock));
     SmallPage* page = SmallPage::get(line);
+    --m_smallLineCounts[page->smallSizeClass()];
     if (page->deref(lock)) {
         m_smallPages.push(page);
         m_scavenger.run();
@@ -118,6 +145,7 @@ inline SmallLine* Heap::allocateSmallLine(std::lock_guard<StaticMutex>& lock, si
             continue;
         BASSERT(!line->refCount(lock));
         page->ref(lock);
+        ++m_smallLineCounts[smallSizeClass];
         return line;
     }
 
@@ -128,6 +156,7 @@ inline void Heap::deallocateMediumLine(std::lock_guard<StaticMutex>& lock, Mediu
 {
     BASSERT(!line->refCount(lock));
     MediumPage* page = MediumPage::get(line);
+    --m_mediumLineCount;
     if (page->deref(lock)) {
         m_mediumPages.push(page);
         m_scavenger.run();
@@ -145,12 +174,33 @@ inline MediumLine* Heap::allocateMediumLine(std::lock_guard<StaticMutex>& lock)
             continue;
         BASSERT(!line->refCount(lock));
         page->ref(lock);
+        ++m_mediumLineCount;
         return line;
     }
 
     return allocateMediumLineSlowCase(lock);
 }
 
+inline void Heap::didAllocateSmallObjects(std::lock_guard<StaticMutex>&, SmallLine* line, size_t count)
+{
+    m_smallObjectCounts[SmallPage::get(line)->smallSizeClass()] += count;
+}
+
+inline void Heap::didDeallocateSmallObject(std::lock_guard<StaticMutex>&, SmallLine* line)
+{
+    --m_smallObjectCounts[SmallPage::get(line)->smallSizeClass()];
+}
+
+inline void Heap::didAllocateMediumObjects(std::lock_guard<StaticMutex>&, size_t count)
+{
+    m_mediumObjectCount += count;
+}
+
+inline void Heap::didDeallocateMediumObject(std::lock_guard<StaticMutex>&)
+{
+    --m_mediumObjectCount;
+}
+
 } // namespace bmalloc
 
 #endif // Heap_h
@@ -44,6 +44,8 @@ public:
     void* allocate(size_t);
     bool allocate(size_t, void*&);
 
+    size_t allocatedBytes() { return mediumLineSize - m_remaining; }
+
     unsigned char derefCount();
     void refill(MediumLine*);
 
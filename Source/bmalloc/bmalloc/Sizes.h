@@ -90,6 +90,11 @@ namespace Sizes {
     
     static const std::chrono::milliseconds scavengeSleepDuration = std::chrono::milliseconds(512);
 
+    static const size_t noScavengerTarget = std::numeric_limits<size_t>::max();
+
+    static const size_t allocationSiteFrameCount = 16;
+    static const size_t allocationSiteTableCapacity = 4096; // Must be a power of two.
+
     inline size_t smallSizeClassFor(size_t size)
     {
         static const size_t smallSizeClassMask = (smallMax / alignment) - 1;
@@ -45,6 +45,8 @@ public:
     bool canAllocate() { return !!m_remaining; }
     void* allocate();
 
+    size_t size() { return m_size; }
+
     unsigned short objectCount();
     unsigned char derefCount();
     void refill(SmallLine*);
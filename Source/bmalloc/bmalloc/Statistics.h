@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef Statistics_h
+#define Statistics_h
+
+#include "Sizes.h"
+#include <array>
+
+namespace bmalloc {
+
+// Snapshots of what the heap is doing with its memory. The counters behind them
+// are only touched on paths that already take the heap lock, so keeping them
+// costs nothing on the allocation and deallocation fast paths.
+
+struct SmallSizeClassStatistics {
+    size_t objectSize;
+
+    // Objects are counted when their thread's allocator retires the line they
+    // came from, so this lags by up to one line per size class per thread.
+    size_t allocatedBytes;
+
+    // Lines owned by this size class, including empty lines cached by threads.
+    size_t lineBytes;
+
+    size_t freeBytesInLines() const { return lineBytes > allocatedBytes ? lineBytes - allocatedBytes : 0; }
+};
+
+struct MediumStatistics {
+    // Medium lines hold objects of many sizes, and a free doesn't tell us the
+    // size of the object, so we only know how many objects are live.
+    size_t objectCount;
+    size_t lineBytes;
+};
+
+struct HeapStatistics {
+    std::array<SmallSizeClassStatistics, smallMax / alignment> smallSizeClasses;
+    MediumStatistics medium;
+
+    size_t smallChunkCount;
+    size_t mediumChunkCount;
+    size_t largeChunkCount;
+    size_t xLargeChunkCount;
+
+    size_t committedChunkBytes;
+};
+
+// Bytes handed out by one thread's cache, since the thread started.
+struct ThreadStatistics {
+    std::array<size_t, smallMax / alignment> smallAllocatedBytes;
+    size_t mediumAllocatedBytes;
+    size_t largeAllocatedBytes;
+    size_t xLargeAllocatedBytes;
+};
+
+} // namespace bmalloc
+
+#endif // Statistics_h
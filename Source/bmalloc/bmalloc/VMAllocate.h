@@ -32,6 +32,7 @@
 #include "Sizes.h"
 #include "Syscall.h"
 #include <algorithm>
+#include <mach/mach.h>
 #include <mach/vm_statistics.h>
 #include <sys/mman.h>
 #include <unistd.h>
@@ -109,6 +110,17 @@ inline std::pair<void*, Range> vmAllocate(size_t vmSize, size_t alignment, size_
     return std::make_pair(mappedAligned + offset, Range(mapped, mappedSize));
 }
 
+// Returns the process's dirty memory footprint, which, unlike its raw resident
+// size, drops as soon as we madvise pages away. Returns 0 if it can't be measured.
+inline size_t vmFootprint()
+{
+    task_vm_info_data_t vmInfo;
+    mach_msg_type_number_t count = TASK_VM_INFO_COUNT;
+    if (task_info(mach_task_self(), TASK_VM_INFO, reinterpret_cast<task_info_t>(&vmInfo), &count) != KERN_SUCCESS)
+        return 0;
+    return static_cast<size_t>(vmInfo.internal);
+}
+
 inline void vmDeallocatePhysicalPages(void* p, size_t vmSize)
 {
     vmValidate(p, vmSize);
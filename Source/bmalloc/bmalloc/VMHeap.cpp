@@ -33,12 +33,16 @@
 namespace bmalloc {
 
 VMHeap::VMHeap()
+    : m_smallChunkCount(0)
+    , m_mediumChunkCount(0)
+    , m_largeChunkCount(0)
 {
 }
 
 void VMHeap::allocateSmallChunk()
 {
     SmallChunk* chunk = SmallChunk::create();
+    ++m_smallChunkCount;
     for (auto* it = chunk->begin(); it != chunk->end(); ++it)
         m_smallPages.push(it);
 }
@@ -46,6 +50,7 @@ void VMHeap::allocateSmallChunk()
 void VMHeap::allocateMediumChunk()
 {
     MediumChunk* chunk = MediumChunk::create();
+    ++m_mediumChunkCount;
     for (auto* it = chunk->begin(); it != chunk->end(); ++it)
         m_mediumPages.push(it);
 }
@@ -53,6 +58,7 @@ void VMHeap::allocateMediumChunk()
 Range VMHeap::allocateLargeChunk()
 {
     LargeChunk* chunk = LargeChunk::create();
+    ++m_largeChunkCount;
     Range result = BoundaryTag::init(chunk);
     return result;
 }
@@ -53,6 +53,10 @@ public:
     void deallocateMediumPage(std::unique_lock<StaticMutex>&, MediumPage*);
     void deallocateLargeRange(std::unique_lock<StaticMutex>&, Range);
 
+    size_t smallChunkCount() { return m_smallChunkCount; }
+    size_t mediumChunkCount() { return m_mediumChunkCount; }
+    size_t largeChunkCount() { return m_largeChunkCount; }
+
 private:
     void allocateSmallChunk();
     void allocateMediumChunk();
@@ -61,6 +65,10 @@ private:
     Vector<SmallPage*> m_smallPages;
     Vector<MediumPage*> m_mediumPages;
     SegregatedFreeList m_largeRanges;
+
+    size_t m_smallChunkCount;
+    size_t m_mediumChunkCount;
+    size_t m_largeChunkCount;
 };
 
 inline SmallPage* VMHeap::allocateSmallPage()
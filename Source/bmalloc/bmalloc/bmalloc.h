@@ -81,6 +81,46 @@ inline void* realloc(void* object, size_t newSize)
     return result;
 }
     
+// Returns free memory to the system until the process's dirty footprint is at
+// most |bytes|, and does so again each time memory is freed, instead of on the
+// scavenger's regular schedule.
+inline void setScavengerTarget(size_t bytes)
+{
+    std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
+    PerProcess<Heap>::get()->setScavengerTarget(lock, bytes);
+}
+
+inline void clearScavengerTarget()
+{
+    setScavengerTarget(noScavengerTarget);
+}
+
+inline HeapStatistics heapStatistics()
+{
+    std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
+    return PerProcess<Heap>::get()->statistics(lock);
+}
+
+// Statistics for the calling thread's cache.
+inline ThreadStatistics threadStatistics()
+{
+    return PerThread<Cache>::get()->allocator().statistics();
+}
+
+// While enabled, allocations that take the slow path record their call stacks,
+// to be printed by dumpAllocationSites().
+inline void setIsRecordingAllocationSites(bool isRecording)
+{
+    std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
+    PerProcess<Heap>::get()->allocationSiteRecorder().setIsEnabled(lock, isRecording);
+}
+
+inline void dumpAllocationSites(int fd)
+{
+    std::lock_guard<StaticMutex> lock(PerProcess<Heap>::mutex());
+    PerProcess<Heap>::get()->allocationSiteRecorder().dump(lock, fd);
+}
+
 inline void scavenge()
 {
     PerThread<Cache>::get()->scavenge();
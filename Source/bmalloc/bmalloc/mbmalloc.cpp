@@ -24,6 +24,7 @@
  */
 
 #include "bmalloc.h"
+#include <stdio.h>
 
 #define EXPORT __attribute__((visibility("default")))
 
@@ -33,6 +34,8 @@ EXPORT void* mbmalloc(size_t);
 EXPORT void mbfree(void*, size_t);
 EXPORT void* mbrealloc(void*, size_t, size_t);
 EXPORT void mbscavenge();
+EXPORT void mbrecordallocationsites(bool);
+EXPORT void mbdumpstatistics(int fd);
     
 void* mbmalloc(size_t size)
 {
@@ -54,4 +57,31 @@ void mbscavenge()
     bmalloc::api::scavenge();
 }
 
+void mbrecordallocationsites(bool isRecording)
+{
+    bmalloc::api::setIsRecordingAllocationSites(isRecording);
+}
+
+void mbdumpstatistics(int fd)
+{
+    static const size_t kB = 1024;
+
+    bmalloc::HeapStatistics statistics = bmalloc::api::heapStatistics();
+
+    dprintf(fd, "Size class\tAllocated\tLines\tFree in lines\n");
+    for (auto& sizeClass : statistics.smallSizeClasses) {
+        if (!sizeClass.lineBytes)
+            continue;
+        dprintf(fd, "%zu\t%zukB\t%zukB\t%zukB\n",
+            sizeClass.objectSize, sizeClass.allocatedBytes / kB, sizeClass.lineBytes / kB, sizeClass.freeBytesInLines() / kB);
+    }
+    dprintf(fd, "Medium\t%zu objects\t%zukB\n", statistics.medium.objectCount, statistics.medium.lineBytes / kB);
+
+    dprintf(fd, "\nChunks: %zu small, %zu medium, %zu large, %zu xlarge (%zukB)\n\n",
+        statistics.smallChunkCount, statistics.mediumChunkCount, statistics.largeChunkCount, statistics.xLargeChunkCount,
+        statistics.committedChunkBytes / kB);
+
+    bmalloc::api::dumpAllocationSites(fd);
+}
+
 } // extern "C"
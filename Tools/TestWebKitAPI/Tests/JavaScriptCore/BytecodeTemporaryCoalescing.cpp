@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <JavaScriptCore/JavaScript.h>
+#include <runtime/InitializeThreading.h>
+#include <runtime/Options.h>
+#include <string>
+#include <wtf/Vector.h>
+
+namespace TestWebKitAPI {
+
+// Each script keeps many temporaries live across loops, calls, exception handlers and
+// closures, so that a wrong renumbering shows up as a different completion value.
+static const struct {
+    const char* script;
+    const char* expectedResult;
+} coalescingScripts[] = {
+    { "function f(a, b, c) { return ((a + b) * (b - c)) / ((a * c) + (b * b)) + ((a - b) * (c + a)); } var s = 0; for (var i = 0; i < 100; ++i) s += f(i, i + 1, i + 2); Math.round(s * 1000)", "-10104958" },
+    { "function g() { var t = 0; for (var i = 0; i < arguments.length; ++i) t = (t * 31 + arguments[i]) % 1000003; return t; } g(1, g(2, 3), g(g(4), 5, 6), 7, g(8, g(9, 10)))", "709477" },
+    { "function h(x) { var r = []; for (var i = 0; i < x; ++i) { try { if (i % 3 == 0) throw i * 2; r.push(i + 1); } catch (e) { r.push(e - 1); } finally { r.push(-i); } } return r.join(','); } h(10)", "-1,0,2,-1,3,-2,5,-3,5,-4,6,-5,11,-6,8,-7,9,-8,17,-9" },
+    { "function k(n) { var fs = []; for (var i = 0; i < n; ++i) fs.push((function(j) { return function() { return { a: j, b: j * j, c: [j, j + 1, j + 2].length }; }; })(i)); var out = ''; for (var i = 0; i < n; ++i) { var o = fs[i](); out += (o.a + o.b + o.c) + ';'; } return out; } k(8)", "3;5;9;15;23;33;45;59;" },
+    { "var o = { x: 1, y: 2, z: 3 }; var s = ''; for (var p in o) s += p + '=' + (o[p] * 10) + '&'; s", "x=10&y=20&z=30&" },
+    { "function m(a) { return (a > 5 ? a * 2 : a - 1) + (a && a % 2 || 7) + (a < 3 ? (a > 1 ? 100 : 200) : 300); } [0, 1, 2, 3, 6, 9].map(m).join(',')", "206,201,108,303,319,319" },
+    // Code blocks with varargs calls are left alone by the pass.
+    { "function v() { return Math.max.apply(null, arguments) + 1; } v(3, 9, 2)", "10" },
+};
+
+static std::string evaluateInNewContext(const char* source)
+{
+    JSGlobalContextRef context = JSGlobalContextCreate(0);
+    JSStringRef script = JSStringCreateWithUTF8CString(source);
+    JSValueRef exception = 0;
+    JSValueRef value = JSEvaluateScript(context, script, 0, 0, 1, &exception);
+    JSStringRelease(script);
+
+    std::string result;
+    JSStringRef string = JSValueToStringCopy(context, exception ? exception : value, 0);
+    if (string) {
+        Vector<char> buffer(JSStringGetMaximumUTF8CStringSize(string));
+        JSStringGetUTF8CString(string, buffer.data(), buffer.size());
+        result = buffer.data();
+        JSStringRelease(string);
+    }
+
+    JSGlobalContextRelease(context);
+    return result;
+}
+
+static void runCoalescingScripts()
+{
+    for (size_t i = 0; i < WTF_ARRAY_LENGTH(coalescingScripts); ++i)
+        EXPECT_EQ(std::string(coalescingScripts[i].expectedResult), evaluateInNewContext(coalescingScripts[i].script));
+}
+
+TEST(JSC, BytecodeTemporaryCoalescing)
+{
+    JSC::initializeThreading();
+    bool wasEnabled = JSC::Options::coalesceBytecodeTemporaries();
+
+    JSC::Options::coalesceBytecodeTemporaries() = false;
+    runCoalescingScripts();
+
+    JSC::Options::coalesceBytecodeTemporaries() = true;
+    runCoalescingScripts();
+
+    JSC::Options::coalesceBytecodeTemporaries() = wasEnabled;
+}
+
+} // namespace TestWebKitAPI
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 WebKit contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <wtf/HashMap.h>
+#include <wtf/HashSet.h>
+#include <wtf/text/AtomicString.h>
+
+namespace TestWebKitAPI {
+
+TEST(WTF_HashTable, LookupsSurviveRemovalAndRehash)
+{
+    HashMap<unsigned, unsigned> map;
+    for (unsigned i = 1; i <= 1000; ++i)
+        map.add(i, i * 2);
+
+    for (unsigned i = 1; i <= 1000; i += 2)
+        EXPECT_TRUE(map.remove(i));
+    EXPECT_EQ(500, map.size());
+
+    // Deleted buckets stay in the probe sequences until the next rehash, so the
+    // keys that were probed past them must still be found.
+    for (unsigned i = 1; i <= 1000; ++i) {
+        if (i % 2)
+            EXPECT_FALSE(map.contains(i));
+        else
+            EXPECT_EQ(i * 2, map.get(i));
+    }
+
+    // Growing the table rehashes the live entries and drops the deleted ones.
+    for (unsigned i = 1001; i <= 5000; ++i)
+        map.add(i, i * 2);
+    EXPECT_EQ(4500, map.size());
+    for (unsigned i = 1; i <= 5000; ++i) {
+        if (i <= 1000 && i % 2)
+            EXPECT_FALSE(map.contains(i));
+        else
+            EXPECT_EQ(i * 2, map.get(i));
+    }
+}
+
+TEST(WTF_HashTable, RemoveAndAddDoesNotGrowCapacity)
+{
+    HashSet<unsigned> set;
+    for (unsigned i = 1; i <= 32; ++i)
+        set.add(i);
+    int capacity = set.capacity();
+
+    // Churning through keys leaves deleted buckets behind; the table must reclaim
+    // them instead of growing.
+    for (unsigned i = 33; i <= 10000; ++i) {
+        set.remove(i - 32);
+        set.add(i);
+        EXPECT_EQ(32, set.size());
+    }
+    EXPECT_EQ(capacity, set.capacity());
+    for (unsigned i = 10000 - 31; i <= 10000; ++i)
+        EXPECT_TRUE(set.contains(i));
+}
+
+struct ConstantHash {
+    static unsigned hash(unsigned) { return 1; }
+    static bool equal(unsigned a, unsigned b) { return a == b; }
+    static const bool safeToCompareToEmptyOrDeleted = true;
+};
+
+TEST(WTF_HashTable, CollidingKeys)
+{
+    HashMap<unsigned, unsigned, ConstantHash> map;
+    for (unsigned i = 1; i <= 100; ++i)
+        EXPECT_TRUE(map.add(i, i).isNewEntry);
+    EXPECT_FALSE(map.add(50, 0).isNewEntry);
+
+    for (unsigned i = 1; i <= 100; i += 3)
+        map.remove(i);
+    for (unsigned i = 1; i <= 100; ++i) {
+        if (i % 3 == 1)
+            EXPECT_TRUE(map.find(i) == map.end());
+        else
+            EXPECT_EQ(i, map.get(i));
+    }
+}
+
+TEST(WTF_HashTable, AtomicStringImplKeys)
+{
+    HashMap<AtomicStringImpl*, unsigned> map;
+    Vector<AtomicString> strings;
+    for (unsigned i = 0; i < 200; ++i) {
+        strings.append(AtomicString::number(i));
+        map.add(strings.last().impl(), i);
+    }
+
+    for (unsigned i = 0; i < 200; ++i) {
+        // Equal atomic strings share one impl, so a freshly made one finds the entry.
+        AtomicString string = AtomicString::number(i);
+        EXPECT_EQ(strings[i].impl(), string.impl());
+        EXPECT_EQ(i, map.get(string.impl()));
+    }
+
+    for (unsigned i = 0; i < 200; i += 2)
+        map.remove(strings[i].impl());
+    for (unsigned i = 0; i < 200; ++i) {
+        if (i % 2)
+            EXPECT_TRUE(map.contains(strings[i].impl()));
+        else
+            EXPECT_FALSE(map.contains(strings[i].impl()));
+    }
+}
+
+} // namespace TestWebKitAPI